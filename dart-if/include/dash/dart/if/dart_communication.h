@@ -165,6 +165,71 @@ dart_ret_t dart_allgatherv(
   const size_t    * recvdispls,
   dart_team_t       teamid) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoall.
+ *
+ * \param sendbuf The buffer containing the data to be sent to each unit,
+ *                blocks of \c nelem values ordered by target unit.
+ * \param recvbuf The buffer to hold the data received from each unit,
+ *                blocks of \c nelem values ordered by source unit.
+ * \param nelem   Number of values sent to and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ *
+ * If \c sendbuf and \c recvbuf are the same buffer, the data to send is
+ * taken from and replaced by the received data in \c recvbuf. An in-place
+ * exchange has to be requested by all units in \c team.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent to each unit.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ *
+ * \c sendbuf may be \c NULL if no values are sent to any unit.
+ * If \c sendbuf and \c recvbuf are the same buffer, the data to send is
+ * taken from and replaced by the received data in \c recvbuf,
+ * \c nsendelem and \c senddispls are ignored and \c nrecvelem and
+ * \c recvdispls apply to both directions. An in-place exchange has to be
+ * requested by all units in \c teamid.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI allreduce.
  *
@@ -188,6 +253,34 @@ dart_ret_t dart_allreduce(
   dart_operation_t op,
   dart_team_t      team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI_Exscan.
+ *
+ * Computes the exclusive prefix reduction of the values in \c sendbuf over
+ * the units in \c team, i.e., \c recvbuf at unit \c i holds the element-wise
+ * reduction of the values in \c sendbuf at units \c 0, ..., \c i-1 in this
+ * order. The content of \c recvbuf at unit \c 0 is undefined.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the scan.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_exscan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI_Reduce.
  *
@@ -694,6 +787,111 @@ dart_ret_t dart_handle_free(
 
 /** \} */
 
+/**
+ * \name Non-blocking collective operations using handles
+ * Collective operations involving all units of a given team that return
+ * immediately. Completion of the collective operation has to be ensured
+ * using \c dart_wait, \c dart_test and the like on the returned handle.
+ * Buffers passed to these operations must not be accessed before the
+ * operation completed.
+ */
+
+/** \{ */
+
+/**
+ * DART Equivalent to MPI_Ibarrier.
+ *
+ * \param team        The team to perform a barrier on.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t     team,
+  dart_handle_t * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ibcast.
+ *
+ * \param buf    Buffer that is the source (on \c root) or the destination of
+ *               the broadcast.
+ * \param nelem  The number of values to broadcast/receive.
+ * \param dtype  The data type of values in \c buf.
+ * \param root   The unit that broadcasts data to all other members in \c team
+ * \param team   The team to participate in the broadcast.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Iallgather.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of values sent by each process and received from
+ *                each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the allgather.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Iallreduce.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                    with \c dart_wait, \c dart_test etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team,
+  dart_handle_t  * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
@@ -752,6 +950,98 @@ dart_ret_t dart_put_blocking(
 /** \} */
 
 
+/**
+ * \name Notified single-sided communication operations
+ * Point-to-point synchronization of a put with the target unit through a
+ * notification counter of type \c int64_t in global memory.
+ */
+
+/** \{ */
+
+/**
+ * Copy data from local memory into memory referenced by a global pointer
+ * and update a notification counter at the same unit afterwards.
+ *
+ * The counter referenced by \c notify is updated atomically by applying
+ * \c op with \c value, with \c op being either \c DART_OP_SUM to increment
+ * or \c DART_OP_REPLACE to set the counter.
+ * The update is only performed after the data has been written to the
+ * target so that a unit observing the update through
+ * \ref dart_notify_wait or \ref dart_notify_test is guaranteed to see the
+ * data as well.
+ * When this function returns, both the data transfer and the update of
+ * the counter are complete.
+ *
+ * \param gptr      A global pointer determining the target of the put.
+ * \param src       The local source buffer to load the data from.
+ * \param nelem     The number of elements of type \c dtype to transfer.
+ * \param src_type  The data type of the values in buffer \c src.
+ * \param dst_type  The data type of the values at the target.
+ * \param notify    Global pointer to the notification counter, which has to
+ *                  reside on the same unit as \c gptr.
+ * \param value     The value to add to or to store in the counter.
+ * \param op        The update to apply, \c DART_OP_SUM or
+ *                  \c DART_OP_REPLACE.
+ *
+ * \note Base-type conversion is not performed.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_gptr_t       notify,
+  int64_t           value,
+  dart_operation_t  op) DART_NOTHROW;
+
+/**
+ * Wait until the notification counter referenced by \c notify has reached
+ * at least \c value.
+ *
+ * Data written by \ref dart_put_notify before updating the counter is
+ * visible to the calling unit when this function returns.
+ *
+ * \param notify    Global pointer to a notification counter residing on
+ *                  the calling unit.
+ * \param value     The counter value to wait for.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_notify_wait(
+  dart_gptr_t       notify,
+  int64_t           value) DART_NOTHROW;
+
+/**
+ * Test whether the notification counter referenced by \c notify has
+ * reached at least \c value.
+ *
+ * \param notify    Global pointer to a notification counter residing on
+ *                  the calling unit.
+ * \param value     The counter value to test for.
+ * \param[out] flag 1 if the counter has reached \c value, 0 otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_notify_test(
+  dart_gptr_t       notify,
+  int64_t           value,
+  int32_t         * flag) DART_NOTHROW;
+
+/** \} */
+
+
 /**
  * \name Blocking two-sided communication operations
  * These operations will block until the operation is finished,
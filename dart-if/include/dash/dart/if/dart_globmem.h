@@ -165,6 +165,30 @@ dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t    gptr,
         void        ** addr) DART_NOTHROW;
 
+/**
+ * Get a native memory address for the specified global pointer
+ * gptr that can be used for direct load/store access. In contrast to
+ * \ref dart_gptr_getaddr, this also returns an address if the target
+ * unit is located on the same node as the calling unit and the memory
+ * referenced by \c gptr is accessible through a shared memory window.
+ *
+ * Accesses through the returned address are not synchronized, the
+ * caller has to ensure consistency, e.g. using \ref dart_barrier.
+ *
+ * \param      gptr Global pointer
+ * \param[out] addr Pointer to a pointer that will hold the native
+ *                  address if the memory referenced by \c gptr is
+ *                  directly accessible, \c NULL otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_gptr_getaddr_shared(
+  const dart_gptr_t    gptr,
+        void        ** addr) DART_NOTHROW;
+
 /**
  * Set the local memory address for the specified global pointer such
  * the the specified address.
@@ -262,6 +286,13 @@ dart_ret_t dart_gptr_setflags(
  * address space of the calling unit and returns a global pointer to it.
  * This is *not* a collective function.
  *
+ * Allocations are served from a pre-allocated pool whose size can be set
+ * in the environment variable \c DART_LOCAL_ALLOC_SIZE (in bytes, with an
+ * optional suffix \c K, \c M or \c G, default: 16M). If the pool is
+ * exhausted, additional memory is allocated on demand. Note that only
+ * memory in the pre-allocated pool is accessible through shared memory
+ * windows.
+ *
  * \param nelem The number of elements of type \c dtype to allocate.
  * \param dtype The type to use.
  * \param[out] gptr Global Pointer to hold the allocation
@@ -41,6 +41,14 @@ dart_ret_t dart_init(int *argc, char ***argv) DART_NOTHROW;
 /**
  * Initialize the DART runtime with support for thread-based concurrency.
  *
+ * If the environment variable \c DART_PROGRESS_THREAD is set to \c 1,
+ * \c on, \c yes or \c true (case-insensitive) and
+ * \ref DART_THREAD_MULTIPLE is provided, a progress thread is
+ * started that drives outstanding non-blocking operations in the
+ * background. It polls every \c DART_PROGRESS_INTERVAL microseconds
+ * (default: 50) and is pinned to a CPU not occupied by units on the same
+ * node according to \ref dart_unit_locality, if there is any.
+ *
  * \param argc  Pointer to the number of command line arguments.
  * \param argv  Pointer to the array of command line arguments.
  * \param[out] thread_safety The provided thread safety,
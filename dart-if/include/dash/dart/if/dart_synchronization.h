@@ -108,6 +108,133 @@ dart_ret_t dart_lock_try_acquire(
 dart_ret_t dart_lock_release(
   dart_lock_t   lock)   DART_NOTHROW;
 
+/**
+ * Reader-writer lock type to ensure mutual exclusion of units holding the
+ * lock in exclusive mode while allowing multiple units to hold the lock in
+ * shared mode concurrently.
+ * \ingroup DartSync
+ */
+typedef struct dart_rwlock_struct *dart_rwlock_t;
+
+/**
+ * Collective operation to initialize the reader-writer \c lock object.
+ *
+ * \param teamid Team this lock is used for.
+ * \param lock   The lock to initialize.
+ *
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_init(
+  dart_team_t     teamid,
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Collective operation to destroy a \c lock initialized using
+ * \ref dart_team_rwlock_init.
+ *
+ * \param lock   The \c lock to free.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_none
+ * \ingroup DartSync
+ */
+dart_ret_t dart_team_rwlock_destroy(
+  dart_rwlock_t * lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired in exclusive mode.
+ *
+ * Units waiting for exclusive access are queued and take precedence over
+ * units trying to acquire the lock in shared mode.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock in exclusive mode and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release the \c lock acquired in exclusive mode through
+ * \ref dart_rwlock_acquire or \ref dart_rwlock_try_acquire.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired in shared mode.
+ *
+ * Acquiring and releasing the lock in shared mode only involves atomic
+ * operations on memory of the calling unit as long as no unit holds or
+ * waits for the lock in exclusive mode.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_acquire_shared(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the \c lock in shared mode and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_try_acquire_shared(
+  dart_rwlock_t   lock,
+  int32_t       * result) DART_NOTHROW;
+
+/**
+ * Release the \c lock acquired in shared mode through
+ * \ref dart_rwlock_acquire_shared or \ref dart_rwlock_try_acquire_shared.
+ *
+ * \param lock The lock to release.
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_rwlock_release_shared(
+  dart_rwlock_t   lock)   DART_NOTHROW;
+
 
 /** \cond DART_HIDDEN_SYMBOLS */
 #define DART_INTERFACE_OFF
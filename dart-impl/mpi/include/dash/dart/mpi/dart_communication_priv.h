@@ -12,6 +12,7 @@
 #include <dash/dart/base/macro.h>
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/mutex.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -77,6 +78,11 @@ dart_ret_t dart__mpi__op_fini();
 
 #define DART_MPI_TYPE_UNDEFINED (MPI_Datatype)MPI_UNDEFINED
 
+/**
+ * The number of committed MPI vector types kept per strided DART type.
+ */
+#define DART_MPI_STRIDED_CACHE_SIZE 8
+
 typedef enum {
   DART_KIND_BASIC = 0,
   DART_KIND_STRIDED,
@@ -103,10 +109,18 @@ typedef struct dart_datatype_struct {
     } contiguous;
     /// used for DART_KIND_STRIDED
     /// NOTE: the underlying MPI strided type is created dynamically based on
-    ///       the number of blocks required.
+    ///       the number of blocks required and cached for later transfers.
     struct {
       /// the stride between blocks of size \c num_elem
       int              stride;
+      /// the number of valid entries in the type cache
+      int              num_cached;
+      /// the numbers of blocks of the cached MPI types
+      size_t           cached_blocks[DART_MPI_STRIDED_CACHE_SIZE];
+      /// committed MPI vector types, released in \c dart_type_destroy
+      MPI_Datatype     cached_types[DART_MPI_STRIDED_CACHE_SIZE];
+      /// protects the type cache
+      dart_mutex_t     mutex;
     } strided;
     /// used for DART_KIND_INDEXED
     struct {
@@ -206,13 +220,38 @@ size_t dart__mpi__datatype_num_elem(dart_datatype_t dart_type) {
   return (dart__mpi__datatype_struct(dart_type)->num_elem);
 }
 
+/**
+ * Returns a committed MPI vector type covering \c num_blocks blocks of the
+ * strided type \c dart_type. Types are cached per DART type, the returned
+ * type has to be passed to \ref dart__mpi__destroy_strided_mpi.
+ */
 MPI_Datatype
 dart__mpi__create_strided_mpi(
   dart_datatype_t dart_type,
   size_t          num_blocks) DART_INTERNAL;
 
+/**
+ * Releases a type returned by \ref dart__mpi__create_strided_mpi.
+ * Only types that could not be cached are freed.
+ */
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type) DART_INTERNAL;
+dart__mpi__destroy_strided_mpi(
+  dart_datatype_t   dart_type,
+  MPI_Datatype    * mpi_type) DART_INTERNAL;
+
+/**
+ * Copies \c nelem elements between two buffers in local memory, traversing
+ * the (possibly strided or indexed) layouts of \c src_type and
+ * \c dst_type. Returns \c DART_ERR_INVAL if the layouts do not describe
+ * the same number of bytes.
+ */
+dart_ret_t
+dart__mpi__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem) DART_INTERNAL;
 
 DART_INLINE
 void
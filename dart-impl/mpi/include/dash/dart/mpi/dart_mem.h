@@ -13,12 +13,68 @@
 #include <inttypes.h>
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_types.h>
+
+/**
+ * Default size in bytes of the pre-allocated memory pool used by
+ * \c dart_memalloc.
+ */
+#define DART_LOCAL_ALLOC_SIZE_DEFAULT (1024*1024*16)
+
+/**
+ * Name of the environment variable to set the size of the pre-allocated
+ * memory pool used by \c dart_memalloc, e.g. \c 64M.
+ */
+#define DART_LOCAL_ALLOC_SIZE_ENVSTR  "DART_LOCAL_ALLOC_SIZE"
 
 // forward declaration
 struct dart_buddy;
 extern char* dart_mempool_localalloc DART_INTERNAL;
 extern struct dart_buddy* dart_localpool DART_INTERNAL;
 
+/**
+ * Returns the size of the pre-allocated memory pool used by
+ * \c dart_memalloc as configured in the environment, rounded up to the
+ * next power of 2.
+ */
+size_t dart__mpi__localpool_size() DART_INTERNAL;
+
+/**
+ * Initialize the allocator of \c dart_memalloc managing the pre-allocated
+ * memory pool of \c size bytes at \c dart_mempool_localalloc.
+ */
+dart_ret_t dart__mpi__localpool_init(size_t size) DART_INTERNAL;
+
+/**
+ * Release the allocator of \c dart_memalloc and all memory attached to the
+ * dynamic window of \c DART_TEAM_ALL when the pre-allocated pool was
+ * exhausted.
+ */
+dart_ret_t dart__mpi__localpool_fini() DART_INTERNAL;
+
+/**
+ * Allocate \c nbytes from the pre-allocated memory pool.
+ * Small allocations are served from per-thread caches of size classes.
+ * If the pool is exhausted, the allocation is served from a chunk attached
+ * to the dynamic window of \c DART_TEAM_ALL.
+ *
+ * \param nbytes      The number of bytes to allocate.
+ * \param[out] segid  The segment of the allocation, either
+ *                    \c DART_SEGMENT_LOCAL or \c DART_SEGMENT_LOCAL_DYNAMIC.
+ * \param[out] offset The offset of the allocation in the segment.
+ */
+dart_ret_t dart__mpi__localpool_alloc(
+  size_t     nbytes,
+  int16_t  * segid,
+  uint64_t * offset) DART_INTERNAL;
+
+/**
+ * Return memory allocated through \c dart__mpi__localpool_alloc.
+ */
+dart_ret_t dart__mpi__localpool_free(
+  int16_t    segid,
+  uint64_t   offset) DART_INTERNAL;
+
 /**
  * Create a new buddy allocator instance.
  *
@@ -0,0 +1,63 @@
+/**
+ * \file dash/dart/mpi/dart_progress_priv.h
+ *
+ * Internal interface of the optional progress thread of the DART-MPI
+ * library.
+ */
+#ifndef DART__MPI__DART_PROGRESS_PRIV_H__
+#define DART__MPI__DART_PROGRESS_PRIV_H__
+
+#include <dash/dart/if/dart_types.h>
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Enables the progress thread if set to 1, on, yes or true. */
+#define DART_PROGRESS_THREAD_ENVSTR      "DART_PROGRESS_THREAD"
+/** Interval between two polls of the progress thread in microseconds. */
+#define DART_PROGRESS_INTERVAL_ENVSTR    "DART_PROGRESS_INTERVAL"
+
+#define DART_PROGRESS_INTERVAL_DEFAULT   50
+
+/*
+ * The functions in this header are not hidden as they are called by the
+ * unit tests of the DART-MPI backend.
+ */
+
+/**
+ * Whether the progress thread is requested in the environment.
+ */
+bool dart__mpi__progress_requested();
+
+/**
+ * The interval between two polls of the progress thread in microseconds
+ * as specified in the environment, \c DART_PROGRESS_INTERVAL_DEFAULT if
+ * it is not specified or invalid.
+ */
+long dart__mpi__progress_interval();
+
+/**
+ * Starts the progress thread if it has been requested in the environment
+ * and MPI provides \c MPI_THREAD_MULTIPLE. Has to be called after the
+ * locality information has been initialized.
+ */
+dart_ret_t dart__mpi__progress_init(int thread_provided);
+
+/**
+ * Stops the progress thread if it is running.
+ */
+dart_ret_t dart__mpi__progress_fini();
+
+/**
+ * Whether the progress thread is running.
+ */
+bool dart__mpi__progress_running();
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif /* DART__MPI__DART_PROGRESS_PRIV_H__ */
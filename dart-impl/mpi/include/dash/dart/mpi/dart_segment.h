@@ -12,10 +12,20 @@
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/base/macro.h>
+#include <dash/dart/base/logging.h>
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/**
+ * Number of entries in a block of the segment table.
+ */
+#define DART_SEGMENT_BLOCK_BITS 8
+#define DART_SEGMENT_BLOCK_SIZE (1 << DART_SEGMENT_BLOCK_BITS)
+/**
+ * Number of blocks required to cover all positive or negative segment IDs.
+ */
+#define DART_SEGMENT_NUM_BLOCKS \
+  ((INT16_MAX >> DART_SEGMENT_BLOCK_BITS) + 1)
 
 typedef struct
 {
@@ -31,13 +41,24 @@ typedef struct
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct dart_segment_elem dart_segment_elem_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
-  dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
+  /**
+   * Directly indexed tables of allocated segments (IDs >= 0) and registered
+   * segments (IDs < 0, indexed by the negated ID).
+   * Blocks of the tables are allocated on demand and never moved, so
+   * lookups do not require locking.
+   */
+  dart_segment_info_t ** mem_segs[DART_SEGMENT_NUM_BLOCKS];
+  dart_segment_info_t ** reg_segs[DART_SEGMENT_NUM_BLOCKS];
+  /**
+   * Segment DART_SEGMENT_LOCAL_DYNAMIC, only in DART_TEAM_ALL.
+   */
+  dart_segment_info_t  * local_dynamic;
+  dart_team_t            team_id;
+  dart_segment_elem_t  * mem_freelist;
+  dart_segment_elem_t  * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
@@ -54,13 +75,24 @@ typedef struct {
 
 typedef enum {
   DART_SEGMENT_LOCAL_ALLOC,
+  DART_SEGMENT_LOCAL_DYNAMIC_ALLOC,
   DART_SEGMENT_ALLOC,
   DART_SEGMENT_REGISTER
 } dart_segment_type;
 
+/**
+ * Segment ID identifying local allocations that did not fit into the
+ * pre-allocated pool of \c dart_memalloc and have been served from memory
+ * attached to the dynamic window of \c DART_TEAM_ALL.
+ * The offset of global pointers in this segment is the absolute address of
+ * the allocation at the owning unit.
+ * The ID is never handed out for registered segments.
+ */
+#define DART_SEGMENT_LOCAL_DYNAMIC ((dart_segid_t)INT16_MIN)
+
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment data table.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -85,11 +117,38 @@ dart_segment_register(
   dart_segment_info_t *seg) DART_INTERNAL;
 
 /**
- * Returns the segment info for the segment with ID \c segid.
+ * Returns the segment info for the segment with ID \c segid or \c NULL
+ * if no such segment exists.
  */
-dart_segment_info_t * dart_segment_get_info(
-  dart_segmentdata_t *segdata,
-  dart_segid_t        segid) DART_INTERNAL;
+static inline
+dart_segment_info_t *
+dart_segment_get_info(
+  const dart_segmentdata_t *segdata,
+  dart_segid_t              segid)
+{
+  dart_segment_info_t  * seg   = NULL;
+  dart_segment_info_t ** block = NULL;
+  if (segid >= 0) {
+    block = segdata->mem_segs[segid >> DART_SEGMENT_BLOCK_BITS];
+    if (dart__likely(block != NULL)) {
+      seg = block[segid & (DART_SEGMENT_BLOCK_SIZE - 1)];
+    }
+  } else if (segid != DART_SEGMENT_LOCAL_DYNAMIC) {
+    int index = -segid;
+    block = segdata->reg_segs[index >> DART_SEGMENT_BLOCK_BITS];
+    if (dart__likely(block != NULL)) {
+      seg = block[index & (DART_SEGMENT_BLOCK_SIZE - 1)];
+    }
+  } else {
+    seg = segdata->local_dynamic;
+  }
+  if (dart__unlikely(seg == NULL)) {
+    DART_LOG_ERROR("dart_segment_get_info : "
+                   "Invalid segment ID %i on team %i",
+                   segid, segdata->team_id);
+  }
+  return seg;
+}
 
 /**
  * Returns the segment's displacement at unit \c team_unit_id.
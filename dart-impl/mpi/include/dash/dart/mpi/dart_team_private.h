@@ -225,11 +225,32 @@ dart_ret_t dart_adapt_teamlist_alloc(dart_team_t teamid) DART_INTERNAL;
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid) DART_INTERNAL;
 
+#define DART_TEAM_HASH_SIZE (256)
+
+/**
+ * Hash table of the teams the calling unit is part of, indexed by the
+ * team ID modulo \c DART_TEAM_HASH_SIZE.
+ */
+extern dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE] DART_INTERNAL;
+
 /**
  * Retrieve the \c dart_team_data for \c teamid.
+ * Returns \c NULL if the calling unit is not part of the team.
  */
+static inline
 dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
+dart_adapt_teamlist_get(dart_team_t teamid)
+{
+  if (dart__unlikely(teamid < 0)) {
+    return NULL;
+  }
+  dart_team_data_t *res = dart_team_data[teamid % DART_TEAM_HASH_SIZE];
+  // only walk the chain on collisions
+  while (dart__unlikely(res != NULL && res->teamid != teamid)) {
+    res = res->next;
+  }
+  return res;
+}
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
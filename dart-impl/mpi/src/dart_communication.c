@@ -157,6 +157,30 @@ static dart_ret_t put_shared_mem(
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Returns a pointer to the target memory if it can be accessed directly,
+ * i.e., if the target is the calling unit or a unit sharing a memory window
+ * with it, or NULL otherwise.
+ */
+static inline char *
+local_target_ptr(
+    const dart_team_data_t    * team_data,
+    dart_team_unit_t            unitid,
+    const dart_segment_info_t * seginfo,
+    uint64_t                    offset)
+{
+  if (team_data->unitid == unitid.id) {
+    return seginfo->selfbaseptr + offset;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 && team_data->sharedmem_tab[unitid.id].id >= 0) {
+    dart_team_unit_t luid = team_data->sharedmem_tab[unitid.id];
+    return seginfo->baseptr[luid.id] + offset;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return NULL;
+}
+
 /**
  * Internal implementations of put/get with and without handles for
  * basic data types and complex data types.
@@ -282,6 +306,7 @@ dart__mpi__get_basic(
 static inline
   dart_ret_t
 dart__mpi__get_complex(
+    const dart_team_data_t    * team_data,
     dart_team_unit_t            team_unit_id,
     const dart_segment_info_t * seginfo,
     void                      * dest,
@@ -296,6 +321,14 @@ dart__mpi__get_complex(
 
   CHECK_TYPE_CONSTRAINTS(src_type, dst_type, nelem);
 
+  // pack/unpack directly if the source is in local or shared memory
+  char * src_ptr = local_target_ptr(team_data, team_unit_id, seginfo, offset);
+  if (src_ptr != NULL) {
+    DART_LOG_DEBUG("dart_get: typed copy of %zu elements from %p",
+                   nelem, src_ptr);
+    return dart__mpi__datatype_copy(dest, dst_type, src_ptr, src_type, nelem);
+  }
+
   MPI_Win win     = seginfo->win;
   char * dest_ptr = (char*) dest;
   offset         += dart_segment_disp(seginfo, team_unit_id);
@@ -326,10 +359,10 @@ dart__mpi__get_complex(
       "MPI_Rget");
   // clean-up strided data types
   if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
+    dart__mpi__destroy_strided_mpi(src_type, &src_mpi_type);
   }
   if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+    dart__mpi__destroy_strided_mpi(dst_type, &dst_mpi_type);
   }
   return DART_OK;
 }
@@ -421,6 +454,7 @@ dart__mpi__put_basic(
 static inline
   dart_ret_t
 dart__mpi__put_complex(
+    const dart_team_data_t    * team_data,
     dart_team_unit_t            team_unit_id,
     const dart_segment_info_t * seginfo,
     const void                * src,
@@ -432,12 +466,21 @@ dart__mpi__put_complex(
     uint8_t                   * num_reqs,
     bool                      * flush_required_ptr)
 {
-  if (flush_required_ptr) *flush_required_ptr = true;
   if (num_reqs) *num_reqs = 0;
 
-  // slow path for derived types
   CHECK_TYPE_CONSTRAINTS(src_type, dst_type, nelem);
 
+  // pack/unpack directly if the target is in local or shared memory
+  char * dst_ptr = local_target_ptr(team_data, team_unit_id, seginfo, offset);
+  if (dst_ptr != NULL) {
+    if (flush_required_ptr) *flush_required_ptr = false;
+    DART_LOG_DEBUG("dart_put: typed copy of %zu elements to %p",
+                   nelem, dst_ptr);
+    return dart__mpi__datatype_copy(dst_ptr, dst_type, src, src_type, nelem);
+  }
+
+  if (flush_required_ptr) *flush_required_ptr = true;
+
   MPI_Win win            = seginfo->win;
   const char * src_ptr   = (const char*) src;
   offset                += dart_segment_disp(seginfo, team_unit_id);
@@ -472,10 +515,10 @@ dart__mpi__put_complex(
 
   // clean-up strided data types
   if (dart__mpi__datatype_isstrided(src_type)) {
-    dart__mpi__destroy_strided_mpi(&src_mpi_type);
+    dart__mpi__destroy_strided_mpi(src_type, &src_mpi_type);
   }
   if (src_type != dst_type && dart__mpi__datatype_isstrided(dst_type)) {
-    dart__mpi__destroy_strided_mpi(&dst_mpi_type);
+    dart__mpi__destroy_strided_mpi(dst_type, &dst_mpi_type);
   }
   return DART_OK;
 }
@@ -525,7 +568,7 @@ dart_ret_t dart_get(
         offset, nelem, src_type, NULL, NULL);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
         offset, nelem, src_type, dst_type, NULL, NULL);
   }
 
@@ -574,7 +617,7 @@ dart_ret_t dart_put(
         NULL, NULL, NULL);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
         offset, nelem, src_type, dst_type,
         NULL, NULL, NULL);
   }
@@ -946,7 +989,7 @@ dart_ret_t dart_get_handle(
         handle->reqs, &handle->num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
         offset, nelem, src_type, dst_type,
         handle->reqs, &handle->num_reqs);
   }
@@ -1017,7 +1060,7 @@ dart_ret_t dart_put_handle(
                                &handle->needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  handle->reqs,
                                  &handle->num_reqs,
@@ -1089,7 +1132,7 @@ dart_ret_t dart_put_blocking(
                                NULL, NULL, &needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  NULL, NULL, &needs_flush);
   }
@@ -1156,7 +1199,7 @@ dart_ret_t dart_get_blocking(
                                reqs, &num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
                                  offset, nelem, src_type, dst_type,
                                  reqs, &num_reqs);
   }
@@ -1170,6 +1213,184 @@ dart_ret_t dart_get_blocking(
   return DART_OK;
 }
 
+/* -- Dart notified RMA operations -- */
+
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_gptr_t       notify,
+  int64_t           value,
+  dart_operation_t  op)
+{
+  dart_team_unit_t  team_unit_id = DART_TEAM_UNIT_ID(gptr.unitid);
+  uint64_t          offset       = gptr.addr_or_offs.offset;
+  int16_t           seg_id       = gptr.segid;
+  dart_team_t       teamid       = gptr.teamid;
+
+  CHECK_EQUAL_BASETYPE(src_type, dst_type);
+
+  if (dart__unlikely(op != DART_OP_SUM && op != DART_OP_REPLACE)) {
+    DART_LOG_ERROR("dart_put_notify ! "
+                   "Notification only supports DART_OP_SUM and DART_OP_REPLACE");
+    return DART_ERR_INVAL;
+  }
+  if (dart__unlikely(notify.teamid != teamid ||
+                     notify.unitid != gptr.unitid)) {
+    DART_LOG_ERROR("dart_put_notify ! "
+                   "Notification counter not located at the target unit %d",
+                   gptr.unitid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_put_notify ! failed: Unknown team %i!", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(team_unit_id, team_data);
+
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), seg_id);
+  dart_segment_info_t *notify_seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), notify.segid);
+  if (dart__unlikely(seginfo == NULL || notify_seginfo == NULL)) {
+    DART_LOG_ERROR("dart_put_notify ! "
+                   "Unknown segment %i or %i on team %i",
+                   seg_id, notify.segid, teamid);
+    return DART_ERR_INVAL;
+  }
+
+  DART_LOG_DEBUG("dart_put_notify() uid:%d o:%"PRIu64" s:%d t:%d, nelem:%zu",
+                 team_unit_id.id, offset, seg_id, teamid, nelem);
+
+  dart_ret_t ret = DART_OK;
+  bool needs_flush = false;
+
+  if (dart__mpi__datatype_iscontiguous(src_type) &&
+      dart__mpi__datatype_iscontiguous(dst_type)) {
+    ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
+                               offset, nelem, src_type,
+                               NULL, NULL, &needs_flush);
+  } else {
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
+                                 offset, nelem, src_type, dst_type,
+                                 NULL, NULL, &needs_flush);
+  }
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  // the payload has to be complete at the target before the counter changes
+  if (needs_flush) {
+    CHECK_MPI_RET(
+      MPI_Win_flush(team_unit_id.id, seginfo->win), "MPI_Win_flush");
+  } else {
+    // order the preceding stores to local or shared memory
+    CHECK_MPI_RET(MPI_Win_sync(seginfo->win), "MPI_Win_sync");
+  }
+
+  MPI_Win  notify_win  = notify_seginfo->win;
+  MPI_Aint notify_disp = notify.addr_or_offs.offset +
+                         dart_segment_disp(notify_seginfo, team_unit_id);
+  CHECK_MPI_RET(
+    MPI_Accumulate(
+      &value, 1, MPI_INT64_T,
+      team_unit_id.id, notify_disp, 1, MPI_INT64_T,
+      dart__mpi__op(op, DART_TYPE_LONGLONG), notify_win),
+    "MPI_Accumulate");
+  CHECK_MPI_RET(
+    MPI_Win_flush(team_unit_id.id, notify_win), "MPI_Win_flush");
+
+  DART_LOG_DEBUG("dart_put_notify > finished");
+  return DART_OK;
+}
+
+/**
+ * Reads the notification counter referenced by \c notify at the calling
+ * unit.
+ */
+static inline
+dart_ret_t
+dart__mpi__notify_read(
+  dart_gptr_t   notify,
+  MPI_Comm    * comm,
+  int64_t     * result)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(notify.teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_notify ! failed: Unknown team %i!", notify.teamid);
+    return DART_ERR_INVAL;
+  }
+  if (dart__unlikely(notify.unitid != team_data->unitid)) {
+    DART_LOG_ERROR("dart_notify ! "
+                   "Notification counter not located at the calling unit");
+    return DART_ERR_INVAL;
+  }
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                    &(team_data->segdata), notify.segid);
+  if (dart__unlikely(seginfo == NULL)) {
+    DART_LOG_ERROR("dart_notify ! "
+                   "Unknown segment %i on team %i", notify.segid,
+                   notify.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_unit_t myid = DART_TEAM_UNIT_ID(team_data->unitid);
+  MPI_Aint disp = notify.addr_or_offs.offset +
+                  dart_segment_disp(seginfo, myid);
+  CHECK_MPI_RET(
+    MPI_Fetch_and_op(
+      NULL, result, MPI_INT64_T, myid.id, disp, MPI_NO_OP, seginfo->win),
+    "MPI_Fetch_and_op");
+  CHECK_MPI_RET(MPI_Win_flush(myid.id, seginfo->win), "MPI_Win_flush");
+  // make the payload written before the update visible
+  CHECK_MPI_RET(MPI_Win_sync(seginfo->win), "MPI_Win_sync");
+  *comm = team_data->comm;
+  return DART_OK;
+}
+
+dart_ret_t dart_notify_wait(
+  dart_gptr_t       notify,
+  int64_t           value)
+{
+  DART_LOG_DEBUG("dart_notify_wait() segid:%d offset:%"PRIu64" value:%"PRId64,
+                 notify.segid, notify.addr_or_offs.offset, value);
+  while (1) {
+    MPI_Comm   comm;
+    int64_t    counter;
+    dart_ret_t ret = dart__mpi__notify_read(notify, &comm, &counter);
+    if (ret != DART_OK || counter >= value) {
+      DART_LOG_DEBUG("dart_notify_wait > finished");
+      return ret;
+    }
+    // trigger progress
+    int flag;
+    CHECK_MPI_RET(
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, comm, &flag, MPI_STATUS_IGNORE),
+      "MPI_Iprobe");
+  }
+}
+
+dart_ret_t dart_notify_test(
+  dart_gptr_t       notify,
+  int64_t           value,
+  int32_t         * flag)
+{
+  MPI_Comm comm;
+  int64_t  counter;
+  *flag = 0;
+  dart_ret_t ret = dart__mpi__notify_read(notify, &comm, &counter);
+  if (ret == DART_OK && counter >= value) {
+    *flag = 1;
+  }
+  DART_LOG_DEBUG("dart_notify_test > finished (flag:%d)", *flag);
+  return ret;
+}
+
 /* -- Dart RMA Synchronization Operations -- */
 
 dart_ret_t dart_flush(
@@ -1828,6 +2049,21 @@ dart_ret_t dart_handle_free(
 
 /* -- Dart collective operations -- */
 
+/**
+ * Allocate a handle for a non-blocking collective operation.
+ * Collective handles carry only MPI requests and never require a flush,
+ * so they can be completed by \c dart_wait, \c dart_test and the like.
+ */
+static inline dart_handle_t dart__mpi__coll_handle_alloc(void)
+{
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = DART_UNDEFINED_UNIT_ID;
+  handle->win          = MPI_WIN_NULL;
+  handle->needs_flush  = false;
+  handle->num_reqs     = 0;
+  return handle;
+}
+
 static int _dart_barrier_count = 0;
 
 dart_ret_t dart_barrier(
@@ -1856,6 +2092,38 @@ dart_ret_t dart_barrier(
   return DART_OK;
 }
 
+dart_ret_t dart_ibarrier(
+  dart_team_t     teamid,
+  dart_handle_t * handleptr)
+{
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  if (dart__unlikely(teamid == DART_UNDEFINED_TEAM_ID)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: team may not be DART_UNDEFINED_TEAM_ID");
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: Unknown team: %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc();
+  if (MPI_Ibarrier(team_data->comm, &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibarrier ! MPI_Ibarrier failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_DEBUG("dart_ibarrier > handle(%p) team:%d", (void*)handle, teamid);
+  return DART_OK;
+}
+
 dart_ret_t dart_bcast(
   void              * buf,
   size_t              nelem,
@@ -1902,6 +2170,75 @@ dart_ret_t dart_bcast(
   return DART_OK;
 }
 
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  // chunk up the bcast if necessary, requiring at most two requests
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc();
+
+  if (nchunks > 0) {
+    if (MPI_Ibcast(src_ptr, nchunks,
+                   dart__mpi__datatype_maxtype(dtype),
+                   root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    if (MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      // requests of preceding chunks cannot be cancelled
+      if (handle->num_reqs > 0) {
+        MPI_Waitall(handle->num_reqs, handle->reqs, MPI_STATUSES_IGNORE);
+      }
+      free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+  }
+
+  if (handle->num_reqs == 0) {
+    free(handle);
+    handle = DART_HANDLE_NULL;
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ibcast > handle(%p) root:%d team:%d nelem:%zu",
+                 (void*)handle, root.id, teamid, nelem);
+  return DART_OK;
+}
+
 dart_ret_t dart_scatter(
   const void        * sendbuf,
   void              * recvbuf,
@@ -2092,6 +2429,64 @@ dart_ret_t dart_allgather(
   return DART_OK;
 }
 
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid,
+  dart_handle_t   * handleptr)
+{
+  DART_LOG_TRACE("dart_iallgather() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  /*
+   * The receive buffer is laid out per unit, the transfer cannot be
+   * chunked. MPI uses offset type int, do not copy more than INT_MAX
+   * elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallgather ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallgather ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype  mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  dart_handle_t handle    = dart__mpi__coll_handle_alloc();
+  if (MPI_Iallgather(
+          sendbuf,
+          nelem,
+          mpi_dtype,
+          recvbuf,
+          nelem,
+          mpi_dtype,
+          team_data->comm,
+          &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallgather ! MPI_Iallgather failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_iallgather > handle(%p) team:%d nelem:%"PRIu64"",
+                 (void*)handle, teamid, nelem);
+  return DART_OK;
+}
+
 dart_ret_t dart_allgatherv(
   const void      * sendbuf,
   size_t            nsendelem,
@@ -2168,6 +2563,135 @@ dart_ret_t dart_allgatherv(
   return DART_OK;
 }
 
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoall() team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_alltoall ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  // a NULL send buffer is valid if no values are sent, only request an
+  // in-place exchange if send and receive buffer are identical:
+  if (sendbuf == recvbuf && NULL != sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  CHECK_MPI_RET(
+    MPI_Alltoall(
+        sendbuf,
+        nelem,
+        mpi_dtype,
+        recvbuf,
+        nelem,
+        mpi_dtype,
+        team_data->comm),
+    "MPI_Alltoall");
+
+  DART_LOG_TRACE("dart_alltoall > team:%d nelem:%"PRIu64"",
+                 teamid, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendcounts,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvcounts,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  // a NULL send buffer is valid if no values are sent, only request an
+  // in-place exchange if send and receive buffer are identical:
+  if (sendbuf == recvbuf && NULL != sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+  MPI_Comm comm      = team_data->comm;
+  int      comm_size = team_data->size;
+
+  // convert counts and displacements
+  int *insendcounts = malloc(sizeof(int) * comm_size);
+  int *isenddispls  = malloc(sizeof(int) * comm_size);
+  int *inrecvcounts = malloc(sizeof(int) * comm_size);
+  int *irecvdispls  = malloc(sizeof(int) * comm_size);
+  // send counts and displacements are ignored in an in-place exchange
+  bool in_place = (sendbuf == MPI_IN_PLACE);
+  for (int i = 0; i < comm_size; i++) {
+    size_t nsend = in_place ? 0 : nsendcounts[i];
+    size_t sdisp = in_place ? 0 : senddispls[i];
+    if (nsend          > MAX_CONTIG_ELEMENTS ||
+        sdisp          > MAX_CONTIG_ELEMENTS ||
+        nrecvcounts[i] > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i]  > MAX_CONTIG_ELEMENTS)
+    {
+      DART_LOG_ERROR(
+        "dart_alltoallv ! failed: counts or displacements of unit %i "
+        "exceed INT_MAX", i);
+      free(insendcounts);
+      free(isenddispls);
+      free(inrecvcounts);
+      free(irecvdispls);
+      return DART_ERR_INVAL;
+    }
+    insendcounts[i] = nsend;
+    isenddispls[i]  = sdisp;
+    inrecvcounts[i] = nrecvcounts[i];
+    irecvdispls[i]  = recvdispls[i];
+  }
+
+  dart_ret_t   ret       = DART_OK;
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  if (MPI_Alltoallv(
+           sendbuf,
+           insendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           inrecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    ret = DART_ERR_INVAL;
+  }
+  free(insendcounts);
+  free(isenddispls);
+  free(inrecvcounts);
+  free(irecvdispls);
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return ret;
+}
+
 dart_ret_t dart_allreduce(
   const void       * sendbuf,
   void             * recvbuf,
@@ -2208,6 +2732,111 @@ dart_ret_t dart_allreduce(
   return DART_OK;
 }
 
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handleptr)
+{
+  DART_LOG_TRACE("dart_iallreduce() team:%d nelem:%zu", team, nelem);
+
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  dart_handle_t handle = dart__mpi__coll_handle_alloc();
+  if (MPI_Iallreduce(
+          sendbuf,   // send buffer
+          recvbuf,   // receive buffer
+          nelem,     // buffer size
+          mpi_dtype, // datatype
+          mpi_op,    // reduce operation
+          team_data->comm,
+          &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallreduce ! MPI_Iallreduce failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_iallreduce > handle(%p) team:%d nelem:%zu",
+                 (void*)handle, team, nelem);
+  return DART_OK;
+}
+
+dart_ret_t dart_exscan(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team)
+{
+  DART_LOG_TRACE("dart_exscan() team:%d nelem:%zu", team, nelem);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_exscan ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_exscan ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Comm comm = team_data->comm;
+  CHECK_MPI_RET(
+    MPI_Exscan(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           comm),
+    "MPI_Exscan");
+
+  DART_LOG_TRACE("dart_exscan > team:%d nelem:%zu", team, nelem);
+  return DART_OK;
+}
+
 dart_ret_t dart_reduce(
   const void        * sendbuf,
   void              * recvbuf,
@@ -38,23 +38,23 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
 {
   int16_t segid = gptr.segid;
   uint64_t offset = gptr.addr_or_offs.offset;
-  dart_team_unit_t myid;
-  dart_team_myid(gptr.teamid, &myid);
 
   dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
-  if (team_data == NULL) {
+  if (dart__unlikely(team_data == NULL)) {
     DART_LOG_ERROR("dart_gptr_getaddr ! Unknown team %i", gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (myid.id == gptr.unitid) {
+  if (team_data->unitid == gptr.unitid) {
     if (segid != DART_SEGMENT_LOCAL) {
-      if (dart_segment_get_selfbaseptr(&team_data->segdata, segid, (char **)addr) != DART_OK) {
+      dart_segment_info_t *seginfo = dart_segment_get_info(
+                                       &(team_data->segdata), segid);
+      if (dart__unlikely(seginfo == NULL)) {
         DART_LOG_ERROR("dart_gptr_getaddr ! Unknown segment %i", segid);
         return DART_ERR_INVAL;
       }
 
-      *addr = offset + (char *)(*addr);
+      *addr = offset + seginfo->selfbaseptr;
     } else {
       *addr = offset + dart_mempool_localalloc;
     }
@@ -64,6 +64,45 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getaddr_shared(const dart_gptr_t gptr, void **addr)
+{
+  *addr = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown team %i", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (team_data->unitid == gptr.unitid) {
+    return dart_gptr_getaddr(gptr, addr);
+  }
+
+  if (gptr.unitid < 0 || gptr.unitid >= (dart_unit_t)team_data->size) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Invalid unit %i in team %i",
+                   gptr.unitid, gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+  if (gptr.segid >= 0 && luid.id >= 0) {
+    dart_segment_info_t *seginfo = dart_segment_get_info(
+                                     &(team_data->segdata), gptr.segid);
+    if (seginfo == NULL) {
+      DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown segment %i",
+                     gptr.segid);
+      return DART_ERR_INVAL;
+    }
+    if (seginfo->baseptr != NULL) {
+      *addr = seginfo->baseptr[luid.id] + gptr.addr_or_offs.offset;
+    }
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+  return DART_OK;
+}
+
 dart_ret_t dart_gptr_setaddr(dart_gptr_t* gptr, void* addr)
 {
   int16_t segid = gptr->segid;
@@ -132,30 +171,35 @@ dart_ret_t dart_memalloc(
   dart_myid(&unitid);
   gptr->unitid  = unitid.id;
   gptr->flags   = 0;
-  gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
-  gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
-  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
+  /* For local allocation, the segid is marked as '0' unless the
+   * pre-allocated pool is exhausted. */
+  if (dart__mpi__localpool_alloc(
+        nbytes, &gptr->segid, &gptr->addr_or_offs.offset) != DART_OK) {
     DART_LOG_ERROR("dart_memalloc: Out of bounds "
                    "(dart_buddy_alloc %zu bytes): global memory exhausted",
                    nbytes);
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
   }
-  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu offset:%"PRIu64"",
-                 nbytes, gptr->addr_or_offs.offset);
+  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu segid:%d "
+                 "offset:%"PRIu64"",
+                 nbytes, gptr->segid, gptr->addr_or_offs.offset);
   return DART_OK;
 }
 
 dart_ret_t dart_memfree (dart_gptr_t gptr)
 {
-  if (gptr.segid != DART_SEGMENT_LOCAL || gptr.teamid != DART_TEAM_ALL) {
+  if ((gptr.segid != DART_SEGMENT_LOCAL &&
+       gptr.segid != DART_SEGMENT_LOCAL_DYNAMIC) ||
+      gptr.teamid != DART_TEAM_ALL) {
     DART_LOG_ERROR("dart_memfree: invalid segment id:%d or team id:%d",
                    gptr.segid, gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  if (dart__mpi__localpool_free(
+        gptr.segid, gptr.addr_or_offs.offset) != DART_OK) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
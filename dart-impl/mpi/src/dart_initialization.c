@@ -18,10 +18,9 @@
 #include <dash/dart/mpi/dart_globmem_priv.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_locality_priv.h>
+#include <dash/dart/mpi/dart_progress_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
-#define DART_LOCAL_ALLOC_SIZE (1024*1024*16)
-
 /* Point to the base address of memory region for local allocation. */
 static int _init_by_dart = 0;
 static int _dart_initialized = 0;
@@ -29,7 +28,11 @@ static int _dart_initialized = 0;
 static
 dart_ret_t create_local_alloc(dart_team_data_t *team_data)
 {
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
+  size_t local_alloc_size = dart__mpi__localpool_size();
+  if (dart__mpi__localpool_init(local_alloc_size) != DART_OK) {
+    DART_LOG_ERROR("dart_init: Failed to create local allocation pool");
+    return DART_ERR_OTHER;
+  }
   MPI_Win dart_sharedmem_win_local_alloc;
   char* *dart_sharedmem_local_baseptr_set = NULL;
 
@@ -40,15 +43,15 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   MPI_Comm sharedmem_comm = team_data->sharedmem_comm;
 
   if (sharedmem_comm != MPI_COMM_NULL) {
-    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%d)",
-                   DART_LOCAL_ALLOC_SIZE);
+    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%zu)",
+                   local_alloc_size);
     MPI_Info win_info;
     MPI_Info_create(&win_info);
     MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
     /* Reserve a free shared memory block for non-collective
      * global memory allocation. */
     int ret = MPI_Win_allocate_shared(
-                DART_LOCAL_ALLOC_SIZE,
+                local_alloc_size,
                 sizeof(char),
                 win_info,
                 sharedmem_comm,
@@ -92,7 +95,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   }
 #else
   MPI_Alloc_mem(
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     MPI_INFO_NULL,
     &dart_mempool_localalloc);
 #endif
@@ -103,7 +106,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
    * Return in dart_win_local_alloc. */
   MPI_Win_create(
     dart_mempool_localalloc,
-    DART_LOCAL_ALLOC_SIZE,
+    local_alloc_size,
     sizeof(char),
     MPI_INFO_NULL,
     DART_COMM_WORLD,
@@ -121,7 +124,7 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
                                 &team_data->segdata, DART_SEGMENT_LOCAL_ALLOC);
   segment->flags       = 1;
   segment->segid       = 0;
-  segment->size        = DART_LOCAL_ALLOC_SIZE;
+  segment->size        = local_alloc_size;
   segment->baseptr     = dart_sharedmem_local_baseptr_set;
   segment->win         = dart_win_local_alloc;
   segment->shmwin      = dart_sharedmem_win_local_alloc;
@@ -190,6 +193,20 @@ dart_ret_t do_init()
    * collective allocation function through win. */
   MPI_Win_lock_all(0, win);
 
+  /* Local allocations exceeding the pre-allocated pool are served from
+   * memory attached to win. */
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                &team_data->segdata,
+                                DART_SEGMENT_LOCAL_DYNAMIC_ALLOC);
+  segment->flags       = 1;
+  segment->size        = 0;
+  segment->win         = win;
+  // offsets are absolute addresses at the target
+  segment->selfbaseptr = NULL;
+  segment->disp        = NULL;
+  segment->baseptr     = NULL;
+  segment->is_dynamic  = true;
+
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
   _dart_initialized = 1;
@@ -268,7 +285,11 @@ dart_ret_t dart_init_thread(
   DART_LOG_DEBUG("dart_init_thread >> thread support enabled: %s",
             (*provided == DART_THREAD_MULTIPLE) ? "yes" : "no");
 
-  return do_init();
+  dart_ret_t ret = do_init();
+  if (ret != DART_OK) {
+    return ret;
+  }
+  return dart__mpi__progress_init(thread_provided);
 }
 
 
@@ -281,6 +302,8 @@ dart_ret_t dart_exit()
   dart_global_unit_t unitid;
   dart_myid(&unitid);
 
+  dart__mpi__progress_fini();
+
   dart__mpi__locality_finalize();
 
   _dart_initialized = 0;
@@ -317,10 +340,10 @@ dart_ret_t dart_exit()
     MPI_Free_mem(dart_mempool_localalloc);
   }
 #endif
+  dart__mpi__localpool_fini();
   MPI_Win_free(&team_data->window);
 
   dart_segment_fini(&team_data->segdata);
-  dart_buddy_delete(dart_localpool);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 //  free(team_data->sharedmem_tab);
 //  free(dart_sharedmem_local_baseptr_set);
@@ -10,9 +10,16 @@
  *
  */
 
+#include <dash/dart/if/dart_globmem.h>
+#include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/mpi/dart_mem.h>
+#include <dash/dart/mpi/dart_segment.h>
+#include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/base/mutex.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/logging.h>
+
+#include <mpi.h>
 
 /* For PRIu64, uint64_t in printf */
 #define __STDC_FORMAT_MACROS
@@ -311,3 +318,373 @@ void buddy_dump(struct dart_buddy * self) {
 	_dump(self, 0, 0);
 	printf("\n");
 }
+
+
+/*
+ * Allocator of dart_memalloc on top of the buddy allocator.
+ *
+ * Allocations of up to DART_MEM_MAX_CACHED bytes are rounded up to a
+ * power of 2 size class and served from slabs of DART_MEM_SLAB_SIZE bytes
+ * in the pre-allocated pool. Every thread keeps a cache of free blocks per
+ * size class that is refilled from and flushed to the shared free lists in
+ * batches, so the common case does not require the pool's mutex.
+ * Free lists are kept outside of the pool, freed blocks are never written.
+ *
+ * If the pre-allocated pool is exhausted, chunks of memory are allocated
+ * and attached to the dynamic window of DART_TEAM_ALL. Allocations in
+ * these chunks use segment DART_SEGMENT_LOCAL_DYNAMIC.
+ */
+
+#define DART_MEM_SLAB_SIZE        4096
+#define DART_MEM_NUM_CLASSES      6
+#define DART_MEM_MAX_CACHED       (DART_MEM_ALIGN_BYTES << (DART_MEM_NUM_CLASSES - 1))
+#define DART_MEM_CACHE_MAX_BLOCKS 64
+#define DART_MEM_CACHE_BATCH      32
+#define DART_MEM_MAX_POOL_SIZE    ((size_t)1 << 30)
+
+#ifdef DART_ENABLE_THREADSUPPORT
+#define DART_MEM_THREADLOCAL __thread
+#else
+#define DART_MEM_THREADLOCAL
+#endif
+
+struct dart_localpool_chunk {
+  struct dart_localpool_chunk * next;
+  char                        * base;
+  /* address of base used as target displacement in the dynamic window */
+  uint64_t                      disp;
+  size_t                        size;
+  struct dart_buddy           * buddy;
+};
+
+struct dart_localpool_cache {
+  /* generation of the pool the cached blocks belong to */
+  unsigned int generation;
+  int          count[DART_MEM_NUM_CLASSES];
+  uint64_t     blocks[DART_MEM_NUM_CLASSES][DART_MEM_CACHE_MAX_BLOCKS];
+};
+
+struct dart_localpool_freelist {
+  uint64_t   * blocks;
+  size_t       count;
+  size_t       capacity;
+};
+
+static size_t                        localpool_size       = 0;
+/* size class + 1 of every slab in the pool, 0 if not part of a slab */
+static uint8_t                     * localpool_slab_class = NULL;
+static struct dart_localpool_freelist localpool_freelist[DART_MEM_NUM_CLASSES];
+static struct dart_localpool_chunk * localpool_chunks     = NULL;
+static unsigned int                  localpool_generation = 0;
+static dart_mutex_t                  localpool_mutex      = DART_MUTEX_INITIALIZER;
+
+static DART_MEM_THREADLOCAL struct dart_localpool_cache localpool_cache;
+
+static inline int
+size_class(size_t nbytes)
+{
+  int c = 0;
+  while (((size_t)DART_MEM_ALIGN_BYTES << c) < nbytes) {
+    c++;
+  }
+  return c;
+}
+
+static inline struct dart_localpool_cache *
+thread_cache()
+{
+  struct dart_localpool_cache * cache = &localpool_cache;
+  if (dart__unlikely(cache->generation != localpool_generation)) {
+    // blocks cached for a previous pool are invalid
+    for (int c = 0; c < DART_MEM_NUM_CLASSES; c++) {
+      cache->count[c] = 0;
+    }
+    cache->generation = localpool_generation;
+  }
+  return cache;
+}
+
+/* requires localpool_mutex */
+static int
+cache_refill(struct dart_localpool_cache * cache, int c)
+{
+  struct dart_localpool_freelist * freelist = &localpool_freelist[c];
+  if (freelist->count == 0) {
+    size_t slab = dart_buddy_alloc(dart_localpool, DART_MEM_SLAB_SIZE);
+    if (slab == (size_t)(-1)) {
+      return 0;
+    }
+    size_t bsize   = (size_t)DART_MEM_ALIGN_BYTES << c;
+    size_t nblocks = DART_MEM_SLAB_SIZE / bsize;
+    if (freelist->capacity < nblocks) {
+      uint64_t *blocks = realloc(freelist->blocks, nblocks * sizeof(uint64_t));
+      if (blocks == NULL) {
+        dart_buddy_free(dart_localpool, slab);
+        return 0;
+      }
+      freelist->blocks   = blocks;
+      freelist->capacity = nblocks;
+    }
+    localpool_slab_class[slab / DART_MEM_SLAB_SIZE] = (uint8_t)(c + 1);
+    // lowest offsets are handed out first
+    for (size_t b = 0; b < nblocks; b++) {
+      freelist->blocks[b] = slab + (nblocks - b - 1) * bsize;
+    }
+    freelist->count = nblocks;
+  }
+  int n = 0;
+  while (n < DART_MEM_CACHE_BATCH && freelist->count > 0) {
+    cache->blocks[c][cache->count[c]++] = freelist->blocks[--freelist->count];
+    n++;
+  }
+  return n;
+}
+
+/* requires localpool_mutex */
+static void
+cache_flush(struct dart_localpool_cache * cache, int c, int nblocks)
+{
+  struct dart_localpool_freelist * freelist = &localpool_freelist[c];
+  if (freelist->count + nblocks > freelist->capacity) {
+    size_t    capacity = 2 * (freelist->count + nblocks);
+    uint64_t *blocks   = realloc(freelist->blocks,
+                                 capacity * sizeof(uint64_t));
+    if (blocks == NULL) {
+      // keep the blocks in the cache
+      return;
+    }
+    freelist->blocks   = blocks;
+    freelist->capacity = capacity;
+  }
+  while (nblocks-- > 0 && cache->count[c] > 0) {
+    freelist->blocks[freelist->count++] = cache->blocks[c][--cache->count[c]];
+  }
+}
+
+/* requires localpool_mutex */
+static struct dart_localpool_chunk *
+localpool_grow(size_t nbytes)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  if (team_data == NULL) {
+    return NULL;
+  }
+
+  size_t size = localpool_size;
+  while (size < nbytes) {
+    size <<= 1;
+  }
+  if (size > DART_MEM_MAX_POOL_SIZE) {
+    DART_LOG_ERROR("dart_memalloc: allocation of %zu bytes exceeds the "
+                   "maximum chunk size", nbytes);
+    return NULL;
+  }
+
+  char *base;
+  if (MPI_Alloc_mem(size, MPI_INFO_NULL, &base) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memalloc: MPI_Alloc_mem failed for %zu bytes", size);
+    return NULL;
+  }
+  if (MPI_Win_attach(team_data->window, base, size) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_memalloc: MPI_Win_attach failed");
+    MPI_Free_mem(base);
+    return NULL;
+  }
+
+  MPI_Aint disp;
+  MPI_Get_address(base, &disp);
+
+  struct dart_localpool_chunk *chunk = malloc(sizeof(*chunk));
+  chunk->base      = base;
+  chunk->disp      = (uint64_t)disp;
+  chunk->size      = size;
+  chunk->buddy     = dart_buddy_new(size);
+  chunk->next      = localpool_chunks;
+  localpool_chunks = chunk;
+
+  DART_LOG_DEBUG("dart_memalloc: attached chunk of %zu bytes at %p",
+                 size, base);
+  return chunk;
+}
+
+static dart_ret_t
+localpool_alloc_dynamic(size_t nbytes, uint64_t *offset)
+{
+  size_t chunk_offset = (size_t)(-1);
+  dart__base__mutex_lock(&localpool_mutex);
+  struct dart_localpool_chunk *chunk = localpool_chunks;
+  while (chunk != NULL) {
+    chunk_offset = dart_buddy_alloc(chunk->buddy, nbytes);
+    if (chunk_offset != (size_t)(-1)) {
+      break;
+    }
+    chunk = chunk->next;
+  }
+  if (chunk == NULL) {
+    chunk = localpool_grow(nbytes);
+    if (chunk != NULL) {
+      chunk_offset = dart_buddy_alloc(chunk->buddy, nbytes);
+    }
+  }
+  dart__base__mutex_unlock(&localpool_mutex);
+  if (chunk == NULL || chunk_offset == (size_t)(-1)) {
+    return DART_ERR_OTHER;
+  }
+  *offset = chunk->disp + chunk_offset;
+  return DART_OK;
+}
+
+size_t dart__mpi__localpool_size()
+{
+  size_t size = DART_LOCAL_ALLOC_SIZE_DEFAULT;
+  const char *envstr = getenv(DART_LOCAL_ALLOC_SIZE_ENVSTR);
+  if (envstr != NULL) {
+    char *end;
+    unsigned long long value = strtoull(envstr, &end, 10);
+    switch (*end) {
+      case 'G': case 'g': value <<= 10; /* fall-through */
+      case 'M': case 'm': value <<= 10; /* fall-through */
+      case 'K': case 'k': value <<= 10; break;
+      default: break;
+    }
+    if (value == 0) {
+      DART_LOG_WARN("Ignoring invalid value of %s: %s",
+                    DART_LOCAL_ALLOC_SIZE_ENVSTR, envstr);
+    } else {
+      size = (size_t)value;
+    }
+  }
+  if (size < DART_MEM_SLAB_SIZE) {
+    size = DART_MEM_SLAB_SIZE;
+  }
+  if (size > DART_MEM_MAX_POOL_SIZE) {
+    DART_LOG_WARN("Limiting size of the local allocation pool to %zu bytes",
+                  DART_MEM_MAX_POOL_SIZE);
+    size = DART_MEM_MAX_POOL_SIZE;
+  }
+  return next_pow_of_2(size);
+}
+
+dart_ret_t dart__mpi__localpool_init(size_t size)
+{
+  DART_ASSERT(is_pow_of_2(size) && size >= DART_MEM_SLAB_SIZE);
+  dart_localpool = dart_buddy_new(size);
+  if (dart_localpool == NULL) {
+    return DART_ERR_OTHER;
+  }
+  localpool_size       = size;
+  localpool_slab_class = calloc(size / DART_MEM_SLAB_SIZE, sizeof(uint8_t));
+  localpool_chunks     = NULL;
+  for (int c = 0; c < DART_MEM_NUM_CLASSES; c++) {
+    localpool_freelist[c].blocks   = NULL;
+    localpool_freelist[c].count    = 0;
+    localpool_freelist[c].capacity = 0;
+  }
+  dart__base__mutex_init(&localpool_mutex);
+  // invalidate blocks cached by threads for a previous pool
+  localpool_generation++;
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__localpool_fini()
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  while (localpool_chunks != NULL) {
+    struct dart_localpool_chunk *chunk = localpool_chunks;
+    localpool_chunks = chunk->next;
+    if (team_data != NULL) {
+      MPI_Win_detach(team_data->window, chunk->base);
+    }
+    MPI_Free_mem(chunk->base);
+    dart_buddy_delete(chunk->buddy);
+    free(chunk);
+  }
+  dart_buddy_delete(dart_localpool);
+  dart_localpool = NULL;
+  free(localpool_slab_class);
+  localpool_slab_class = NULL;
+  for (int c = 0; c < DART_MEM_NUM_CLASSES; c++) {
+    free(localpool_freelist[c].blocks);
+    localpool_freelist[c].blocks = NULL;
+  }
+  localpool_generation++;
+  dart__base__mutex_destroy(&localpool_mutex);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__localpool_alloc(
+  size_t     nbytes,
+  int16_t  * segid,
+  uint64_t * offset)
+{
+  *segid = DART_SEGMENT_LOCAL;
+  if (nbytes <= DART_MEM_MAX_CACHED) {
+    int c = size_class(nbytes);
+    struct dart_localpool_cache *cache = thread_cache();
+    if (cache->count[c] == 0) {
+      dart__base__mutex_lock(&localpool_mutex);
+      cache_refill(cache, c);
+      dart__base__mutex_unlock(&localpool_mutex);
+    }
+    if (cache->count[c] > 0) {
+      *offset = cache->blocks[c][--cache->count[c]];
+      return DART_OK;
+    }
+  }
+
+  size_t pool_offset = dart_buddy_alloc(dart_localpool, nbytes);
+  if (pool_offset != (size_t)(-1)) {
+    *offset = pool_offset;
+    return DART_OK;
+  }
+
+  // pre-allocated pool exhausted
+  *segid = DART_SEGMENT_LOCAL_DYNAMIC;
+  return localpool_alloc_dynamic(nbytes, offset);
+}
+
+dart_ret_t dart__mpi__localpool_free(
+  int16_t    segid,
+  uint64_t   offset)
+{
+  if (segid == DART_SEGMENT_LOCAL) {
+    if (offset >= localpool_size) {
+      return DART_ERR_INVAL;
+    }
+    uint8_t slab_class = localpool_slab_class[offset / DART_MEM_SLAB_SIZE];
+    if (slab_class == 0) {
+      return (dart_buddy_free(dart_localpool, offset) == -1)
+             ? DART_ERR_INVAL : DART_OK;
+    }
+    int c = slab_class - 1;
+    struct dart_localpool_cache *cache = thread_cache();
+    if (cache->count[c] == DART_MEM_CACHE_MAX_BLOCKS) {
+      dart__base__mutex_lock(&localpool_mutex);
+      cache_flush(cache, c, DART_MEM_CACHE_BATCH);
+      dart__base__mutex_unlock(&localpool_mutex);
+      if (cache->count[c] == DART_MEM_CACHE_MAX_BLOCKS) {
+        return DART_ERR_OTHER;
+      }
+    }
+    cache->blocks[c][cache->count[c]++] = offset;
+    return DART_OK;
+  }
+
+  if (segid == DART_SEGMENT_LOCAL_DYNAMIC) {
+    dart_ret_t ret = DART_ERR_INVAL;
+    dart__base__mutex_lock(&localpool_mutex);
+    for (struct dart_localpool_chunk *chunk = localpool_chunks;
+         chunk != NULL; chunk = chunk->next) {
+      if (offset >= chunk->disp && offset < chunk->disp + chunk->size) {
+        if (dart_buddy_free(chunk->buddy, offset - chunk->disp) != -1) {
+          ret = DART_OK;
+        }
+        break;
+      }
+    }
+    dart__base__mutex_unlock(&localpool_mutex);
+    return ret;
+  }
+
+  return DART_ERR_INVAL;
+}
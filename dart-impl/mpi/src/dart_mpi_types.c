@@ -3,12 +3,13 @@
  *
  * Provide functionality for creating derived data types in DART.
  *
- * Currently implemented: strided types based on basic types.
+ * Currently implemented: strided and indexed types based on basic types.
  */
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_initialization.h>
 #include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
 #include <dash/dart/mpi/dart_communication_priv.h>
 
 #include <stdlib.h>
@@ -172,6 +173,8 @@ dart_type_create_strided(
   new_struct->kind             = DART_KIND_STRIDED;
   new_struct->num_elem         = blocklen;
   new_struct->strided.stride   = stride;
+  new_struct->strided.num_cached = 0;
+  dart__base__mutex_init(&new_struct->strided.mutex);
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -186,22 +189,57 @@ dart__mpi__create_strided_mpi(
   dart_datatype_t dart_type,
   size_t          num_blocks)
 {
-  MPI_Datatype new_mpi_dtype;
+  MPI_Datatype new_mpi_dtype = MPI_DATATYPE_NULL;
   dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
-  MPI_Type_vector(
-    num_blocks,             // the number of blocks
-    dts->num_elem,          // the number of elements per block
-    dts->strided.stride,    // the number of elements between start of each block
-    dart__mpi__datatype_struct(dts->base_type)->contiguous.mpi_type,
-    &new_mpi_dtype);
-  MPI_Type_commit(&new_mpi_dtype);
+
+  dart__base__mutex_lock(&dts->strided.mutex);
+  for (int i = 0; i < dts->strided.num_cached; ++i) {
+    if (dts->strided.cached_blocks[i] == num_blocks) {
+      new_mpi_dtype = dts->strided.cached_types[i];
+      break;
+    }
+  }
+  if (new_mpi_dtype == MPI_DATATYPE_NULL) {
+    MPI_Type_vector(
+      num_blocks,             // the number of blocks
+      dts->num_elem,          // the number of elements per block
+      dts->strided.stride,    // the number of elements between start of each block
+      dart__mpi__datatype_struct(dts->base_type)->contiguous.mpi_type,
+      &new_mpi_dtype);
+    MPI_Type_commit(&new_mpi_dtype);
+    if (dts->strided.num_cached < DART_MPI_STRIDED_CACHE_SIZE) {
+      int idx = dts->strided.num_cached++;
+      dts->strided.cached_blocks[idx] = num_blocks;
+      dts->strided.cached_types[idx]  = new_mpi_dtype;
+      DART_LOG_TRACE("Cached MPI vector type for %zu blocks of type %p",
+                     num_blocks, dts);
+    }
+  }
+  dart__base__mutex_unlock(&dts->strided.mutex);
   return new_mpi_dtype;
 }
 
 void
-dart__mpi__destroy_strided_mpi(MPI_Datatype *mpi_type)
+dart__mpi__destroy_strided_mpi(
+  dart_datatype_t   dart_type,
+  MPI_Datatype    * mpi_type)
 {
-  MPI_Type_free(mpi_type);
+  bool is_cached = false;
+  dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
+
+  dart__base__mutex_lock(&dts->strided.mutex);
+  for (int i = 0; i < dts->strided.num_cached; ++i) {
+    if (dts->strided.cached_types[i] == *mpi_type) {
+      is_cached = true;
+      break;
+    }
+  }
+  dart__base__mutex_unlock(&dts->strided.mutex);
+
+  if (!is_cached) {
+    // the cache was full when this type was created
+    MPI_Type_free(mpi_type);
+  }
 }
 
 dart_ret_t
@@ -341,6 +379,12 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
     free(dart_type->indexed.offsets);
     dart_type->indexed.offsets   = NULL;
     MPI_Type_free(&dart_type->indexed.mpi_type);
+  } else if (dart_type->kind == DART_KIND_STRIDED) {
+    for (int i = 0; i < dart_type->strided.num_cached; ++i) {
+      MPI_Type_free(&dart_type->strided.cached_types[i]);
+    }
+    dart_type->strided.num_cached = 0;
+    dart__base__mutex_destroy(&dart_type->strided.mutex);
   } else if (dart_type->kind == DART_KIND_CUSTOM) {
     MPI_Type_free(&dart_type->contiguous.mpi_type);
     if (dart_type->contiguous.max_type != DART_MPI_TYPE_UNDEFINED) {
@@ -354,6 +398,210 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
   return DART_OK;
 }
 
+/**
+ * Cursor over the contiguous byte ranges covered by \c nelem elements
+ * laid out according to a DART type.
+ */
+typedef struct {
+  const dart_datatype_struct_t * dts;
+  /// base pointer of the buffer, only used to compute offsets
+  const char                   * base;
+  /// size of a single element in bytes
+  size_t                         elem_size;
+  /// extent of a single instance of an indexed type in elements
+  size_t                         extent;
+  /// the overall number of blocks to traverse
+  size_t                         num_blocks;
+  /// the index of the next block
+  size_t                         next_block;
+  /// start of the remaining bytes in the current block
+  const char                   * pos;
+  /// the number of remaining bytes in the current block
+  size_t                         left;
+} dart_type_cursor_t;
+
+static size_t
+type_cursor_init(
+  dart_type_cursor_t * cursor,
+  dart_datatype_t      dart_type,
+  const void         * base,
+  size_t               nelem)
+{
+  const dart_datatype_struct_t *dts = dart__mpi__datatype_struct(dart_type);
+  cursor->dts        = dts;
+  cursor->base       = (const char *)base;
+  cursor->extent     = 0;
+  cursor->next_block = 0;
+  cursor->pos        = cursor->base;
+  cursor->left       = 0;
+
+  switch (dts->kind) {
+    case DART_KIND_BASIC:  /* fall-through */
+    case DART_KIND_CUSTOM:
+      cursor->elem_size  = dts->contiguous.size;
+      cursor->num_blocks = 1;
+      break;
+    case DART_KIND_STRIDED:
+      cursor->elem_size  = dart__mpi__datatype_sizeof(dts->base_type);
+      cursor->num_blocks = nelem / dts->num_elem;
+      break;
+    case DART_KIND_INDEXED: {
+      // consecutive instances are placed at multiples of the MPI extent
+      int lb = INT_MAX, ub = 0;
+      for (int b = 0; b < dts->indexed.num_blocks; ++b) {
+        if (dts->indexed.blocklens[b] == 0) continue;
+        int start = dts->indexed.offsets[b];
+        int end   = start + dts->indexed.blocklens[b];
+        if (start < lb) lb = start;
+        if (end   > ub) ub = end;
+      }
+      cursor->extent     = (ub > lb) ? (size_t)(ub - lb) : 0;
+      cursor->elem_size  = dart__mpi__datatype_sizeof(dts->base_type);
+      cursor->num_blocks = (nelem / dts->num_elem) * dts->indexed.num_blocks;
+      break;
+    }
+    default:
+      DART_ASSERT_MSG(NULL, "Unknown DART type detected!");
+  }
+  return nelem * cursor->elem_size;
+}
+
+/**
+ * Advances the cursor to the next non-empty block.
+ * Returns \c false if all blocks have been traversed.
+ */
+static bool
+type_cursor_next(dart_type_cursor_t * cursor, size_t nelem)
+{
+  const dart_datatype_struct_t *dts = cursor->dts;
+  while (cursor->next_block < cursor->num_blocks) {
+    size_t block = cursor->next_block++;
+    size_t start, len;
+    switch (dts->kind) {
+      case DART_KIND_STRIDED:
+        start = block * dts->strided.stride;
+        len   = dts->num_elem;
+        break;
+      case DART_KIND_INDEXED: {
+        size_t inst = block / dts->indexed.num_blocks;
+        size_t b    = block % dts->indexed.num_blocks;
+        start = inst * cursor->extent + dts->indexed.offsets[b];
+        len   = dts->indexed.blocklens[b];
+        break;
+      }
+      default:
+        start = 0;
+        len   = nelem;
+    }
+    if (len > 0) {
+      cursor->pos  = cursor->base + start * cursor->elem_size;
+      cursor->left = len * cursor->elem_size;
+      return true;
+    }
+  }
+  return false;
+}
+
+static inline void
+copy_block(char * dst, const char * src, size_t nbytes)
+{
+  // let the compiler inline copies of single elements
+  switch (nbytes) {
+    case 4:  memcpy(dst, src, 4);  break;
+    case 8:  memcpy(dst, src, 8);  break;
+    case 16: memcpy(dst, src, 16); break;
+    default: memcpy(dst, src, nbytes);
+  }
+}
+
+/**
+ * Copies between strided and contiguous layouts with equal block lengths,
+ * the common case of column halos and sub-matrix transfers.
+ */
+static bool
+copy_strided(
+  char                         * dst,
+  const dart_datatype_struct_t * dst_dts,
+  const char                   * src,
+  const dart_datatype_struct_t * src_dts,
+  size_t                         nelem,
+  size_t                         elem_size)
+{
+  bool src_strided = (src_dts->kind == DART_KIND_STRIDED);
+  bool dst_strided = (dst_dts->kind == DART_KIND_STRIDED);
+  size_t blocklen  = src_strided ? src_dts->num_elem : dst_dts->num_elem;
+
+  if (src_strided && dst_strided && src_dts->num_elem != dst_dts->num_elem) {
+    return false;
+  }
+
+  size_t nbytes     = blocklen * elem_size;
+  size_t src_stride = src_strided ? src_dts->strided.stride * elem_size
+                                  : nbytes;
+  size_t dst_stride = dst_strided ? dst_dts->strided.stride * elem_size
+                                  : nbytes;
+  size_t num_blocks = nelem / blocklen;
+
+  for (size_t i = 0; i < num_blocks; ++i) {
+    copy_block(dst, src, nbytes);
+    src += src_stride;
+    dst += dst_stride;
+  }
+  return true;
+}
+
+dart_ret_t
+dart__mpi__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem)
+{
+  dart_type_cursor_t src_cursor, dst_cursor;
+  size_t src_nbytes = type_cursor_init(&src_cursor, src_type, src, nelem);
+  size_t dst_nbytes = type_cursor_init(&dst_cursor, dst_type, dst, nelem);
+
+  if (src_nbytes != dst_nbytes) {
+    DART_LOG_ERROR("dart__mpi__datatype_copy ! "
+                   "Type sizes do not match (%zu vs %zu bytes)",
+                   src_nbytes, dst_nbytes);
+    return DART_ERR_INVAL;
+  }
+
+  if (src_nbytes == 0) {
+    return DART_OK;
+  }
+
+  if (src_cursor.dts->kind != DART_KIND_INDEXED &&
+      dst_cursor.dts->kind != DART_KIND_INDEXED &&
+      src_cursor.elem_size == dst_cursor.elem_size &&
+      copy_strided(dst, dst_cursor.dts, src, src_cursor.dts,
+                   nelem, src_cursor.elem_size)) {
+    return DART_OK;
+  }
+
+  if (!type_cursor_next(&src_cursor, nelem) ||
+      !type_cursor_next(&dst_cursor, nelem)) {
+    return DART_OK;
+  }
+  while (true) {
+    size_t nbytes = (src_cursor.left < dst_cursor.left) ? src_cursor.left
+                                                        : dst_cursor.left;
+    // the destination cursor only tracks offsets into the mutable buffer
+    char * dst_pos = (char *)dst + (dst_cursor.pos - dst_cursor.base);
+    copy_block(dst_pos, src_cursor.pos, nbytes);
+    src_cursor.pos  += nbytes;
+    src_cursor.left -= nbytes;
+    dst_cursor.pos  += nbytes;
+    dst_cursor.left -= nbytes;
+    if (src_cursor.left == 0 && !type_cursor_next(&src_cursor, nelem)) break;
+    if (dst_cursor.left == 0 && !type_cursor_next(&dst_cursor, nelem)) break;
+  }
+
+  return DART_OK;
+}
+
 static void destroy_basic_type(dart_datatype_t dart_type_id)
 {
   dart_datatype_struct_t *dart_type = dart__mpi__datatype_struct(dart_type_id);
@@ -0,0 +1,238 @@
+/**
+ * \file dart_progress.c
+ *
+ * Optional progress thread of the DART-MPI library.
+ *
+ * Non-blocking RMA operations and collectives only make progress when the
+ * application calls into MPI. If enabled, a thread polls the MPI progress
+ * engine in the background so that communication overlaps with
+ * computation.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <dash/dart/mpi/dart_progress_priv.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_locality.h>
+#include <dash/dart/if/dart_team_group.h>
+
+#include <dash/dart/mpi/dart_team_private.h>
+
+#include <dash/dart/base/logging.h>
+
+#include <mpi.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+bool dart__mpi__progress_requested()
+{
+  const char *envstr = getenv(DART_PROGRESS_THREAD_ENVSTR);
+  if (envstr == NULL) {
+    return false;
+  }
+  return (strcmp(envstr, "1") == 0       ||
+          strcasecmp(envstr, "on") == 0   ||
+          strcasecmp(envstr, "yes") == 0  ||
+          strcasecmp(envstr, "true") == 0);
+}
+
+long dart__mpi__progress_interval()
+{
+  const char *envstr = getenv(DART_PROGRESS_INTERVAL_ENVSTR);
+  if (envstr != NULL) {
+    char *end;
+    long value = strtol(envstr, &end, 10);
+    if (*end == '\0' && value >= 0) {
+      return value;
+    }
+    DART_LOG_WARN("Ignoring invalid value of %s: %s",
+                  DART_PROGRESS_INTERVAL_ENVSTR, envstr);
+  }
+  return DART_PROGRESS_INTERVAL_DEFAULT;
+}
+
+#if defined(DART_ENABLE_THREADSUPPORT)
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+static pthread_t     progress_thread;
+static bool          progress_running = false;
+static MPI_Comm      progress_comm    = MPI_COMM_NULL;
+static long          progress_interval_us;
+
+/**
+ * Determines the CPU to pin the progress thread of the calling unit to.
+ *
+ * Units on the same node are identified by their host name in the unit
+ * locality information, the CPUs they are running on are considered
+ * occupied. The progress threads of the units on a node are distributed
+ * over the unoccupied CPUs, starting at the highest CPU. If there are no
+ * unoccupied CPUs, the progress thread shares the CPU of its unit.
+ *
+ * \return The CPU to pin the progress thread to or -1 if the locality
+ *         information is not sufficient.
+ */
+static int progress_cpu()
+{
+  dart_team_data_t     *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  dart_unit_locality_t *myloc;
+  if (team_data == NULL ||
+      dart_unit_locality(
+        DART_TEAM_ALL, DART_TEAM_UNIT_ID(team_data->unitid), &myloc)
+      != DART_OK) {
+    return -1;
+  }
+
+  int num_cpus = myloc->hwinfo.num_cores;
+  if (myloc->hwinfo.max_threads > 1) {
+    num_cpus *= myloc->hwinfo.max_threads;
+  }
+  if (num_cpus <= 0 || myloc->hwinfo.cpu_id < 0) {
+    return -1;
+  }
+  if (num_cpus > CPU_SETSIZE) {
+    num_cpus = CPU_SETSIZE;
+  }
+
+  cpu_set_t occupied;
+  CPU_ZERO(&occupied);
+  int local_index = 0;
+  for (int u = 0; u < team_data->size; ++u) {
+    dart_unit_locality_t *loc;
+    if (dart_unit_locality(DART_TEAM_ALL, DART_TEAM_UNIT_ID(u), &loc)
+        != DART_OK) {
+      return -1;
+    }
+    if (strncmp(loc->hwinfo.host, myloc->hwinfo.host,
+                DART_LOCALITY_HOST_MAX_SIZE) == 0) {
+      if (u < team_data->unitid) {
+        ++local_index;
+      }
+      if (loc->hwinfo.cpu_id >= 0 && loc->hwinfo.cpu_id < num_cpus) {
+        CPU_SET(loc->hwinfo.cpu_id, &occupied);
+      }
+    }
+  }
+
+  int num_free_cpus = num_cpus - CPU_COUNT(&occupied);
+  if (num_free_cpus <= 0) {
+    return myloc->hwinfo.cpu_id;
+  }
+  int free_index = local_index % num_free_cpus;
+  for (int cpu = num_cpus - 1; cpu >= 0; --cpu) {
+    if (!CPU_ISSET(cpu, &occupied) && free_index-- == 0) {
+      return cpu;
+    }
+  }
+  return myloc->hwinfo.cpu_id;
+}
+
+static void * progress_loop(void *arg)
+{
+  (void)arg;
+  struct timespec interval;
+  interval.tv_sec  = progress_interval_us / 1000000;
+  interval.tv_nsec = (progress_interval_us % 1000000) * 1000;
+
+  while (__atomic_load_n(&progress_running, __ATOMIC_ACQUIRE)) {
+    // any call into MPI drives the progress engine of all communicators
+    int flag;
+    MPI_Iprobe(
+      MPI_ANY_SOURCE, MPI_ANY_TAG, progress_comm, &flag, MPI_STATUS_IGNORE);
+    if (progress_interval_us > 0) {
+      nanosleep(&interval, NULL);
+    } else {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+dart_ret_t dart__mpi__progress_init(int thread_provided)
+{
+  if (!dart__mpi__progress_requested()) {
+    return DART_OK;
+  }
+  if (thread_provided != MPI_THREAD_MULTIPLE) {
+    DART_LOG_WARN("dart__mpi__progress_init: progress thread requested but "
+                  "MPI does not provide MPI_THREAD_MULTIPLE");
+    return DART_OK;
+  }
+
+  if (MPI_Comm_dup(MPI_COMM_WORLD, &progress_comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__progress_init ! MPI_Comm_dup failed");
+    return DART_ERR_OTHER;
+  }
+  progress_interval_us = dart__mpi__progress_interval();
+  __atomic_store_n(&progress_running, true, __ATOMIC_RELEASE);
+
+  if (pthread_create(&progress_thread, NULL, &progress_loop, NULL) != 0) {
+    DART_LOG_ERROR("dart__mpi__progress_init ! pthread_create failed");
+    __atomic_store_n(&progress_running, false, __ATOMIC_RELEASE);
+    MPI_Comm_free(&progress_comm);
+    return DART_ERR_OTHER;
+  }
+
+  int cpu = progress_cpu();
+  if (cpu >= 0) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    if (pthread_setaffinity_np(progress_thread, sizeof(cpuset), &cpuset)
+        != 0) {
+      DART_LOG_WARN("dart__mpi__progress_init: "
+                    "failed to pin progress thread to CPU %d", cpu);
+    }
+  }
+  DART_LOG_DEBUG("dart__mpi__progress_init: progress thread started "
+                 "(cpu:%d interval:%ldus)", cpu, progress_interval_us);
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__progress_fini()
+{
+  if (!__atomic_load_n(&progress_running, __ATOMIC_ACQUIRE)) {
+    return DART_OK;
+  }
+  __atomic_store_n(&progress_running, false, __ATOMIC_RELEASE);
+  pthread_join(progress_thread, NULL);
+  MPI_Comm_free(&progress_comm);
+  DART_LOG_DEBUG("dart__mpi__progress_fini: progress thread stopped");
+  return DART_OK;
+}
+
+bool dart__mpi__progress_running()
+{
+  return __atomic_load_n(&progress_running, __ATOMIC_ACQUIRE);
+}
+
+#else // DART_ENABLE_THREADSUPPORT
+
+dart_ret_t dart__mpi__progress_init(int thread_provided)
+{
+  (void)thread_provided;
+  if (dart__mpi__progress_requested()) {
+    DART_LOG_WARN("dart__mpi__progress_init: progress thread requested but "
+                  "DART has been built without thread support");
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__progress_fini()
+{
+  return DART_OK;
+}
+
+bool dart__mpi__progress_running()
+{
+  return false;
+}
+
+#endif // DART_ENABLE_THREADSUPPORT
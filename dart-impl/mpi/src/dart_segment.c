@@ -10,69 +10,51 @@
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
+struct dart_segment_elem {
   dart_segment_info_t  data;
+  dart_segment_elem_t *next;
 };
 
-
-static inline int hash_segid(dart_segid_t segid)
-{
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
-}
-
-static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
-{
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
-}
-
-static dart_segment_info_t * get_segment(
+/**
+ * Returns the slot of the segment \c segid in the segment table,
+ * allocating the containing block if necessary.
+ */
+static dart_segment_info_t ** segment_slot(
     dart_segmentdata_t *segdata,
-    dart_segid_t        segid)
+    dart_segid_t        segid,
+    bool                create)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
-    }
-    elem = elem->next;
+  if (segid == DART_SEGMENT_LOCAL_DYNAMIC) {
+    return &(segdata->local_dynamic);
   }
-
-  if (elem == NULL) {
-    DART_LOG_ERROR("dart_segment__get_segment : "
-                   "Invalid segment ID %i on team %i",
-                   segid, segdata->team_id);
-    return NULL;
+  dart_segment_info_t *** blocks = (segid >= 0) ? segdata->mem_segs
+                                                : segdata->reg_segs;
+  int index = (segid >= 0) ? segid : -segid;
+  dart_segment_info_t ** block = blocks[index >> DART_SEGMENT_BLOCK_BITS];
+  if (block == NULL) {
+    if (!create) {
+      return NULL;
+    }
+    block = calloc(DART_SEGMENT_BLOCK_SIZE, sizeof(dart_segment_info_t*));
+    blocks[index >> DART_SEGMENT_BLOCK_BITS] = block;
   }
-
-  return &(elem->data);
+  return &(block[index & (DART_SEGMENT_BLOCK_SIZE - 1)]);
 }
 
-dart_segment_info_t * dart_segment_get_info(
-  dart_segmentdata_t *segdata,
-  dart_segid_t        segid)
+static inline void
+register_segment(dart_segmentdata_t *segdata, dart_segment_elem_t *elem)
 {
-  return get_segment(segdata, segid);
+  *segment_slot(segdata, elem->data.segid, true) = &(elem->data);
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment data table.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  memset(segdata->mem_segs, 0, sizeof(segdata->mem_segs));
+  memset(segdata->reg_segs, 0, sizeof(segdata->reg_segs));
+  segdata->local_dynamic = NULL;
 
   segdata->team_id = teamid;
   segdata->mem_freelist = NULL;
@@ -95,11 +77,15 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid;
-  dart_seghash_elem_t *elem = NULL;
+  dart_segment_elem_t *elem = NULL;
   if (type == DART_SEGMENT_LOCAL_ALLOC) {
     // no need to check for overflow
     segid = DART_SEGMENT_LOCAL;
-    elem = calloc(1, sizeof(dart_seghash_elem_t));
+    elem = calloc(1, sizeof(dart_segment_elem_t));
+    elem->data.segid = segid;
+  } else if (type == DART_SEGMENT_LOCAL_DYNAMIC_ALLOC) {
+    segid = DART_SEGMENT_LOCAL_DYNAMIC;
+    elem = calloc(1, sizeof(dart_segment_elem_t));
     elem->data.segid = segid;
   } else if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
@@ -114,7 +100,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
@@ -131,7 +117,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else {
@@ -152,7 +138,7 @@ dart_ret_t dart_segment_get_shmwin(
     int16_t              segid,
     MPI_Win            * win)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("Invalid segment ID %i on team %i", segid, segdata->team_id);
     return DART_ERR_INVAL;
@@ -173,7 +159,7 @@ dart_ret_t dart_segment_get_disp(dart_segmentdata_t * segdata,
   DART_LOG_TRACE("dart_segment_get_disp() "
                  "seq_id:%d rel_unitid:%d", segid, rel_unitid.id);
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
 
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_disp ! Invalid segment ID %i on team %i",
@@ -194,7 +180,7 @@ dart_ret_t dart_segment_get_baseptr(
   dart_team_unit_t      rel_unitid,
   char              **  baseptr_s)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_baseptr ! Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
@@ -212,7 +198,7 @@ dart_ret_t dart_segment_get_selfbaseptr(
   char               ** baseptr)
 {
   *baseptr = NULL;
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_selfbaseptr ! "
                    "Invalid segment ID %i on team %i",
@@ -229,7 +215,7 @@ dart_ret_t dart_segment_get_size(
   int16_t               segid,
   size_t              * size)
 {
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -245,7 +231,7 @@ dart_ret_t dart_segment_get_flags(
   uint16_t           * flags)
 {
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -261,7 +247,7 @@ dart_ret_t dart_segment_set_flags(
   uint16_t             flags)
 {
 
-  dart_segment_info_t *segment = get_segment(segdata, segid);
+  dart_segment_info_t *segment = dart_segment_get_info(segdata, segid);
   if (segment == NULL) {
     DART_LOG_ERROR("dart_segment_get_size ! Invalid segment ID %i", segid);
     return DART_ERR_INVAL;
@@ -297,50 +283,39 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
+  dart_segment_info_t **slot = segment_slot(segdata, segid, false);
 
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
-
-    pred = elem;
-    elem = elem->next;
+  if (slot == NULL || *slot == NULL) {
+    // element not found
+    return DART_ERR_INVAL;
   }
 
-  // element not found
-  return DART_ERR_INVAL;
+  // the segment info is the first member of its element
+  dart_segment_elem_t *elem = (dart_segment_elem_t *)(*slot);
+  *slot = NULL;
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  if (segid > 0) {
+    elem->next            = segdata->mem_freelist;
+    segdata->mem_freelist = elem;
+  } else if (segid < 0 && segid != DART_SEGMENT_LOCAL_DYNAMIC) {
+    elem->next            = segdata->reg_freelist;
+    segdata->reg_freelist = elem;
+  } else {
+    // This should not happen!
+    DART_ASSERT(segid != DART_SEGMENT_LOCAL &&
+                segid != DART_SEGMENT_LOCAL_DYNAMIC);
+  }
+  // set the segment ID again
+  elem->data.segid = segid;
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void clear_segdata_list(dart_segment_elem_t *listhead)
 {
-  dart_seghash_elem_t *elem = listhead;
+  dart_segment_elem_t *elem = listhead;
   while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
+    dart_segment_elem_t *tmp = elem;
     elem = tmp->next;
     tmp->next = NULL;
     // segment info should have been cleared in dart_segment_fini
@@ -351,25 +326,39 @@ static void clear_segdata_list(dart_seghash_elem_t *listhead)
   }
 }
 
+static void clear_segdata_blocks(dart_segment_info_t ***blocks)
+{
+  for (int b = 0; b < DART_SEGMENT_NUM_BLOCKS; b++) {
+    dart_segment_info_t **block = blocks[b];
+    if (block == NULL) {
+      continue;
+    }
+    for (int i = 0; i < DART_SEGMENT_BLOCK_SIZE; i++) {
+      if (block[i] != NULL) {
+        free_segment_info(block[i]);
+        free((dart_segment_elem_t *)block[i]);
+      }
+    }
+    free(block);
+    blocks[b] = NULL;
+  }
+}
+
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment data table.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
 {
-  // only clear up the local allocation segment in DART_TEAM_ALL
-  if (segdata->team_id == DART_TEAM_ALL) {
-    dart_segment_info_t *seg = get_segment(
-                        &(dart_adapt_teamlist_get(DART_TEAM_ALL)->segdata),
-                        DART_SEGMENT_LOCAL);
-    free_segment_info(seg);
-  }
+  clear_segdata_blocks(segdata->mem_segs);
+  clear_segdata_blocks(segdata->reg_segs);
 
-  // clear the remaining hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
+  if (segdata->local_dynamic != NULL) {
+    free_segment_info(segdata->local_dynamic);
+    free((dart_segment_elem_t *)segdata->local_dynamic);
+    segdata->local_dynamic = NULL;
   }
+
   clear_segdata_list(segdata->mem_freelist);
   segdata->mem_freelist = NULL;
 
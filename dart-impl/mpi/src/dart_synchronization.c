@@ -37,6 +37,10 @@ struct dart_lock_struct
    * to which we send a release message.
    */
   dart_gptr_t  gptr_list;
+  /**
+   * Window used to access the tail of the lock queue.
+   */
+  MPI_Win      win_tail;
   /**
    * Local mutex to ensure mutual exclusion between threads.
    */
@@ -46,6 +50,20 @@ struct dart_lock_struct
   int32_t is_acquired;
 };
 
+/**
+ * Returns the window of the local allocation segment holding the tail of a
+ * lock queue.
+ */
+static MPI_Win lock_tail_win(dart_gptr_t gptr_tail)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
+  DART_ASSERT(team_data != NULL);
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), gptr_tail.segid);
+  DART_ASSERT(seginfo != NULL);
+  return seginfo->win;
+}
+
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 {
   int ret;
@@ -78,7 +96,7 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
     /* Local store is safe and effective followed by the sync call. */
     *tail_ptr = -1;
-    MPI_Win_sync(dart_win_local_alloc);
+    MPI_Win_sync(lock_tail_win(gptr_tail));
   }
 
   /* Create a global memory region across the team.
@@ -116,6 +134,7 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   *lock = malloc(sizeof(struct dart_lock_struct));
   (*lock)->gptr_tail   = gptr_tail;
   (*lock)->gptr_list   = gptr_list;
+  (*lock)->win_tail    = lock_tail_win(gptr_tail);
   (*lock)->teamid      = teamid;
   (*lock)->is_acquired = 0;
   DART_ASSERT_RETURNS(
@@ -171,10 +190,10 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
       tail_unit,
       tail_offset,
       MPI_REPLACE,
-      dart_win_local_alloc),
+      lock->win_tail),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-      MPI_Win_flush(tail_unit, dart_win_local_alloc),
+      MPI_Win_flush(tail_unit, lock->win_tail),
       MPI_SUCCESS);
 
   DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
@@ -260,10 +279,10 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
       MPI_INT32_T,
       tail_unit,
       tail_offset,
-      dart_win_local_alloc),
+      lock->win_tail),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-    MPI_Win_flush (tail_unit, dart_win_local_alloc),
+    MPI_Win_flush (tail_unit, lock->win_tail),
     MPI_SUCCESS);
 
   /* If the old predecessor was -1, we have claimed the lock,
@@ -319,10 +338,10 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
       MPI_INT32_T,
       tail,
       offset_tail,
-      dart_win_local_alloc),
+      lock->win_tail),
     MPI_SUCCESS);
   DART_ASSERT_RETURNS(
-    MPI_Win_flush(tail, dart_win_local_alloc),
+    MPI_Win_flush(tail, lock->win_tail),
     MPI_SUCCESS);
 
   if (result != unitid.id) {
@@ -408,6 +427,371 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
   return DART_OK;
 }
 
+/*
+ * Words of a reader-writer lock in the memory of every unit.
+ */
+/** Non-zero while a unit holds or waits for the lock in exclusive mode */
+#define DART_RWLOCK_WRITER  0
+/** Number of readers holding the lock at this unit */
+#define DART_RWLOCK_READERS 1
+
+struct dart_rwlock_struct
+{
+  /**
+   * Exclusive lock serializing all units acquiring the lock in exclusive
+   * mode.
+   */
+  dart_lock_t           writer_lock;
+  /**
+   * Global memory holding the writer flag and the number of readers at
+   * every unit.
+   */
+  dart_gptr_t           gptr_state;
+  /**
+   * Segment of \c gptr_state.
+   */
+  dart_segment_info_t * seginfo;
+  /**
+   * Local mutex protecting the number of local readers.
+   */
+  dart_mutex_t          mutex;
+  dart_team_t           teamid;
+  dart_team_unit_t      unitid;
+  int                   team_size;
+  /** Number of threads holding the lock in shared mode at this unit. */
+  int32_t               num_readers;
+  /** Whether this unit has acquired the lock in exclusive mode. */
+  int32_t               is_acquired;
+};
 
+static inline MPI_Aint rwlock_disp(
+  const dart_rwlock_t lock,
+  int                 unit,
+  int                 word)
+{
+  return dart_segment_disp(lock->seginfo, DART_TEAM_UNIT_ID(unit)) +
+         word * sizeof(int32_t);
+}
 
+/**
+ * Atomically applies \c op with \c value on a word of the lock at \c unit
+ * and returns the previous value.
+ */
+static int32_t rwlock_fetch_and_op(
+  const dart_rwlock_t lock,
+  int                 unit,
+  int                 word,
+  int32_t             value,
+  MPI_Op              op)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value,
+      &result,
+      MPI_INT32_T,
+      unit,
+      rwlock_disp(lock, unit, word),
+      op,
+      lock->seginfo->win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit, lock->seginfo->win),
+    MPI_SUCCESS);
+  return result;
+}
+
+/**
+ * Sets the writer flag at all units of the team.
+ */
+static void rwlock_set_writer(const dart_rwlock_t lock, int32_t value)
+{
+  for (int unit = 0; unit < lock->team_size; ++unit) {
+    DART_ASSERT_RETURNS(
+      MPI_Accumulate(
+        &value,
+        1,
+        MPI_INT32_T,
+        unit,
+        rwlock_disp(lock, unit, DART_RWLOCK_WRITER),
+        1,
+        MPI_INT32_T,
+        MPI_REPLACE,
+        lock->seginfo->win),
+      MPI_SUCCESS);
+  }
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush_all(lock->seginfo->win),
+    MPI_SUCCESS);
+}
 
+/**
+ * Returns the first unit starting at \c unit that still has readers holding
+ * the lock or the team size if no unit has readers.
+ */
+static int rwlock_find_readers(const dart_rwlock_t lock, int unit)
+{
+  for (; unit < lock->team_size; ++unit) {
+    int32_t readers = rwlock_fetch_and_op(
+                        lock, unit, DART_RWLOCK_READERS, 0, MPI_NO_OP);
+    if (readers != 0) {
+      break;
+    }
+  }
+  return unit;
+}
+
+static inline void rwlock_progress(const dart_rwlock_t lock)
+{
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  int flag;
+  MPI_Iprobe(
+    MPI_ANY_SOURCE, MPI_ANY_TAG, team_data->comm, &flag, MPI_STATUS_IGNORE);
+}
+
+/**
+ * Registers a reader at the calling unit. Returns false and withdraws the
+ * registration if a unit holds or waits for the lock in exclusive mode.
+ */
+static bool rwlock_try_enter_shared(const dart_rwlock_t lock)
+{
+  rwlock_fetch_and_op(
+    lock, lock->unitid.id, DART_RWLOCK_READERS, 1, MPI_SUM);
+  int32_t writer = rwlock_fetch_and_op(
+                     lock, lock->unitid.id, DART_RWLOCK_WRITER, 0, MPI_NO_OP);
+  if (writer == 0) {
+    return true;
+  }
+  rwlock_fetch_and_op(
+    lock, lock->unitid.id, DART_RWLOCK_READERS, -1, MPI_SUM);
+  return false;
+}
+
+/**
+ * Release the resources acquired by \c dart_team_rwlock_init if a later
+ * step of the initialization fails.
+ */
+static void rwlock_init_cleanup(
+  dart_lock_t   * writer_lock,
+  dart_gptr_t     gptr_state)
+{
+  if (dart_team_memfree(gptr_state) != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to free global memory!", __FUNCTION__);
+  }
+  if (dart_team_lock_destroy(writer_lock) != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to destroy writer lock!", __FUNCTION__);
+  }
+}
+
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid, dart_rwlock_t* lock)
+{
+  dart_ret_t  ret;
+  dart_lock_t writer_lock;
+  dart_gptr_t gptr_state;
+
+  *lock = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (team_data == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  ret = dart_team_lock_init(teamid, &writer_lock);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to create writer lock!", __FUNCTION__);
+    return ret;
+  }
+
+  ret = dart_team_memalloc_aligned(teamid, 2, DART_TYPE_INT, &gptr_state);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to allocate global memory!", __FUNCTION__);
+    dart_team_lock_destroy(&writer_lock);
+    return ret;
+  }
+
+  dart_team_unit_t unitid = DART_TEAM_UNIT_ID(team_data->unitid);
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), gptr_state.segid);
+  DART_ASSERT(seginfo != NULL);
+
+  int32_t *state_ptr;
+  dart_gptr_setunit(&gptr_state, unitid);
+  dart_gptr_getaddr(gptr_state, (void*)&state_ptr);
+  state_ptr[DART_RWLOCK_WRITER]  = 0;
+  state_ptr[DART_RWLOCK_READERS] = 0;
+  MPI_Win_sync(seginfo->win);
+
+  // the state has to be initialized at all units before the first access
+  ret = dart_barrier(teamid);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to synchronize lock initialization!",
+                   __FUNCTION__);
+    rwlock_init_cleanup(&writer_lock, gptr_state);
+    return ret;
+  }
+
+  *lock = malloc(sizeof(struct dart_rwlock_struct));
+  if (*lock == NULL) {
+    DART_LOG_ERROR("%s: Failed to allocate lock!", __FUNCTION__);
+    rwlock_init_cleanup(&writer_lock, gptr_state);
+    return DART_ERR_OTHER;
+  }
+  (*lock)->writer_lock = writer_lock;
+  (*lock)->gptr_state  = gptr_state;
+  (*lock)->seginfo     = seginfo;
+  (*lock)->teamid      = teamid;
+  (*lock)->unitid      = unitid;
+  (*lock)->team_size   = team_data->size;
+  (*lock)->num_readers = 0;
+  (*lock)->is_acquired = 0;
+  ret = dart__base__mutex_init(&(*lock)->mutex);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("%s: Failed to initialize mutex!", __FUNCTION__);
+    rwlock_init_cleanup(&writer_lock, gptr_state);
+    free(*lock);
+    *lock = NULL;
+    return ret;
+  }
+
+  DART_LOG_DEBUG("dart_team_rwlock_init: INIT - done");
+
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire(dart_rwlock_t lock)
+{
+  /* serialize with other units acquiring the lock in exclusive mode */
+  dart_ret_t ret = dart_lock_acquire(lock->writer_lock);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  /* block new readers and wait for the active readers to leave */
+  rwlock_set_writer(lock, 1);
+  int unit = 0;
+  while ((unit = rwlock_find_readers(lock, unit)) < lock->team_size) {
+    rwlock_progress(lock);
+  }
+
+  DART_LOG_DEBUG("dart_rwlock_acquire: lock acquired in team %d",
+                 lock->teamid);
+  lock->is_acquired = 1;
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire(dart_rwlock_t lock, int32_t *is_acquired)
+{
+  *is_acquired = 0;
+
+  int32_t writer_acquired;
+  dart_ret_t ret = dart_lock_try_acquire(lock->writer_lock, &writer_acquired);
+  if (ret != DART_OK || !writer_acquired) {
+    return ret;
+  }
+
+  rwlock_set_writer(lock, 1);
+  if (rwlock_find_readers(lock, 0) < lock->team_size) {
+    /* readers are active, give up */
+    rwlock_set_writer(lock, 0);
+    return dart_lock_release(lock->writer_lock);
+  }
+
+  lock->is_acquired = 1;
+  *is_acquired = 1;
+  DART_LOG_DEBUG("dart_rwlock_try_acquire: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release(dart_rwlock_t lock)
+{
+  if (lock->is_acquired == 0) {
+    DART_LOG_ERROR("dart_rwlock_release: LOCK has not been acquired before\n");
+    return DART_ERR_INVAL;
+  }
+
+  lock->is_acquired = 0;
+  rwlock_set_writer(lock, 0);
+  DART_LOG_DEBUG("dart_rwlock_release: release lock in team %d",
+                 lock->teamid);
+  return dart_lock_release(lock->writer_lock);
+}
+
+dart_ret_t dart_rwlock_acquire_shared(dart_rwlock_t lock)
+{
+  while (!rwlock_try_enter_shared(lock)) {
+    /* wait until the writer has released the lock */
+    while (rwlock_fetch_and_op(
+             lock, lock->unitid.id, DART_RWLOCK_WRITER, 0, MPI_NO_OP) != 0) {
+      rwlock_progress(lock);
+    }
+  }
+
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+  lock->num_readers++;
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+
+  DART_LOG_DEBUG("dart_rwlock_acquire_shared: lock acquired in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire_shared(
+  dart_rwlock_t   lock,
+  int32_t       * is_acquired)
+{
+  *is_acquired = 0;
+  if (rwlock_try_enter_shared(lock)) {
+    DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+    lock->num_readers++;
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    *is_acquired = 1;
+  }
+
+  DART_LOG_DEBUG("dart_rwlock_try_acquire_shared: trylock %s in team %d",
+                 (*is_acquired) ? "succeeded" : "failed",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release_shared(dart_rwlock_t lock)
+{
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+  if (lock->num_readers == 0) {
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    DART_LOG_ERROR("dart_rwlock_release_shared: "
+                   "LOCK has not been acquired before\n");
+    return DART_ERR_INVAL;
+  }
+  lock->num_readers--;
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+
+  rwlock_fetch_and_op(
+    lock, lock->unitid.id, DART_RWLOCK_READERS, -1, MPI_SUM);
+
+  DART_LOG_DEBUG("dart_rwlock_release_shared: release lock in team %d",
+                 lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_team_rwlock_destroy(dart_rwlock_t* lock)
+{
+  dart_ret_t  ret;
+
+  ret = dart_team_memfree((*lock)->gptr_state);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to free global memory");
+    return ret;
+  }
+  ret = dart_team_lock_destroy(&(*lock)->writer_lock);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("Failed to destroy writer lock");
+    return ret;
+  }
+  dart__base__mutex_destroy(&(*lock)->mutex);
+  DART_LOG_DEBUG("dart_team_rwlock_destroy: done in team %d",
+                 (*lock)->teamid);
+  free(*lock);
+  *lock = NULL;
+  return DART_OK;
+}
@@ -7,13 +7,11 @@
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-#define DART_TEAM_HASH_SIZE (256)
-
 dart_team_t dart_next_availteamid = (DART_TEAM_ALL + 1);
 
 MPI_Comm dart_comm_world;
 
-static dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE];
+dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE];
 
 static int
 dart_adapt_teamlist_hash(dart_team_t teamid)
@@ -186,40 +184,28 @@ dart_adapt_teamlist_init()
   return DART_OK;
 }
 
-dart_team_data_t *
-dart_adapt_teamlist_get(dart_team_t teamid)
-{
-  int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  while (res != NULL && res->teamid != teamid) {
-    res = res->next;
-  }
-
-  return res;
-}
-
 dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid)
 {
+  if (teamid < 0) {
+    return DART_ERR_INVAL;
+  }
+
   int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  dart_team_data_t **prev = NULL;
+  dart_team_data_t **prev = &dart_team_data[slot];
 
-  while (res != NULL && res->teamid == teamid) {
-    prev = &res;
-    res = res->next;
+  while (*prev != NULL && (*prev)->teamid != teamid) {
+    prev = &((*prev)->next);
   }
 
+  dart_team_data_t *res = *prev;
+
   // not found!
   if (res == NULL) {
     return DART_ERR_INVAL;
   }
 
-  if (prev == NULL) {
-    dart_team_data[slot] = res->next;
-  } else {
-    (*prev)->next = res->next;
-  }
+  *prev = res->next;
 
   res->next = NULL;
   free(res);
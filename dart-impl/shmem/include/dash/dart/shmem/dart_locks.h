@@ -2,20 +2,13 @@
 #define DART_SYNC_H_INCLUDED
 
 #include <pthread.h>
+#include <dash/dart/if/dart_synchronization.h>
 #include <dash/dart/shmem/shmem_barriers_if.h>
 
-
-dart_ret_t dart_team_lock_init(dart_team_t teamid, 
-			       dart_lock_t* lock);
-
-dart_ret_t dart_team_lock_free(dart_team_t teamid,
-			       dart_lock_t* lock);
-
-dart_ret_t dart_lock_acquire(dart_lock_t lock);
-
-dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *result);
-
-dart_ret_t dart_lock_release(dart_lock_t lock);
-
+/*
+ * Locks are process-shared pthread mutexes and rwlocks located
+ * in the syncarea, see struct dart_lock_struct and
+ * struct dart_rwlock_struct.
+ */
 
 #endif /* DART_SYNC_H_INCLUDED */
@@ -1,9 +1,27 @@
 #ifndef DART_MALLOC_H_INCLUDED
 #define DART_MALLOC_H_INCLUDED
 
+#include <dash/dart/if/dart_globmem.h>
+
 #include <dash/dart/shmem/extern_c.h>
 EXTERN_C_BEGIN
 
+#define DART_LOCAL_ALLOC_SIZE_ENVSTR  "DART_LOCAL_ALLOC_SIZE"
+#define DART_LOCAL_ALLOC_SIZE_DEFAULT (1024*1024*16)
+
+// size of every unit's pool for non-collective allocations
+size_t dart_shmem_localpool_size();
+
+// releases the segments extending the local pool,
+// called by all units at exit
+void dart_shmem_localpool_fini(dart_unit_t myid);
+
+// address of the memory referenced by gptr in this process,
+// regardless of the unit it is located at
+dart_ret_t dart_shmem_gptr_addr(dart_gptr_t gptr, void **addr);
+
+// identifies the element referenced by gptr across all units
+uint64_t dart_shmem_gptr_key(dart_gptr_t gptr);
 
 EXTERN_C_END
 
@@ -7,10 +7,9 @@ EXTERN_C_BEGIN
 
 #include <dash/dart/shmem/dart_mempool.h>
 
+// mempools are indexed by their segment id
 struct dart_memarea
 {
-  int next_free;
-  
   struct dart_mempool mempools[MAXNUM_MEMPOOLS];
 };
 
@@ -18,19 +17,30 @@ typedef struct dart_memarea dart_memarea_t;
 
 void dart_memarea_init();
 
+void dart_memarea_fini();
+
 dart_mempoolptr 
 dart_memarea_get_mempool_by_id(int id); 
 
 
-// create a new mempool and return its id
+// create a new mempool and return its id,
+// collective on the team
 int dart_memarea_create_mempool(dart_team_t teamid,
 				size_t teamsize,
 				dart_unit_t myid,
 				size_t localsize,
 				int is_aligned);
-			      
 
+// create a mempool referencing memory of the team members
+// in other mempools and return its id, collective on the team
+int dart_memarea_register_mempool(dart_team_t teamid,
+				  size_t teamsize,
+				  dart_unit_t myid,
+				  const struct dart_mempool_regentry *entry);
 
+// collective on the team of the mempool
+dart_ret_t dart_memarea_destroy_mempool(int id,
+					dart_unit_t myid);
 
 EXTERN_C_END
 
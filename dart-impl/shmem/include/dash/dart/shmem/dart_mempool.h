@@ -12,6 +12,18 @@ EXTERN_C_BEGIN
 #define MEMPOOL_NULL        0
 #define MEMPOOL_ALIGNED     1
 #define MEMPOOL_UNALIGNED   2
+#define MEMPOOL_REGISTERED  3
+
+// alignment of the memory of every unit in a mempool
+#define MEMPOOL_UNIT_ALIGN  64
+
+// location of a unit's registered memory in an allocated mempool
+struct dart_mempool_regentry
+{
+  int         poolid;
+  dart_unit_t unit;
+  uint64_t    offset;
+};
 
 struct dart_mempool
 {
@@ -19,9 +31,14 @@ struct dart_mempool
   void             *base_addr;
   void             *localbase_addr;
   size_t           localsz;
+  size_t           teamsize;
   int              shmem_key;
   dart_team_t      teamid;
+  uint16_t         flags;
   dart_membucket   bucket;
+
+  // only used by registered mempools, indexed by team-relative unit id
+  struct dart_mempool_regentry *regtab;
 };
 
 typedef struct dart_mempool* dart_mempoolptr;
@@ -35,8 +52,7 @@ dart_ret_t dart_mempool_create(dart_mempoolptr pool,
 			       dart_unit_t myid,
 			       size_t localsz);
 
-
-
+void dart_mempool_destroy(dart_mempoolptr pool);
 
 EXTERN_C_END
 
@@ -32,15 +32,7 @@ struct team_impl_struct
   int syncslot;
   
   // the team members;
-  dart_group_t group;
-
-#if 0 /* TODO: remove me */
-  int mempoolid_aligned[MAXNUM_MEMPOOLS];
-  int mempoolid_unaligned[MAXNUM_MEMPOOLS];
-#endif  
-
-  //  dart_memarea_t mem;
-  
+  struct dart_group_struct group;
 };
 
 
@@ -56,15 +48,13 @@ int dart_shmem_team_new(dart_team_t *team,
 
 // init the local data structures associated with a team
 dart_ret_t dart_shmem_team_init(dart_team_t team, dart_unit_t myid, 
-				size_t tsize, const dart_group_t *group);
+				size_t tsize, const dart_group_t group);
 
 dart_ret_t dart_shmem_team_delete(dart_team_t team,
 				  dart_unit_t myid, size_t tsize );
 
 dart_ret_t dart_shmem_team_valid(dart_team_t team);
 
-//dart_memarea_t *dart_shmem_team_get_memarea(dart_team_t team);
-
 EXTERN_C_END
 
 #endif /* DART_TEAMS_IMPL_H_INCLUDED */
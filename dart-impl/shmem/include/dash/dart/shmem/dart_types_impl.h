@@ -0,0 +1,145 @@
+#ifndef DART_TYPES_IMPL_H_INCLUDED
+#define DART_TYPES_IMPL_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <dash/dart/base/macro.h>
+#include <dash/dart/if/dart_types.h>
+
+#include <dash/dart/shmem/extern_c.h>
+EXTERN_C_BEGIN
+
+/*
+ * Data types
+ *
+ * Basic types are represented by a static table indexed by their
+ * dart_datatype_t value, derived types are heap-allocated and their
+ * dart_datatype_t value is the address of their descriptor.
+ */
+
+typedef enum {
+  DART_KIND_BASIC = 0,
+  DART_KIND_STRIDED,
+  DART_KIND_INDEXED,
+  DART_KIND_CUSTOM
+} dart_type_kind_t;
+
+typedef struct dart_datatype_struct {
+  /// the underlying data-type (type == base_type for basic types)
+  dart_datatype_t      base_type;
+  /// the kind of this type (basic, strided, indexed, custom)
+  dart_type_kind_t     kind;
+  /// the number of base elements in a single block pattern of this type
+  size_t               num_elem;
+  /// the size in bytes of a single base element
+  size_t               size;
+  union {
+    /// used for DART_KIND_STRIDED
+    struct {
+      /// the stride in elements between the start of two blocks
+      size_t           stride;
+    } strided;
+    /// used for DART_KIND_INDEXED
+    struct {
+      /// the numbers of elements in each block
+      size_t         * blocklens;
+      /// the element offsets at which each block starts
+      size_t         * offsets;
+      /// the number of blocks
+      size_t           num_blocks;
+      /// the distance in elements between two repetitions of the pattern
+      size_t           extent;
+    } indexed;
+  };
+} dart_datatype_struct_t;
+
+extern dart_datatype_struct_t dart__shmem__base_types[DART_TYPE_LAST];
+
+dart_ret_t dart__shmem__datatype_init();
+
+DART_INLINE
+dart_datatype_struct_t * dart__shmem__datatype_struct(
+  dart_datatype_t dart_type)
+{
+  return (dart_type < DART_TYPE_LAST)
+            ? &dart__shmem__base_types[dart_type]
+            : (dart_datatype_struct_t *)dart_type;
+}
+
+DART_INLINE
+bool dart__shmem__datatype_iscontiguous(dart_datatype_t dart_type)
+{
+  dart_type_kind_t kind = dart__shmem__datatype_struct(dart_type)->kind;
+  return (kind == DART_KIND_BASIC || kind == DART_KIND_CUSTOM);
+}
+
+/**
+ * Size in bytes of a single element of the given type, i.e. of the
+ * base type for strided and indexed types.
+ */
+DART_INLINE
+size_t dart__shmem__datatype_sizeof(dart_datatype_t dart_type)
+{
+  return dart__shmem__datatype_struct(dart_type)->size;
+}
+
+/**
+ * Copy \c nelem elements from \c src laid out according to \c src_type
+ * to \c dst laid out according to \c dst_type.
+ * Both types have to share the same base type.
+ */
+dart_ret_t dart__shmem__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem);
+
+/*
+ * Reduction operations
+ */
+
+struct dart_operation_struct {
+  dart_operator_t   op;
+  void            * user_data;
+  dart_datatype_t   dtype;
+};
+
+/**
+ * Apply \c op element-wise on \c nelem elements, i.e.
+ * <tt>inout[i] = in[i] op inout[i]</tt>.
+ */
+dart_ret_t dart__shmem__op_apply(
+  dart_operation_t   op,
+  dart_datatype_t    dtype,
+  const void       * in,
+  void             * inout,
+  size_t             nelem);
+
+/**
+ * Atomically apply \c op on a single element at \c target that may be
+ * accessed concurrently by other units.
+ * The previous value is stored in \c result unless it is \c NULL.
+ * The \c key identifies the element across units and is used to serialize
+ * updates on types that cannot be modified lock-free.
+ */
+dart_ret_t dart__shmem__atomic_apply(
+  uint64_t           key,
+  void             * target,
+  const void       * value,
+  void             * result,
+  dart_datatype_t    dtype,
+  dart_operation_t   op);
+
+dart_ret_t dart__shmem__atomic_cas(
+  uint64_t           key,
+  void             * target,
+  const void       * value,
+  const void       * compare,
+  void             * result,
+  dart_datatype_t    dtype);
+
+EXTERN_C_END
+
+#endif /* DART_TYPES_IMPL_H_INCLUDED */
@@ -10,6 +10,7 @@
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/shmem/dart_teams_impl.h>
+#include <dash/dart/shmem/dart_mempool.h>
 
 #include <dash/dart/shmem/extern_c.h>
 EXTERN_C_BEGIN
@@ -35,6 +36,22 @@ struct dart_lock_struct
   int             inuse;
 };
 
+struct dart_rwlock_struct
+{
+  // serializes units acquiring the lock in exclusive mode
+  pthread_mutex_t  writer_lock;
+  // non-zero while a unit holds or waits for the lock in exclusive mode
+  volatile int     writer;
+  // number of units holding the lock in shared mode
+  volatile int     readers;
+  dart_team_t      teamid;
+  int              inuse;
+};
+
+/* number of locks serializing atomic updates of elements that
+   cannot be modified lock-free, selected by hashing the element */
+#define NUM_ATOMIC_LOCKS  64
+
 
 struct sysv_team
 {
@@ -50,6 +67,10 @@ struct sysv_team
 #define UNIT_STATE_INITIALIZED      1
 #define UNIT_STATE_CLEAN_EXIT       2
 
+/* number of segments a unit can add to its part of the pool
+   serving dart_memalloc, each doubling the capacity */
+#define NUM_LOCALPOOL_CHUNKS  24
+
 struct syncarea_struct
 {
   pthread_mutex_t barrier_lock;
@@ -59,9 +80,20 @@ struct syncarea_struct
   int unitstate[MAXNUM_UNITS];
 
   struct dart_lock_struct locks[MAXNUM_LOCKS];
-  
+
+  struct dart_rwlock_struct rwlocks[MAXNUM_LOCKS];
+
+  pthread_mutex_t atomic_locks[NUM_ATOMIC_LOCKS];
+
   struct sysv_team teams[MAXNUM_TEAMS];
 
+  // segment ids of memory pools are unique across all teams
+  int mempool_inuse[MAXNUM_MEMPOOLS];
+
+  // shared memory ids of the segments extending the local pool
+  // of every unit, -1 if not created
+  int localpool_chunks[MAXNUM_UNITS][NUM_LOCALPOOL_CHUNKS];
+
 #ifdef USE_EVENTFD
   int eventfd;
 #endif 
@@ -85,8 +117,14 @@ int shmem_syncarea_newteam(dart_team_t *teamid, int numprocs);
 int shmem_syncarea_delteam(dart_team_t teamid, int numprocs);
 
 int shmem_syncarea_findteam(dart_team_t teamid);
+
+int shmem_syncarea_newpool();
+int shmem_syncarea_delpool(int poolid);
+
 int shmem_syncarea_barrier_wait(int slot);
 
+pthread_mutex_t * shmem_syncarea_atomic_lock(uint64_t key);
+
 int shmem_syncarea_getunitstate(dart_unit_t unit);
 int shmem_syncarea_setunitstate(dart_unit_t unit, int state);
 
@@ -13,7 +13,7 @@ int dart_shmem_p2p_init(dart_team_t t, size_t tsize,
 int dart_shmem_p2p_destroy(dart_team_t t, size_t tsize, 
 			   dart_unit_t myid, int key);
 
-int dart_shmem_send(void *buf, size_t nbytes, 
+int dart_shmem_send(const void *buf, size_t nbytes, 
 		    dart_team_t teamid, dart_unit_t dest);
 
 int dart_shmem_recv(void *buf, size_t nbytes,
@@ -16,10 +16,10 @@ typedef struct fifo_pair_struct
   dart_unit_t writeto;
 } fifo_pair_t;
 
-fifo_pair_t team2fifos[MAXNUM_TEAMS][MAXSIZE_GROUP];
+extern fifo_pair_t team2fifos[MAXNUM_TEAMS][MAXSIZE_GROUP];
 
 int dart_shmem_send(
-    void *buf,
+    const void *buf,
     size_t nbytes, 
 	  dart_team_t teamid,
     dart_unit_t dest);
@@ -1,12 +1,52 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <dash/dart/base/logging.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/dart/if/dart_team_group.h>
+#include <dash/dart/shmem/dart_types_impl.h>
 #include <dash/dart/shmem/shmem_p2p_if.h>
 #include <dash/dart/shmem/shmem_logger.h>
 #include <dash/dart/shmem/shmem_barriers_if.h>
 
+/*
+ * Collective operations are implemented on top of the point-to-point
+ * communication between the members of a team, all data is exchanged
+ * with a root unit.
+ * Collectives only accept contiguous data types, the number of bytes
+ * to transfer is nelem times the size of the data type.
+ */
+
+#define CHECK_IS_CONTIGUOUSTYPE(_dtype)                               \
+  do {                                                                \
+    if (!dart__shmem__datatype_iscontiguous(_dtype)) {                \
+      DART_LOG_ERROR("%s ! Only contiguous data types supported",     \
+                     __func__);                                       \
+      return DART_ERR_INVAL;                                          \
+    }                                                                 \
+  } while (0)
+
+#define CHECK_TEAM(_team, _myid, _size)                               \
+  do {                                                                \
+    if (dart_team_myid(_team, &(_myid)) != DART_OK ||                 \
+        dart_team_size(_team, &(_size)) != DART_OK) {                 \
+      DART_LOG_ERROR("%s ! Unknown team %d", __func__, _team);        \
+      return DART_ERR_INVAL;                                          \
+    }                                                                 \
+  } while (0)
+
+#define CHECK_ROOT(_root, _size)                                      \
+  do {                                                                \
+    if ((_root).id < 0 || (size_t)(_root).id >= (_size)) {            \
+      DART_LOG_ERROR("%s ! Invalid root unit %d", __func__,           \
+                     (_root).id);                                     \
+      return DART_ERR_INVAL;                                          \
+    }                                                                 \
+  } while (0)
+
 dart_ret_t dart_barrier(dart_team_t teamid)
 {
   dart_ret_t ret;
@@ -24,39 +64,44 @@ dart_ret_t dart_barrier(dart_team_t teamid)
       ret = DART_ERR_NOTFOUND;
     }
   }
-  
+
   return ret;
 }
 
-dart_ret_t dart_bcast(void *buf, size_t nbytes, 
-		      dart_unit_t root, dart_team_t team)
+dart_ret_t dart_bcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team)
 {
-  //SANITY_CHECK_TEAM(team);
-  dart_unit_t myid;
+  dart_team_unit_t myid;
   size_t size;
+  size_t i;
 
-  int i;
-  dart_team_myid(team, &myid);
-  dart_team_size(team, &size);
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  CHECK_ROOT(root, size);
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
 
   // TODO: this barrier was necessary to
   // make the bcast test case working reliably
   dart_barrier(team);
 
-  DEBUG("dart_bcast on team %d, root=%d, tsize=%d", team, root, size);
-  if( myid==root ) 
+  DEBUG("dart_bcast on team %d, root=%d, tsize=%zu", team, root.id, size);
+  if( myid.id==root.id )
     {
       for(i=0; i<size; i++) {
-	if( i!=root ) {
-	  DEBUG("dart_bcast sending to %d %d bytes", i, nbytes);
+	if( i!=root.id ) {
+	  DEBUG("dart_bcast sending to %zu %zu bytes", i, nbytes);
 	  dart_shmem_send(buf, nbytes, team, i);
 	}
-      } 
-  } 
-  else 
+      }
+  }
+  else
     {
-      DEBUG("dart_bcast receiving from %d %d bytes", root, nbytes);
-      dart_shmem_recv(buf, nbytes, team, root);
+      DEBUG("dart_bcast receiving from %d %zu bytes", root.id, nbytes);
+      dart_shmem_recv(buf, nbytes, team, root.id);
     }
 
   // TODO: this barrier was necessary to
@@ -66,74 +111,546 @@ dart_ret_t dart_bcast(void *buf, size_t nbytes,
   return DART_OK;
 }
 
-dart_ret_t dart_scatter(void *sendbuf, void *recvbuf, size_t nbytes, 
-			dart_unit_t root, dart_team_t team)
+dart_ret_t dart_scatter(
+  const void         * sendbuf,
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  dart_team_unit_t     root,
+  dart_team_t          team)
 {
-  //SANITY_CHECK_TEAM(team);
-  dart_unit_t myid;
+  dart_team_unit_t myid;
   size_t size;
-  int i;
-  //explicit casts to avoid warnings!! carefully double check please!
-  char* sbuf = (char*)sendbuf;
+  size_t i;
+  const char* sbuf = (const char*)sendbuf;
   char* rbuf = (char*)recvbuf;
 
-  dart_team_myid( team, &myid);
-  dart_team_size( team, &size);
-  
-  DEBUG("dart_gather on team %d, root=%d, tsize=%d", team,root,size);
-  if( myid == root){
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  CHECK_ROOT(root, size);
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+
+  DEBUG("dart_scatter on team %d, root=%d, tsize=%zu", team, root.id, size);
+  if( myid.id == root.id){
     for( i = 0; i < size; i++){
-      if( i != root){
-        DEBUG("dart_scatter sending to %d %d bytes",i,nbytes);
+      if( i != root.id){
+        DEBUG("dart_scatter sending to %zu %zu bytes",i,nbytes);
         dart_shmem_send(&sbuf[nbytes*i],nbytes,team,i);
       }else{
-        memcpy(&sbuf[nbytes*i],rbuf,nbytes);
+        memcpy(rbuf,&sbuf[nbytes*i],nbytes);
       }
     }
   }else{
-    DEBUG("dart_scatter receiving from %d %d bytes",root, nbytes);
-    dart_shmem_recv(rbuf,nbytes,team,root);
+    DEBUG("dart_scatter receiving from %d %zu bytes",root.id, nbytes);
+    dart_shmem_recv(rbuf,nbytes,team,root.id);
   }
   return DART_OK;
 }
 
-dart_ret_t dart_gather(void *sendbuf, void *recvbuf, size_t nbytes, 
-		       dart_unit_t root, dart_team_t team)
+dart_ret_t dart_gather(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team)
 {
-  //SANITY_CHECK_TEAM(team);
-  dart_unit_t myid;
+  dart_team_unit_t myid;
   size_t size;
-  int i;
-  //explicit casts to avoid warnings!! carefully double check please!
-  char* sbuf=(char*)sendbuf;
+  size_t i;
+  const char* sbuf=(const char*)sendbuf;
   char* rbuf=(char*)recvbuf;
 
-  dart_team_myid(team, &myid);
-  dart_team_size(team, &size);
-  DEBUG("dart_gather on team %d, root=%d, tsize=%d", team,root,size);
-  if( myid == root){
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  CHECK_ROOT(root, size);
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+
+  DEBUG("dart_gather on team %d, root=%d, tsize=%zu", team, root.id, size);
+  if( myid.id == root.id){
     for( i = 0; i< size; i++){
-      if(i != root){
-        DEBUG("dart_gather receiving from %d %d bytes", i, nbytes);
-        dart_shmem_recv(&rbuf[nbytes*i], nbytes, team, i); 
+      if(i != root.id){
+        DEBUG("dart_gather receiving from %zu %zu bytes", i, nbytes);
+        dart_shmem_recv(&rbuf[nbytes*i], nbytes, team, i);
       }else{
         memcpy(&rbuf[nbytes*i],sbuf,nbytes);
       }
     }
   }else{
-    DEBUG("dart_gather sending to %d %d bytes", root, nbytes);
-    dart_shmem_send(sbuf,nbytes,team,root);
+    DEBUG("dart_gather sending to %d %zu bytes", root.id, nbytes);
+    dart_shmem_send(sbuf,nbytes,team,root.id);
+  }
+  dart_barrier(team);
+  return DART_OK;
+}
+
+dart_ret_t dart_allgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team)
+{
+  dart_team_unit_t myid;
+  size_t size;
+  dart_team_unit_t root = DART_TEAM_UNIT_ID(0);
+
+  CHECK_TEAM(team, myid, size);
+  DEBUG("dart_allgather on team %d, tsize=%zu", team, size);
+  dart_ret_t ret = dart_gather(sendbuf,recvbuf,nelem,dtype,root,team);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  return dart_bcast(recvbuf,nelem*size,dtype,root,team);
+}
+
+dart_ret_t dart_allgatherv(
+  const void      * sendbuf,
+  size_t            nsendelem,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       team)
+{
+  dart_team_unit_t myid;
+  size_t size;
+  size_t i, j;
+  const char* sbuf=(const char*)sendbuf;
+  char* rbuf=(char*)recvbuf;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  size_t esize = dart__shmem__datatype_sizeof(dtype);
+
+  DEBUG("dart_allgatherv on team %d, tsize=%zu", team, size);
+  memcpy(&rbuf[recvdispls[myid.id]*esize], sbuf, nsendelem*esize);
+
+  // unit 0 collects the blocks of all units and forwards every
+  // block to all units except the one it originates from, so that
+  // gaps in the receive buffers are left untouched
+  if( myid.id == 0 ) {
+    for( i = 1; i < size; i++ ) {
+      if( nrecvelem[i] > 0 ) {
+        dart_shmem_recv(&rbuf[recvdispls[i]*esize], nrecvelem[i]*esize,
+                        team, i);
+      }
+    }
+    for( j = 1; j < size; j++ ) {
+      for( i = 0; i < size; i++ ) {
+        if( i != j && nrecvelem[i] > 0 ) {
+          dart_shmem_send(&rbuf[recvdispls[i]*esize], nrecvelem[i]*esize,
+                          team, j);
+        }
+      }
+    }
+  } else {
+    if( nsendelem > 0 ) {
+      dart_shmem_send(sbuf, nsendelem*esize, team, 0);
+    }
+    for( i = 0; i < size; i++ ) {
+      if( i != myid.id && nrecvelem[i] > 0 ) {
+        dart_shmem_recv(&rbuf[recvdispls[i]*esize], nrecvelem[i]*esize,
+                        team, 0);
+      }
+    }
   }
   dart_barrier(team);
   return DART_OK;
 }
-  
-dart_ret_t dart_allgather(void *sendbuf, void *recvbuf, size_t nbytes, 
-			  dart_team_t team)
-{ 
-  dart_unit_t root = 0;
-  DEBUG("dart_allgather on team %d, tsize=%d", team, root, size);
-  dart_gather(sendbuf,recvbuf,nbytes,root,team);
-  dart_bcast(recvbuf,nbytes,root,team);
+
+dart_ret_t dart_alltoall(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team)
+{
+  dart_team_unit_t myid;
+  size_t size;
+  size_t i, root;
+  const char* sbuf=(const char*)sendbuf;
+  char* rbuf=(char*)recvbuf;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+
+  // in-place exchange: blocks to send are overwritten by received blocks
+  char *tmp = NULL;
+  if( sendbuf == recvbuf && sendbuf != NULL ) {
+    tmp = malloc(nbytes*size);
+    if( tmp == NULL ) {
+      DART_LOG_ERROR("dart_alltoall ! failed to allocate send buffer");
+      return DART_ERR_OTHER;
+    }
+    memcpy(tmp, recvbuf, nbytes*size);
+    sbuf = tmp;
+  }
+
+  DEBUG("dart_alltoall on team %d, tsize=%zu", team, size);
+  // every unit gathers the blocks addressed to it in turn
+  for( root = 0; root < size; root++ ) {
+    if( myid.id == root ) {
+      for( i = 0; i < size; i++ ) {
+        if( i != root ) {
+          DEBUG("dart_alltoall receiving from %zu %zu bytes", i, nbytes);
+          dart_shmem_recv(&rbuf[nbytes*i], nbytes, team, i);
+        } else {
+          memcpy(&rbuf[nbytes*i], &sbuf[nbytes*i], nbytes);
+        }
+      }
+    } else {
+      DEBUG("dart_alltoall sending to %zu %zu bytes", root, nbytes);
+      dart_shmem_send(&sbuf[nbytes*root], nbytes, team, root);
+    }
+  }
+  dart_barrier(team);
+  free(tmp);
+  return DART_OK;
+}
+
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       team)
+{
+  dart_team_unit_t myid;
+  size_t size;
+  size_t i, root;
+  const char* sbuf=(const char*)sendbuf;
+  char* rbuf=(char*)recvbuf;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  size_t esize = dart__shmem__datatype_sizeof(dtype);
+
+  // in-place exchange: data to send is described by the receive counts
+  // and displacements and is overwritten by received data
+  char *tmp = NULL;
+  if( sendbuf == recvbuf && sendbuf != NULL ) {
+    size_t nbytes = 0;
+    for( i = 0; i < size; i++ ) {
+      size_t end = (recvdispls[i] + nrecvelem[i]) * esize;
+      if( nrecvelem[i] > 0 && end > nbytes ) {
+        nbytes = end;
+      }
+    }
+    tmp = malloc(nbytes > 0 ? nbytes : 1);
+    if( tmp == NULL ) {
+      DART_LOG_ERROR("dart_alltoallv ! failed to allocate send buffer");
+      return DART_ERR_OTHER;
+    }
+    memcpy(tmp, recvbuf, nbytes);
+    sbuf       = tmp;
+    nsendelem  = nrecvelem;
+    senddispls = recvdispls;
+  }
+
+  DEBUG("dart_alltoallv on team %d, tsize=%zu", team, size);
+  // every unit gathers the blocks addressed to it in turn
+  for( root = 0; root < size; root++ ) {
+    if( myid.id == root ) {
+      for( i = 0; i < size; i++ ) {
+        if( nrecvelem[i] == 0 ) {
+          continue;
+        }
+        if( i != root ) {
+          DEBUG("dart_alltoallv receiving from %zu %zu elements",
+                i, nrecvelem[i]);
+          dart_shmem_recv(&rbuf[recvdispls[i]*esize], nrecvelem[i]*esize,
+                          team, i);
+        } else {
+          memcpy(&rbuf[recvdispls[i]*esize], &sbuf[senddispls[i]*esize],
+                 nrecvelem[i]*esize);
+        }
+      }
+    } else if( nsendelem[root] > 0 ) {
+      DEBUG("dart_alltoallv sending to %zu %zu elements",
+            root, nsendelem[root]);
+      dart_shmem_send(&sbuf[senddispls[root]*esize],
+                      nsendelem[root]*esize, team, root);
+    }
+  }
+  dart_barrier(team);
+  free(tmp);
+  return DART_OK;
+}
+
+dart_ret_t dart_reduce(
+  const void        * sendbuf,
+  void              * recvbuf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_operation_t    op,
+  dart_team_unit_t    root,
+  dart_team_t         team)
+{
+  dart_team_unit_t myid;
+  size_t size;
+  size_t i;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  CHECK_ROOT(root, size);
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+
+  DEBUG("dart_reduce on team %d, root=%d, tsize=%zu", team, root.id, size);
+  if( myid.id != root.id ) {
+    dart_shmem_send(sendbuf, nbytes, team, root.id);
+    return DART_OK;
+  }
+
+  char *acc = malloc(nbytes);
+  char *tmp = malloc(nbytes);
+  dart_ret_t ret = DART_OK;
+
+  // the result is x_0 op x_1 op ... op x_(n-1) for operations
+  // that are not commutative, so the values of the units are
+  // combined in reverse order
+  for( i = size; i-- > 0; ) {
+    const char *val;
+    if( i == root.id ) {
+      val = (const char *)sendbuf;
+    } else {
+      dart_shmem_recv(tmp, nbytes, team, i);
+      val = tmp;
+    }
+    if( i == size - 1 ) {
+      memcpy(acc, val, nbytes);
+    } else if( ret == DART_OK ) {
+      ret = dart__shmem__op_apply(op, dtype, val, acc, nelem);
+    }
+  }
+  if( ret == DART_OK ) {
+    memcpy(recvbuf, acc, nbytes);
+  }
+  free(tmp);
+  free(acc);
+  return ret;
+}
+
+dart_ret_t dart_allreduce(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team)
+{
+  dart_team_unit_t root = DART_TEAM_UNIT_ID(0);
+  dart_ret_t ret = dart_reduce(sendbuf, recvbuf, nelem, dtype, op,
+                               root, team);
+  if( ret != DART_OK ) {
+    return ret;
+  }
+  return dart_bcast(recvbuf, nelem, dtype, root, team);
+}
+
+dart_ret_t dart_exscan(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team)
+{
+  dart_team_unit_t myid;
+  size_t size;
+  size_t i;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  CHECK_TEAM(team, myid, size);
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+
+  DEBUG("dart_exscan on team %d, tsize=%zu", team, size);
+  if( myid.id != 0 ) {
+    dart_shmem_send(sendbuf, nbytes, team, 0);
+    dart_shmem_recv(recvbuf, nbytes, team, 0);
+    return DART_OK;
+  }
+
+  // unit 0 computes the prefix of every unit, the
+  // receive buffer of unit 0 is left undefined
+  char *prefix = malloc(nbytes);
+  char *tmp    = malloc(nbytes);
+  dart_ret_t ret = DART_OK;
+
+  memcpy(prefix, sendbuf, nbytes);
+  for( i = 1; i < size; i++ ) {
+    dart_shmem_recv(tmp, nbytes, team, i);
+    dart_shmem_send(prefix, nbytes, team, i);
+    if( ret == DART_OK ) {
+      ret = dart__shmem__op_apply(op, dtype, prefix, tmp, nelem);
+    }
+    memcpy(prefix, tmp, nbytes);
+  }
+  free(tmp);
+  free(prefix);
+  return ret;
+}
+
+/*
+ * Non-blocking collectives complete before they return.
+ */
+
+dart_ret_t dart_ibarrier(
+  dart_team_t     team,
+  dart_handle_t * handle)
+{
+  *handle = DART_HANDLE_NULL;
+  return dart_barrier(team);
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle)
+{
+  *handle = DART_HANDLE_NULL;
+  return dart_bcast(buf, nelem, dtype, root, team);
+}
+
+dart_ret_t dart_iallgather(
+  const void      * sendbuf,
+  void            * recvbuf,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_team_t       team,
+  dart_handle_t   * handle)
+{
+  *handle = DART_HANDLE_NULL;
+  return dart_allgather(sendbuf, recvbuf, nelem, dtype, team);
+}
+
+dart_ret_t dart_iallreduce(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team,
+  dart_handle_t  * handle)
+{
+  *handle = DART_HANDLE_NULL;
+  return dart_allreduce(sendbuf, recvbuf, nelem, dtype, op, team);
+}
+
+/*
+ * Point-to-point communication between units of DART_TEAM_ALL.
+ *
+ * Every message is preceded by a header carrying its tag and size.
+ * Messages between two units are received in the order they were sent,
+ * the tag of the next message has to match the tag of the receive.
+ */
+
+struct p2p_header
+{
+  int    tag;
+  size_t nbytes;
+};
+
+dart_ret_t dart_send(
+  const void         * sendbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  struct p2p_header hdr;
+  hdr.tag    = tag;
+  hdr.nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+
+  if( dart_shmem_send(&hdr, sizeof(hdr), DART_TEAM_ALL, unit.id) < 0 ||
+      dart_shmem_send(sendbuf, hdr.nbytes,
+                      DART_TEAM_ALL, unit.id) < 0 ) {
+    DART_LOG_ERROR("dart_send ! failed to send to unit %d", unit.id);
+    return DART_ERR_OTHER;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_recv(
+  void               * recvbuf,
+  size_t               nelem,
+  dart_datatype_t      dtype,
+  int                  tag,
+  dart_global_unit_t   unit)
+{
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  struct p2p_header hdr;
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+
+  if( dart_shmem_recv(&hdr, sizeof(hdr), DART_TEAM_ALL, unit.id) != 0 ) {
+    DART_LOG_ERROR("dart_recv ! failed to receive from unit %d", unit.id);
+    return DART_ERR_OTHER;
+  }
+  if( hdr.nbytes > nbytes ) {
+    // drain the message to keep the channel consistent
+    char *tmp = malloc(hdr.nbytes);
+    dart_shmem_recv(tmp, hdr.nbytes, DART_TEAM_ALL, unit.id);
+    free(tmp);
+    DART_LOG_ERROR("dart_recv ! message of %zu bytes from unit %d "
+                   "exceeds receive buffer of %zu bytes",
+                   hdr.nbytes, unit.id, nbytes);
+    return DART_ERR_INVAL;
+  }
+  if( dart_shmem_recv(recvbuf, hdr.nbytes, DART_TEAM_ALL, unit.id) != 0 ) {
+    DART_LOG_ERROR("dart_recv ! failed to receive from unit %d", unit.id);
+    return DART_ERR_OTHER;
+  }
+  if( hdr.tag != tag ) {
+    DART_LOG_ERROR("dart_recv ! received message with tag %d from unit %d, "
+                   "expected tag %d", hdr.tag, unit.id, tag);
+    return DART_ERR_INVAL;
+  }
   return DART_OK;
 }
+
+dart_ret_t dart_sendrecv(
+  const void         * sendbuf,
+  size_t               send_nelem,
+  dart_datatype_t      send_dtype,
+  int                  send_tag,
+  dart_global_unit_t   dest,
+  void               * recvbuf,
+  size_t               recv_nelem,
+  dart_datatype_t      recv_dtype,
+  int                  recv_tag,
+  dart_global_unit_t   src)
+{
+  dart_ret_t ret;
+  dart_global_unit_t myid;
+  dart_myid(&myid);
+
+  if( dest.id == myid.id && src.id == myid.id ) {
+    CHECK_IS_CONTIGUOUSTYPE(send_dtype);
+    size_t nbytes = send_nelem * dart__shmem__datatype_sizeof(send_dtype);
+    memmove(recvbuf, sendbuf, nbytes);
+    return DART_OK;
+  }
+
+  // the unit with the lower id sends first so that messages exceeding
+  // the capacity of the channel do not block both partners
+  if( myid.id < dest.id ) {
+    ret = dart_send(sendbuf, send_nelem, send_dtype, send_tag, dest);
+    if( ret == DART_OK ) {
+      ret = dart_recv(recvbuf, recv_nelem, recv_dtype, recv_tag, src);
+    }
+  } else {
+    ret = dart_recv(recvbuf, recv_nelem, recv_dtype, recv_tag, src);
+    if( ret == DART_OK ) {
+      ret = dart_send(sendbuf, send_nelem, send_dtype, send_tag, dest);
+    }
+  }
+  return ret;
+}
@@ -1,56 +1,90 @@
 #include <stdio.h>
+#include <stdlib.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/assert.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_team_group.h>
+#include <dash/dart/if/dart_locality.h>
 #include <dash/dart/shmem/dart_groups_impl.h>
 
-dart_ret_t dart_group_sizeof(size_t *size)
-{
-  *size=sizeof(dart_group_t);
-  return DART_OK;
-}
-
-dart_ret_t dart_group_create(dart_group_t *group)
+static struct dart_group_struct* allocate_group()
 {
+  struct dart_group_struct* group = malloc(sizeof(struct dart_group_struct));
   int i;
-  
+
   group->nmem = 0;
   for (i = 0; i < MAXSIZE_GROUP; i++)
     {
       (group->g2l)[i] = -1;
       (group->l2g)[i] = -1;
     }
-  return DART_OK; 
+  return group;
+}
+
+#define CHECK_UNIT_ID(_unitid)                                        \
+  do {                                                                \
+    if ((_unitid).id < 0 || (_unitid).id >= MAXSIZE_GROUP) {          \
+      DART_LOG_ERROR("%s ! Invalid unit id %d", __func__,             \
+                     (_unitid).id);                                   \
+      return DART_ERR_INVAL;                                          \
+    }                                                                 \
+  } while (0)
+
+dart_ret_t dart_group_create(dart_group_t *group)
+{
+  *group = allocate_group();
+  return DART_OK;
 }
 
 dart_ret_t dart_group_destroy(dart_group_t *group)
 {
-  group->nmem = 0;
+  if (group == NULL) {
+    DART_LOG_ERROR("Invalid group argument");
+    return DART_ERR_INVAL;
+  }
+  free(*group);
+  *group = NULL;
   return DART_OK;
 }
 
-dart_ret_t dart_group_clone(const dart_group_t *g, dart_group_t *gout)
+dart_ret_t dart_group_clone(const dart_group_t g, dart_group_t *gout)
 {
   int i;
-  
-  gout->nmem = g->nmem;
+
+  if (g == NULL || gout == NULL) {
+    if (gout != NULL) {
+      *gout = NULL;
+    }
+    DART_LOG_ERROR("Invalid group argument: %p (gin), %p (gout)",
+                   (void*)g, (void*)gout);
+    return DART_ERR_INVAL;
+  }
+
+  *gout = allocate_group();
+  (*gout)->nmem = g->nmem;
   for (i = 0; i < MAXSIZE_GROUP; i++)
     {
-      (gout->g2l)[i] = (g->g2l)[i];
-      (gout->l2g)[i] = (g->l2g)[i];
+      ((*gout)->g2l)[i] = (g->g2l)[i];
+      ((*gout)->l2g)[i] = (g->l2g)[i];
     }
   return DART_OK;
 }
 
 // helper function not in the interface
-void group_rebuild(dart_group_t *g)
+static void group_rebuild(dart_group_t g)
 {
   int i, n;
-  
+
   // rebuild the data structure, based only on the g2l array
   // if (g2l[i]>=0) then the unit with global id i is part
   // of the group.
   n = 0;
+  for (i = 0; i < MAXSIZE_GROUP; i++)
+    {
+      (g->l2g)[i] = -1;
+    }
   for (i = 0; i < MAXSIZE_GROUP; i++)
     {
       if ((g->g2l[i]) >= 0)
@@ -60,125 +94,237 @@ void group_rebuild(dart_group_t *g)
 	  n++;
 	}
     }
-  
+
   g->nmem = n;
 }
 
 
-dart_ret_t dart_group_union(const dart_group_t *g1,
-                            const dart_group_t *g2,
+dart_ret_t dart_group_union(const dart_group_t g1,
+                            const dart_group_t g2,
                             dart_group_t *gout)
 {
   int i;
-  
+
+  if (g1 == NULL || g2 == NULL) {
+    DART_LOG_ERROR("Invalid group argument: %p (g1), %p (g2)",
+                   (void*)g1, (void*)g2);
+    return DART_ERR_INVAL;
+  }
+
+  *gout = allocate_group();
   for (i = 0; i < MAXSIZE_GROUP; i++)
     {
-      (gout->g2l)[i] = -1;
       if ((g1->g2l)[i] >= 0 || (g2->g2l)[i] >= 0)
 	{
 	  // just set g2l[i] to 1 to indicate that i is a member
 	  // group_rebuild then updates the group data structure
-	  (gout->g2l)[i] = 1;
+	  ((*gout)->g2l)[i] = 1;
 	}
     }
-  
-  group_rebuild(gout);
+
+  group_rebuild(*gout);
   return DART_OK;
 }
 
 
-dart_ret_t dart_group_intersect(const dart_group_t *g1,
-                                const dart_group_t *g2,
+dart_ret_t dart_group_intersect(const dart_group_t g1,
+                                const dart_group_t g2,
                                 dart_group_t *gout)
 {
   int i;
-  
+
+  if (g1 == NULL || g2 == NULL) {
+    DART_LOG_ERROR("Invalid group argument: %p (g1), %p (g2)",
+                   (void*)g1, (void*)g2);
+    return DART_ERR_INVAL;
+  }
+
+  *gout = allocate_group();
   for (i = 0; i < MAXSIZE_GROUP; i++)
     {
-      (gout->g2l)[i] = -1;
       if ((g1->g2l)[i] >= 0 && (g2->g2l)[i] >= 0)
 	{
 	  // set to 1 to indicate that i is a member
 	  // group_rebuild then updates the group data structure
-	  (gout->g2l)[i] = 1;
+	  ((*gout)->g2l)[i] = 1;
 	}
     }
-  
-  group_rebuild(gout);
-  
+
+  group_rebuild(*gout);
+
   return DART_OK;
 }
 
-dart_ret_t dart_group_addmember(dart_group_t *g, int32_t unitid)
+dart_ret_t dart_group_addmember(dart_group_t g, dart_global_unit_t unitid)
 {
-  g->g2l[unitid] = 1;
+  CHECK_UNIT_ID(unitid);
+  g->g2l[unitid.id] = 1;
   group_rebuild(g);
 
   return DART_OK;
 }
 
-dart_ret_t dart_group_delmember(dart_group_t *g, int32_t unitid)
-{	
-  g->g2l[unitid] = -1;
+dart_ret_t dart_group_delmember(dart_group_t g, dart_global_unit_t unitid)
+{
+  CHECK_UNIT_ID(unitid);
+  g->g2l[unitid.id] = -1;
   group_rebuild(g);
-  
+
   return DART_OK;
 }
 
-dart_ret_t dart_group_ismember(const dart_group_t *g, 
-			       int32_t unitid, int32_t *ismember)
+dart_ret_t dart_group_ismember(const dart_group_t g,
+			       dart_global_unit_t unitid, int32_t *ismember)
 {
-  (*ismember) = ((g->g2l)[unitid] >= 0);
-  
+  if (unitid.id < 0 || unitid.id >= MAXSIZE_GROUP) {
+    (*ismember) = 0;
+    return DART_OK;
+  }
+  (*ismember) = ((g->g2l)[unitid.id] >= 0);
+
   return DART_OK;
 }
 
-dart_ret_t dart_group_size(const dart_group_t *g, size_t *size)
+dart_ret_t dart_group_size(const dart_group_t g, size_t *size)
 {
+  if (g == NULL) {
+    DART_LOG_ERROR("Invalid group argument");
+    return DART_ERR_INVAL;
+  }
   (*size) = g->nmem;
   return DART_OK;
 }
 
-dart_ret_t dart_group_getmembers(const dart_group_t *g, int32_t *unitids)
+dart_ret_t dart_group_getmembers(const dart_group_t g,
+				 dart_global_unit_t *unitids)
 {
   int i, j;
-  
+
   j=0;
   for (i = 0; i < MAXSIZE_GROUP; i++) {
     if( ((g->g2l)[i] >= 0) ) {
-      unitids[j]=i; j++;
+      unitids[j].id=i; j++;
     }
   }
 
   return DART_OK;
 }
 
-dart_ret_t dart_group_split(const dart_group_t *g, size_t nsplits,
-                            dart_group_t **gsplit)
+dart_ret_t dart_group_split(const dart_group_t g, size_t nsplits,
+                            size_t *nout, dart_group_t *gsplit)
 {
-  int i, j, k;
-  int nmem = (g->nmem);
-  int bdiv = nmem / nsplits;
-  int brem = nmem % nsplits;
-  int bsize;
-  
+  size_t i, j, k;
+  size_t nmem = (g->nmem);
+
+  if (nsplits == 0) {
+    DART_LOG_ERROR("dart_group_split: number of splits must be positive");
+    return DART_ERR_INVAL;
+  }
+
+  // ceiling division, trailing groups may be empty
+  size_t bsize = (nmem + nsplits - 1) / nsplits;
+
+  *nout = (nmem < nsplits) ? nmem : nsplits;
+
   j = 0;
   for (i = 0; i < nsplits; i++)
     {
-      bsize = (i < brem) ? (bdiv + 1) : bdiv;
-      dart_group_create(gsplit[i]);
+      gsplit[i] = allocate_group();
 
       for (k = 0; (k < bsize) && (j < nmem); k++, j++)
 	{
-	  //fprintf(stderr, "%d %d %d -- %d\n", i, j, k, g->l2g[j]);
 	  (gsplit[i]->g2l)[g->l2g[j]] = 1;
 	}
-      
+
       group_rebuild(gsplit[i]);
     }
-  
+
   return DART_OK;
 }
 
+dart_ret_t dart_group_locality_split(
+  const dart_group_t        group,
+  dart_domain_locality_t  * domain,
+  dart_locality_scope_t     scope,
+  size_t                    num_groups,
+  size_t                  * nout,
+  dart_group_t            * gout)
+{
+  DART_LOG_TRACE("dart_group_locality_split: split at scope %d", scope);
+
+  dart_team_t team = domain->team;
+
+  if (group == NULL) {
+    DART_LOG_ERROR("Invalid group argument: %p", (void*)group);
+    return DART_ERR_INVAL;
+  }
+
+  /* query domain tags of all domains in specified scope: */
+  int     num_domains;
+  char ** domain_tags;
+  DART_ASSERT_RETURNS(
+    dart_domain_scope_tags(
+      domain,
+      scope,
+      &num_domains,
+      &domain_tags),
+    DART_OK);
 
+  DART_LOG_TRACE("dart_group_locality_split: %d domains at scope %d",
+                 num_domains, scope);
 
+  /* Splitting into more groups than domains not supported: */
+  if (num_groups > (size_t)num_domains) {
+    num_groups = num_domains;
+  }
+  *nout = num_groups;
+  if (num_groups == 0) {
+    DART_LOG_ERROR("num_groups has to be greater than 0");
+    free(domain_tags);
+    return DART_ERR_OTHER;
+  }
+
+  dart_domain_locality_t ** domains = malloc(num_domains * sizeof(*domains));
+  for (int d = 0; d < num_domains; ++d) {
+    DART_ASSERT_RETURNS(
+      dart_domain_team_locality(team, domain_tags[d], &domains[d]),
+      DART_OK);
+  }
+
+  /* assign consecutive domains to every group: */
+  int max_group_domains = (num_domains + (num_groups-1)) / num_groups;
+  for (size_t g = 0; g < num_groups; ++g) {
+    int first_dom_idx = g * max_group_domains;
+    int last_dom_idx  = first_dom_idx + max_group_domains;
+    if (last_dom_idx > num_domains) {
+      last_dom_idx = num_domains;
+    }
+
+    int group_num_units = 0;
+    for (int d = first_dom_idx; d < last_dom_idx; ++d) {
+      group_num_units += domains[d]->num_units;
+    }
+    if (group_num_units <= 0) {
+      DART_LOG_DEBUG("dart_group_locality_split: no units in group %zu", g);
+      gout[g] = NULL;
+      continue;
+    }
+
+    gout[g] = allocate_group();
+    for (int d = first_dom_idx; d < last_dom_idx; ++d) {
+      for (int du = 0; du < domains[d]->num_units; ++du) {
+        int unit = domains[d]->unit_ids[du].id;
+        if (0 <= unit && unit < MAXSIZE_GROUP && (group->g2l)[unit] >= 0) {
+          (gout[g]->g2l)[unit] = 1;
+        }
+      }
+    }
+    group_rebuild(gout[g]);
+  }
+
+  free(domains);
+  free(domain_tags);
+
+  DART_LOG_TRACE("dart_group_locality_split >");
+  return DART_OK;
+}
@@ -1,11 +1,14 @@
 
+#include <stdlib.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/locality.h>
+
 #include <dash/dart/if/dart.h>
 #include <dash/dart/if/dart_initialization.h>
 #include <dash/dart/shmem/dart_shmem.h>
 #include <dash/dart/shmem/dart_init_shmem.h>
 
-char dart_initialized();
-
 dart_ret_t dart_init(int *argc, char ***argv)
 {
   if (dart_initialized()) {
@@ -19,16 +22,35 @@ dart_ret_t dart_init(int *argc, char ***argv)
     return DART_ERR_INVAL;
   }
 
-  if( _glob_state!=DART_STATE_NOT_INITIALIZED ) {
+  // DART may be initialized again after dart_exit
+  if( _glob_state==DART_STATE_INITIALIZED ) {
     return DART_ERR_INVAL;
-  }  
+  }
 
   ret =  dart_init_shmem(argc, argv);
 
   _glob_state = DART_STATE_INITIALIZED;
+
+  if (ret == DART_OK) {
+    ret = dart__base__locality__init();
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart_init ! dart__base__locality__init failed: %d",
+                     ret);
+    }
+  }
   return ret;
 }
 
+dart_ret_t dart_init_thread(
+  int                         * argc,
+  char                      *** argv,
+  dart_thread_support_level_t * provided)
+{
+  // concurrent calls into the backend are not supported
+  *provided = DART_THREAD_SINGLE;
+  return dart_init(argc, argv);
+}
+
 dart_ret_t dart_exit()
 {
   if (!dart_initialized()) {
@@ -40,17 +62,28 @@ dart_ret_t dart_exit()
 
   if( _glob_state!=DART_STATE_INITIALIZED ) {
     return DART_ERR_INVAL;
-  }  
-  
+  }
+
+  dart__base__locality__finalize();
+
   dart_barrier(DART_TEAM_ALL);
-  
+
   ret = dart_exit_shmem();
 
   _glob_state = DART_STATE_FINALIZED;
   return ret;
 }
 
-char dart_initialized()
+bool dart_initialized()
 {
   return _glob_state == DART_STATE_INITIALIZED;
 }
+
+void dart_abort(int errorcode)
+{
+  DART_LOG_INFO("dart_abort: aborting DART run with error code %i",
+                errorcode);
+  // dartrun terminates the remaining units once a unit exits
+  // without finalizing DART
+  exit(errorcode != 0 ? errorcode : EXIT_FAILURE);
+}
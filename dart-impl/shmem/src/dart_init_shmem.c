@@ -15,6 +15,9 @@
 
 #include <dash/dart/shmem/dart_shmem.h>
 #include <dash/dart/shmem/dart_teams_impl.h>
+#include <dash/dart/shmem/dart_malloc.h>
+#include <dash/dart/shmem/dart_memarea.h>
+#include <dash/dart/shmem/dart_types_impl.h>
 #include <dash/dart/shmem/shmem_mm_if.h>
 #include <dash/dart/shmem/shmem_logger.h>
 #include <dash/dart/shmem/shmem_barriers_if.h>
@@ -28,67 +31,92 @@ int _glob_size=-1;
 int _glob_state=DART_STATE_NOT_INITIALIZED;
 
 
+// the shared memory id of the sync area, kept for subsequent
+// initializations after dart_exit
+static int _glob_shmid=-1;
+
 int dart_init_shmem(int *argc, char ***argv)
 {
   int i;
   int itmp; size_t stmp;
-  size_t syncarea_size;
   int myid = -1;
   int team_size = -1;
   int shm_id = -1;
 
-  DEBUG("dart_init parsing args... %s", "");
-  for (i = 0; i < (*argc); i++)   {
-    if (sscanf((*argv)[i], "--dart-id=%d", &itmp) > 0) {
-      myid = itmp;
-      DEBUG("dart_init got %d for --dart-id", myid);
-      _glob_myid=myid;
+  if (_glob_shmid >= 0) {
+    // re-initialization, the DART args have been consumed before
+    // and the sync area is still attached
+    myid      = _glob_myid;
+    team_size = _glob_size;
+    DEBUG("dart_init re-initializing unit %d", myid);
+  } else {
+    // argv may have been shortened by other argument parsers
+    // without updating argc
+    int nargs = 0;
+    while (nargs < (*argc) && (*argv)[nargs] != NULL) {
+      nargs++;
     }
-    
-    if (sscanf((*argv)[i], "--dart-size=%d", &itmp) > 0) {
-      team_size = itmp;
-      DEBUG("dart_init got %d for --dart-size", team_size);
-      _glob_size=team_size;
-    }  
-
-    if (sscanf((*argv)[i], "--dart-syncarea_id=%d", &itmp) > 0) {
-      shm_id = itmp;
-      DEBUG("dart_init got %d for --dart-syncarea_id", shm_id);
+
+    DEBUG("dart_init parsing args... %s", "");
+    for (i = 0; i < nargs; i++)   {
+      if (sscanf((*argv)[i], "--dart-id=%d", &itmp) > 0) {
+        myid = itmp;
+        DEBUG("dart_init got %d for --dart-id", myid);
+        _glob_myid=myid;
+      }
+
+      if (sscanf((*argv)[i], "--dart-size=%d", &itmp) > 0) {
+        team_size = itmp;
+        DEBUG("dart_init got %d for --dart-size", team_size);
+        _glob_size=team_size;
+      }
+
+      if (sscanf((*argv)[i], "--dart-syncarea_id=%d", &itmp) > 0) {
+        shm_id = itmp;
+        DEBUG("dart_init got %d for --dart-syncarea_id", shm_id);
+      }
+
+      if (sscanf((*argv)[i], "--dart-syncarea_size=%zu", &stmp) > 0) {
+        DEBUG("dart_init got %zu for --dart-syncarea_size", stmp);
+      }
     }
-    
-    if (sscanf((*argv)[i], "--dart-syncarea_size=%zu", &stmp) > 0) {
-      syncarea_size = stmp;
-      DEBUG("dart_init got %d for --dart-syncarea_size", 
-	    syncarea_size);
+
+    if (myid < 0 || team_size < 1)  {
+      fprintf(stderr, "ABORT: This program must be started with dartrun!\n");
+      fprintf(stderr, "\n");
+      exit(1);
+      //    return DART_ERR_OTHER;
     }
-  }
 
-  if (myid < 0 || team_size < 1)  {
-    fprintf(stderr, "ABORT: This program must be started with dartrun!\n");
-    fprintf(stderr, "\n");
-    exit(1);
-    //    return DART_ERR_OTHER;
+    // DART args are passed at the end
+    *argc = nargs - NUM_DART_ARGS;
+    (*argv)[*argc] = NULL;
+
+    DEBUG("dart_init attaching shm %d...", shm_id);
+    void* syncarea = shmem_mm_attach(shm_id);
+    DEBUG("dart_init attached to %p", syncarea);
+
+    DEBUG("dart_init initializing interal sync area...%s", "");
+    shmem_syncarea_setaddr(syncarea);
+    _glob_shmid = shm_id;
   }
-  
-  // DART args are passed at the end
-  *argc -= NUM_DART_ARGS;
-  (*argv)[*argc] = NULL;
-  
-  DEBUG("dart_init attaching shm %d...", shm_id);
-  void* syncarea = shmem_mm_attach(shm_id);
-  DEBUG("dart_init attached to %p", syncarea);
-
-  DEBUG("dart_init initializing interal sync area...%s", "");
-  shmem_syncarea_setaddr(syncarea);
-
-  // we can pass a zero pointer as a group 
-  // spec, because dart_shmem_team_init will 
+
+  shmem_syncarea_setunitstate(myid, UNIT_STATE_INITIALIZED);
+
+  // the basic types are used by all communication routines
+  dart__shmem__datatype_init();
+
+  // we can pass a zero pointer as a group
+  // spec, because dart_shmem_team_init will
   // take care of initializing the group for
   // dart_team_all!
   assert(DART_TEAM_ALL==0);
-  dart_shmem_team_init(DART_TEAM_ALL,
-		       myid, team_size,
-		       0);
+  if (dart_shmem_team_init(DART_TEAM_ALL,
+			   myid, team_size,
+			   0) != DART_OK) {
+    fprintf(stderr, "ABORT: Failed to initialize DART_TEAM_ALL\n");
+    exit(1);
+  }
 
   DART_SAFE(dart_barrier(DART_TEAM_ALL));
 
@@ -105,28 +133,38 @@ int dart_init_shmem(int *argc, char ***argv)
 dart_ret_t dart_exit_shmem()
 {
   size_t tsize;
-  dart_unit_t myid;
+  dart_global_unit_t myid;
 
   DEBUG("in dart_exit_shmem%s", "");
   dart_size(&tsize);
   dart_myid(&myid);
-    
+
   assert(DART_TEAM_ALL==0);
   DART_SAFE(dart_barrier(DART_TEAM_ALL));
 
+  dart_shmem_localpool_fini(myid.id);
+  dart_memarea_fini();
+  if (myid.id == 0) {
+    // all units passed the barrier above, release the segment ids
+    // so that a subsequent dart_init starts with a clean sync area
+    int i;
+    for (i = 0; i < MAXNUM_MEMPOOLS; i++) {
+      shmem_syncarea_delpool(i);
+    }
+  }
+
   DART_SAFE(
 	    dart_shmem_team_delete(DART_TEAM_ALL,
-				   myid, tsize)
+				   myid.id, tsize)
 	    );
 
-  shmem_syncarea_setunitstate(myid, 
+  shmem_syncarea_setunitstate(myid.id,
 			      UNIT_STATE_CLEAN_EXIT);
 
-  dart_work_queue_shutdown();
-  
 #ifdef USE_HELPER_THREAD
+  dart_work_queue_shutdown();
   pthread_join(_helper_thread, 0);
-#endif 
+#endif
 
 
   /* KF
@@ -1,6 +1,11 @@
 
+#include <errno.h>
 #include <pthread.h>
+#include <sched.h>
+
+#include <dash/dart/base/logging.h>
 #include <dash/dart/if/dart_types.h>
+#include <dash/dart/if/dart_communication.h>
 
 #include <dash/dart/shmem/dart_locks.h>
 #include <dash/dart/shmem/dart_teams_impl.h>
@@ -8,17 +13,22 @@
 #include <dash/dart/shmem/shmem_logger.h>
 
 
-/* collective call, all members of the team have to call 
+/* collective call, all members of the team have to call
    this function to initialize a lock */
-dart_ret_t dart_team_lock_init(dart_team_t teamid, 
+dart_ret_t dart_team_lock_init(dart_team_t teamid,
 			       dart_lock_t* lock)
 {
-  int lockid;
+  int lockid = MAXNUM_LOCKS;
   syncarea_t area;
-  dart_unit_t myid;
-  dart_team_myid(teamid, &myid);
+  dart_team_unit_t myid;
+
+  *lock = NULL;
+  if( dart_team_myid(teamid, &myid)!=DART_OK ) {
+    DART_LOG_ERROR("dart_team_lock_init ! Unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
 
-  if( myid==0 ) {
+  if( myid.id==0 ) {
     area = shmem_getsyncarea();
     PTHREAD_SAFE_NORET(pthread_mutex_lock(&(area->barrier_lock)));
 
@@ -29,44 +39,42 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid,
 	break;
       }
     }
-    
+
     PTHREAD_SAFE_NORET(pthread_mutex_unlock(&(area->barrier_lock)));
   }
-  dart_bcast(&lockid, sizeof(int), 0, teamid);
+  dart_bcast(&lockid, sizeof(int), DART_TYPE_BYTE,
+	     DART_TEAM_UNIT_ID(0), teamid);
 
-  if( lockid==MAXNUM_LOCKS ) 
+  if( lockid==MAXNUM_LOCKS )
     return DART_ERR_OTHER;
-  
+
   (*lock) = &(shmem_getsyncarea()->locks[lockid]);
-  
+
   return DART_OK;
 }
 
-/* collective call, all members of the team have to call 
+/* collective call, all members of the team have to call
    this function to free a lock */
-dart_ret_t dart_team_lock_free(dart_team_t teamid,
-			       dart_lock_t* lock)
+dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 {
-  int lockid;
   syncarea_t area;
-  dart_unit_t myid;
+  dart_team_unit_t myid;
+
+  if( !lock || !(*lock) ) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_t teamid = (*lock)->teamid;
   dart_team_myid(teamid, &myid);
-  
-  if( myid==0 ) {
+
+  dart_barrier(teamid);
+  if( myid.id==0 ) {
     area = shmem_getsyncarea();
     PTHREAD_SAFE_NORET(pthread_mutex_lock(&(area->barrier_lock)));
-
-    for( lockid=0; lockid<MAXNUM_LOCKS; lockid++ ) {
-      if( (*lock)==&(area->locks[lockid]) ) {
-	(area->locks[lockid]).inuse=0;
-	break;
-      }
-    }
-    
+    (*lock)->inuse=0;
     PTHREAD_SAFE_NORET(pthread_mutex_unlock(&(area->barrier_lock)));
   }
-  dart_barrier(teamid);
-  
+  *lock = NULL;
+
   return DART_OK;
 }
 
@@ -74,7 +82,6 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
 {
   pthread_mutex_t *plock;
   plock = &(lock->mutex);
-  //fprintf(stderr, "locking %p\n", plock);
   PTHREAD_SAFE(pthread_mutex_lock(plock));
   return DART_OK;
 }
@@ -83,27 +90,204 @@ dart_ret_t dart_lock_release(dart_lock_t lock)
 {
   pthread_mutex_t *plock;
   plock = &(lock->mutex);
-  //fprintf(stderr, "unlocking %p ...\n", plock);
   PTHREAD_SAFE(pthread_mutex_unlock(plock));
   return DART_OK;
 }
 
 
-dart_ret_t dart_lock_try_acquire(dart_lock_t lock, 
+dart_ret_t dart_lock_try_acquire(dart_lock_t lock,
 				 int32_t *result)
 {
   pthread_mutex_t *plock;
   plock = &(lock->mutex);
-  
+
   int ret = pthread_mutex_trylock(plock);
 
   if( ret==0 ) {
     (*result)=1;
     return DART_OK;
+  } else if( ret==EBUSY ) {
+    (*result)=0;
+    return DART_OK;
   } else {
     (*result)=0;
     return DART_ERR_OTHER;
   }
 }
 
+/* the number of times this unit holds each reader-writer lock
+   in shared mode and whether it holds it in exclusive mode,
+   indexed by the slot of the lock in the sync area */
+static int32_t _rwlock_readers[MAXNUM_LOCKS];
+static int32_t _rwlock_acquired[MAXNUM_LOCKS];
+
+static inline int rwlock_slot(dart_rwlock_t lock)
+{
+  return (int)(lock - shmem_getsyncarea()->rwlocks);
+}
+
+static int rwlock_try_enter_shared(dart_rwlock_t lock)
+{
+  // announce the reader before checking for a writer, the writer
+  // sets its flag before checking for readers
+  __sync_fetch_and_add(&(lock->readers), 1);
+  if( __atomic_load_n(&(lock->writer), __ATOMIC_SEQ_CST)==0 ) {
+    return 1;
+  }
+  __sync_fetch_and_sub(&(lock->readers), 1);
+  return 0;
+}
+
+/* collective call, all members of the team have to call
+   this function to initialize a reader-writer lock */
+dart_ret_t dart_team_rwlock_init(dart_team_t teamid,
+				 dart_rwlock_t* lock)
+{
+  int lockid = MAXNUM_LOCKS;
+  syncarea_t area;
+  dart_team_unit_t myid;
+
+  *lock = NULL;
+  if( dart_team_myid(teamid, &myid)!=DART_OK ) {
+    DART_LOG_ERROR("dart_team_rwlock_init ! Unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if( myid.id==0 ) {
+    area = shmem_getsyncarea();
+    PTHREAD_SAFE_NORET(pthread_mutex_lock(&(area->barrier_lock)));
+
+    for( lockid=0; lockid<MAXNUM_LOCKS; lockid++ ) {
+      if( !(area->rwlocks[lockid]).inuse ) {
+	(area->rwlocks[lockid]).inuse=1;
+	(area->rwlocks[lockid]).teamid=teamid;
+	(area->rwlocks[lockid]).writer=0;
+	(area->rwlocks[lockid]).readers=0;
+	break;
+      }
+    }
+
+    PTHREAD_SAFE_NORET(pthread_mutex_unlock(&(area->barrier_lock)));
+  }
+  dart_bcast(&lockid, sizeof(int), DART_TYPE_BYTE,
+	     DART_TEAM_UNIT_ID(0), teamid);
+
+  if( lockid==MAXNUM_LOCKS )
+    return DART_ERR_OTHER;
+
+  _rwlock_readers[lockid]  = 0;
+  _rwlock_acquired[lockid] = 0;
+  (*lock) = &(shmem_getsyncarea()->rwlocks[lockid]);
+
+  return DART_OK;
+}
+
+/* collective call, all members of the team have to call
+   this function to free a reader-writer lock */
+dart_ret_t dart_team_rwlock_destroy(dart_rwlock_t* lock)
+{
+  syncarea_t area;
+  dart_team_unit_t myid;
+
+  if( !lock || !(*lock) ) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_t teamid = (*lock)->teamid;
+  dart_team_myid(teamid, &myid);
+
+  dart_barrier(teamid);
+  if( myid.id==0 ) {
+    area = shmem_getsyncarea();
+    PTHREAD_SAFE_NORET(pthread_mutex_lock(&(area->barrier_lock)));
+    (*lock)->inuse=0;
+    PTHREAD_SAFE_NORET(pthread_mutex_unlock(&(area->barrier_lock)));
+  }
+  *lock = NULL;
+
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_acquire(dart_rwlock_t lock)
+{
+  // serialize with other units acquiring the lock in exclusive mode
+  PTHREAD_SAFE(pthread_mutex_lock(&(lock->writer_lock)));
+
+  // block new readers and wait for the active readers to leave
+  __atomic_store_n(&(lock->writer), 1, __ATOMIC_SEQ_CST);
+  while( __atomic_load_n(&(lock->readers), __ATOMIC_SEQ_CST)>0 ) {
+    sched_yield();
+  }
+  _rwlock_acquired[rwlock_slot(lock)] = 1;
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire(dart_rwlock_t lock,
+				   int32_t *result)
+{
+  *result = 0;
+  int ret = pthread_mutex_trylock(&(lock->writer_lock));
+  if( ret==EBUSY ) {
+    return DART_OK;
+  } else if( ret!=0 ) {
+    return DART_ERR_OTHER;
+  }
+
+  __atomic_store_n(&(lock->writer), 1, __ATOMIC_SEQ_CST);
+  if( __atomic_load_n(&(lock->readers), __ATOMIC_SEQ_CST)>0 ) {
+    // readers are active, give up
+    __atomic_store_n(&(lock->writer), 0, __ATOMIC_SEQ_CST);
+    PTHREAD_SAFE(pthread_mutex_unlock(&(lock->writer_lock)));
+    return DART_OK;
+  }
+  _rwlock_acquired[rwlock_slot(lock)] = 1;
+  *result = 1;
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release(dart_rwlock_t lock)
+{
+  int slot = rwlock_slot(lock);
+  if( !_rwlock_acquired[slot] ) {
+    DART_LOG_ERROR("dart_rwlock_release ! Lock has not been acquired");
+    return DART_ERR_INVAL;
+  }
+  _rwlock_acquired[slot] = 0;
+  __atomic_store_n(&(lock->writer), 0, __ATOMIC_SEQ_CST);
+  PTHREAD_SAFE(pthread_mutex_unlock(&(lock->writer_lock)));
+  return DART_OK;
+}
 
+dart_ret_t dart_rwlock_acquire_shared(dart_rwlock_t lock)
+{
+  while( !rwlock_try_enter_shared(lock) ) {
+    // wait until the writer has released the lock
+    while( __atomic_load_n(&(lock->writer), __ATOMIC_SEQ_CST)!=0 ) {
+      sched_yield();
+    }
+  }
+  _rwlock_readers[rwlock_slot(lock)]++;
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_try_acquire_shared(dart_rwlock_t lock,
+					  int32_t *result)
+{
+  *result = rwlock_try_enter_shared(lock);
+  if( *result ) {
+    _rwlock_readers[rwlock_slot(lock)]++;
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_rwlock_release_shared(dart_rwlock_t lock)
+{
+  int slot = rwlock_slot(lock);
+  if( _rwlock_readers[slot]==0 ) {
+    DART_LOG_ERROR("dart_rwlock_release_shared ! "
+		   "Lock has not been acquired");
+    return DART_ERR_INVAL;
+  }
+  _rwlock_readers[slot]--;
+  __sync_fetch_and_sub(&(lock->readers), 1);
+  return DART_OK;
+}
@@ -1,3 +1,7 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <dash/dart/base/logging.h>
 
 #include <dash/dart/if/dart.h>
 
@@ -5,106 +9,322 @@
 #include <dash/dart/shmem/dart_memarea.h>
 #include <dash/dart/shmem/dart_mempool.h>
 #include <dash/dart/shmem/dart_teams_impl.h>
+#include <dash/dart/shmem/dart_types_impl.h>
+#include <dash/dart/shmem/shmem_barriers_if.h>
+#include <dash/dart/shmem/shmem_mm_if.h>
 #include <dash/dart/shmem/shmem_logger.h>
 
-/* TO IMPLEMENT */
+// the segment id of the pool serving dart_memalloc
+#define LOCALPOOL_ID  DART_SEGMENT_LOCAL
+
+// alignment of allocations in the local pool
+#define LOCALPOOL_ALIGN 16
+
+size_t dart_shmem_localpool_size()
+{
+  size_t size = DART_LOCAL_ALLOC_SIZE_DEFAULT;
+  const char *envstr = getenv(DART_LOCAL_ALLOC_SIZE_ENVSTR);
+  if (envstr != NULL) {
+    char *end;
+    unsigned long long value = strtoull(envstr, &end, 10);
+    switch (*end) {
+      case 'G': case 'g': value <<= 10; /* fall-through */
+      case 'M': case 'm': value <<= 10; /* fall-through */
+      case 'K': case 'k': value <<= 10; break;
+      default: break;
+    }
+    if (value == 0) {
+      DART_LOG_WARN("Ignoring invalid value of %s: %s",
+                    DART_LOCAL_ALLOC_SIZE_ENVSTR, envstr);
+    } else {
+      size = (size_t)value;
+    }
+  }
+  return size;
+}
+
 /*
-dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void *addr);
-dart_ret_t dart_gptr_setaddr(dart_gptr_t *gptr, void *addr);
-dart_ret_t dart_gptr_setunit(dart_gptr_t *gptr, dart_unit_t);
+ * The part of every unit in the local pool is extended by
+ * segments created on demand. The offsets of allocations form
+ * a contiguous range per unit: offsets below the size L of the
+ * unit's part in the pool refer to the pool, chunk k >= 1 covers
+ * the offsets [L*2^(k-1), L*2^k).
+ */
 
-dart_ret_t dart_memfree(dart_gptr_t gptr);
+// addresses of the chunks of all units attached by this unit
+static char *_localpool_chunks[MAXNUM_UNITS][NUM_LOCALPOOL_CHUNKS];
 
-dart_ret_t dart_team_memalloc_aligned(dart_team_t teamid,
-              size_t nbytes, dart_gptr_t *gptr);
-dart_ret_t dart_team_memfree(dart_team_t teamid, dart_gptr_t gptr);
-*/
+// allocators of the chunks created by this unit
+static dart_membucket _localpool_buckets[NUM_LOCALPOOL_CHUNKS];
 
-dart_ret_t dart_gptr_getaddr(
-  const dart_gptr_t gptr,
-  void **addr) {
-  int  poolid;
+static inline size_t chunk_begin(size_t localsz, int chunk)
+{
+  return (chunk == 0) ? 0 : (localsz << (chunk - 1));
+}
+
+static inline size_t chunk_size(size_t localsz, int chunk)
+{
+  return (chunk == 0) ? localsz : (localsz << (chunk - 1));
+}
+
+static int chunk_of(size_t localsz, uint64_t offset)
+{
+  int chunk = 0;
+  while (chunk < NUM_LOCALPOOL_CHUNKS &&
+         offset >= chunk_begin(localsz, chunk) + chunk_size(localsz, chunk)) {
+    chunk++;
+  }
+  return chunk;
+}
+
+// address of a chunk of 'unit', attaching it on first access
+static char * chunk_addr(dart_unit_t unit, int chunk)
+{
+  if (unit < 0 || unit >= MAXNUM_UNITS ||
+      chunk <= 0 || chunk >= NUM_LOCALPOOL_CHUNKS) {
+    return NULL;
+  }
+  if (_localpool_chunks[unit][chunk] == NULL) {
+    int shmid = __atomic_load_n(
+                  &(shmem_getsyncarea()->localpool_chunks[unit][chunk]),
+                  __ATOMIC_ACQUIRE);
+    if (shmid < 0) {
+      return NULL;
+    }
+    _localpool_chunks[unit][chunk] = shmem_mm_attach(shmid);
+  }
+  return _localpool_chunks[unit][chunk];
+}
+
+static dart_ret_t create_chunk(size_t localsz, dart_unit_t myid, int chunk)
+{
+  size_t size  = chunk_size(localsz, chunk);
+  int    shmid = shmem_mm_create(size);
+  char * addr  = shmem_mm_attach(shmid);
+  // segments marked for removal can still be attached on Linux,
+  // the memory is released once the last unit detached from it
+  shmem_mm_destroy(shmid);
+
+  _localpool_chunks[myid][chunk] = addr;
+  _localpool_buckets[chunk]      = dart_membucket_create(addr, size);
+  __atomic_store_n(&(shmem_getsyncarea()->localpool_chunks[myid][chunk]),
+                   shmid, __ATOMIC_RELEASE);
+  DEBUG("dart_memalloc: created chunk %d of %zu bytes", chunk, size);
+  return DART_OK;
+}
+
+// resolves an offset in the local pool of 'unit'
+static dart_ret_t localpool_addr(
+  dart_mempoolptr pool,
+  dart_unit_t     unit,
+  uint64_t        offset,
+  char         ** addr)
+{
+  if (offset < pool->localsz) {
+    *addr = ((char*)pool->base_addr) + unit * pool->localsz + offset;
+    return DART_OK;
+  }
+  int    chunk = chunk_of(pool->localsz, offset);
+  char * base  = chunk_addr(unit, chunk);
+  if (base == NULL) {
+    DART_LOG_ERROR("Invalid offset %lu in local memory of unit %d",
+                   (unsigned long)offset, unit);
+    return DART_ERR_INVAL;
+  }
+  *addr = base + (offset - chunk_begin(pool->localsz, chunk));
+  return DART_OK;
+}
+
+void dart_shmem_localpool_fini(dart_unit_t myid)
+{
+  int unit, chunk;
+  for (chunk = 1; chunk < NUM_LOCALPOOL_CHUNKS; chunk++) {
+    if (_localpool_buckets[chunk] != DART_MEMBUCKET_NULL) {
+      dart_membucket_destroy(_localpool_buckets[chunk]);
+      _localpool_buckets[chunk] = DART_MEMBUCKET_NULL;
+      shmem_getsyncarea()->localpool_chunks[myid][chunk] = -1;
+    }
+  }
+  for (unit = 0; unit < MAXNUM_UNITS; unit++) {
+    for (chunk = 1; chunk < NUM_LOCALPOOL_CHUNKS; chunk++) {
+      if (_localpool_chunks[unit][chunk] != NULL) {
+        shmem_mm_detach(_localpool_chunks[unit][chunk]);
+        _localpool_chunks[unit][chunk] = NULL;
+      }
+    }
+  }
+}
+
+/*
+ * Base address of the memory of team-relative unit 'unit' in
+ * the mempool 'pool' in the address space of the calling unit.
+ */
+static dart_ret_t pool_unit_base(
+  dart_mempoolptr pool,
+  dart_unit_t     unit,
+  char         ** base)
+{
+  if (unit < 0 || (size_t)unit >= pool->teamsize) {
+    DART_LOG_ERROR("Invalid unit %d in segment of team %d",
+                   unit, pool->teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (pool->state == MEMPOOL_REGISTERED) {
+    const struct dart_mempool_regentry *entry = &(pool->regtab[unit]);
+    if (entry->poolid < 0) {
+      // the unit registered an empty memory range
+      *base = NULL;
+      return DART_OK;
+    }
+    dart_mempoolptr mem = dart_memarea_get_mempool_by_id(entry->poolid);
+    if (!mem) {
+      DART_LOG_ERROR("Memory registered by unit %d is located in segment "
+                     "%d which is not accessible by this unit",
+                     unit, entry->poolid);
+      return DART_ERR_INVAL;
+    }
+    if (entry->poolid == LOCALPOOL_ID) {
+      return localpool_addr(mem, entry->unit, entry->offset, base);
+    }
+    *base = ((char*)mem->base_addr) + entry->unit * mem->localsz
+                                    + entry->offset;
+    return DART_OK;
+  }
+
+  *base = ((char*)pool->base_addr) + unit * pool->localsz;
+  return DART_OK;
+}
+
+dart_ret_t dart_shmem_gptr_addr(
+  dart_gptr_t   gptr,
+  void       ** addr)
+{
   char *base;
-  void *ptr;
-  dart_mempoolptr pool;
-  poolid = gptr.segid;
-  pool = dart_memarea_get_mempool_by_id(poolid);
+  dart_mempoolptr pool = dart_memarea_get_mempool_by_id(gptr.segid);
   if (!pool) {
-    return DART_ERR_OTHER;
+    DART_LOG_ERROR("Unknown segment %d", gptr.segid);
+    return DART_ERR_INVAL;
   }
-  base    = ((char*)pool->localbase_addr);
-  ptr     = base + gptr.addr_or_offs.offset;
-  (*addr) = ptr;
+  if (gptr.segid == LOCALPOOL_ID) {
+    return localpool_addr(pool, gptr.unitid, gptr.addr_or_offs.offset,
+                          (char**)addr);
+  }
+  dart_ret_t ret = pool_unit_base(pool, gptr.unitid, &base);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  (*addr) = base + gptr.addr_or_offs.offset;
   return DART_OK;
 }
 
+uint64_t dart_shmem_gptr_key(dart_gptr_t gptr)
+{
+  return ((uint64_t)(uint16_t)gptr.segid << 48) ^
+         ((uint64_t)(uint32_t)gptr.unitid << 32) ^
+         gptr.addr_or_offs.offset;
+}
+
+dart_ret_t dart_gptr_getaddr(
+  const dart_gptr_t gptr,
+  void **addr) {
+  dart_team_unit_t myid;
+  if (dart_team_myid(gptr.teamid, &myid) != DART_OK) {
+    DART_LOG_ERROR("dart_gptr_getaddr ! Unknown team %d", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+  if (myid.id != gptr.unitid) {
+    (*addr) = NULL;
+    return DART_OK;
+  }
+  return dart_shmem_gptr_addr(gptr, addr);
+}
+
+dart_ret_t dart_gptr_getaddr_shared(
+  const dart_gptr_t gptr,
+  void **addr) {
+  // all units share the memory pools
+  return dart_shmem_gptr_addr(gptr, addr);
+}
+
 dart_ret_t dart_gptr_setaddr(
   dart_gptr_t *gptr,
   void *addr) {
-  int   poolid;
   char  *base;
+  dart_team_unit_t myid;
   dart_mempoolptr pool;
   if (!gptr) {
     return DART_ERR_INVAL;
   }
-  poolid = gptr->segid;
-  pool = dart_memarea_get_mempool_by_id(poolid);
+  pool = dart_memarea_get_mempool_by_id(gptr->segid);
   if (!pool) {
-    return DART_ERR_OTHER;
+    DART_LOG_ERROR("dart_gptr_setaddr ! Unknown segment %d", gptr->segid);
+    return DART_ERR_INVAL;
+  }
+  dart_team_myid(gptr->teamid, &myid);
+  if (pool_unit_base(pool, myid.id, &base) != DART_OK) {
+    return DART_ERR_INVAL;
+  }
+  if (gptr->segid == LOCALPOOL_ID &&
+      ((char*)addr < base || (char*)addr >= base + pool->localsz)) {
+    int chunk;
+    for (chunk = 1; chunk < NUM_LOCALPOOL_CHUNKS; chunk++) {
+      char *cbase = _localpool_chunks[myid.id][chunk];
+      if (cbase != NULL && cbase <= (char*)addr &&
+          (char*)addr < cbase + chunk_size(pool->localsz, chunk)) {
+        gptr->addr_or_offs.offset = chunk_begin(pool->localsz, chunk) +
+                                    ((char*)(addr) - cbase);
+        return DART_OK;
+      }
+    }
   }
-  base = (char*)(pool->base_addr);
   gptr->addr_or_offs.offset = ((char*)(addr) - base);
   return DART_OK;
 }
 
-dart_ret_t dart_gptr_setunit(
-  dart_gptr_t *gptr,
-  dart_unit_t u) {
-  if (!gptr) {
+dart_ret_t dart_gptr_getflags(
+  dart_gptr_t gptr,
+  uint16_t *flags) {
+  dart_mempoolptr pool = dart_memarea_get_mempool_by_id(gptr.segid);
+  *flags = 0;
+  if (!pool) {
+    DART_LOG_ERROR("dart_gptr_getflags ! Unknown segment %d", gptr.segid);
     return DART_ERR_INVAL;
   }
-  gptr->unitid = u;
+  *flags = pool->flags;
   return DART_OK;
 }
 
-dart_ret_t dart_gptr_incaddr(
+dart_ret_t dart_gptr_setflags(
   dart_gptr_t *gptr,
-  int offs) {
-  int poolid;
-  dart_mempoolptr pool;
-  if (!gptr) {
-    return DART_ERR_INVAL;
-  }
-  poolid = gptr->segid;
-  pool = dart_memarea_get_mempool_by_id(poolid);
+  uint16_t flags) {
+  dart_mempoolptr pool = dart_memarea_get_mempool_by_id(gptr->segid);
   if (!pool) {
-    return DART_ERR_OTHER;
+    DART_LOG_ERROR("dart_gptr_setflags ! Unknown segment %d", gptr->segid);
+    return DART_ERR_INVAL;
   }
-  gptr->addr_or_offs.offset += offs;
+  pool->flags  = flags;
+  gptr->flags  = (flags & 0xFF);
   return DART_OK;
 }
 
 /**
- * Unaligned allocation in the mempool of DART_TEAM_All
+ * Unaligned allocation in the mempool of DART_TEAM_ALL
  * to make the memory accessible to all units
  */
 dart_ret_t dart_memalloc(
-  size_t nbytes,
+  size_t nelem,
+  dart_datatype_t dtype,
   dart_gptr_t *gptr) {
-  dart_unit_t myid;
+  dart_global_unit_t myid;
   dart_mempoolptr pool;
   dart_membucket bucket;
-  int poolid;
-  // 1. find the right pool id in DART_TEAM_ALL for the allocation
-  // 2. get the mempool using this pool id
-  // 3. perform the allocation
-  // 4. set gptr members
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
   if (!gptr) {
     return DART_ERR_INVAL;
   }
-  // todo: this is not always 0
-  poolid = 0;
-  pool = dart_memarea_get_mempool_by_id(poolid);
+  *gptr = DART_GPTR_NULL;
+  pool = dart_memarea_get_mempool_by_id(LOCALPOOL_ID);
   if (!pool) {
     return DART_ERR_OTHER;
   }
@@ -112,70 +332,250 @@ dart_ret_t dart_memalloc(
   if (!bucket) {
     return DART_ERR_OTHER;
   }
+  // keep consecutive allocations aligned, also reserve memory
+  // for empty allocations so that they are distinguishable
+  nbytes = ((nbytes + LOCALPOOL_ALIGN - 1) / LOCALPOOL_ALIGN)
+           * LOCALPOOL_ALIGN;
+  if (nbytes == 0) {
+    nbytes = LOCALPOOL_ALIGN;
+  }
+  dart_myid(&myid);
+  uint64_t offset;
   void *addr;
   addr = dart_membucket_alloc(bucket, nbytes);
-  if (addr == ((void*)0)) {
-    ERROR("Could not alloc memory in mempool %d", 0);
-    return DART_ERR_OTHER;
+  if (addr != ((void*)0)) {
+    offset = ((char*)addr)-((char*)pool->localbase_addr);
+  } else {
+    // grow into the chunks, creating the first missing chunk
+    // that is large enough to hold the allocation
+    int chunk;
+    for (chunk = 1; chunk < NUM_LOCALPOOL_CHUNKS; chunk++) {
+      if (_localpool_buckets[chunk] == DART_MEMBUCKET_NULL) {
+        if (chunk_size(pool->localsz, chunk) < nbytes) {
+          continue;
+        }
+        create_chunk(pool->localsz, myid.id, chunk);
+      }
+      addr = dart_membucket_alloc(_localpool_buckets[chunk], nbytes);
+      if (addr != ((void*)0)) {
+        break;
+      }
+    }
+    if (addr == ((void*)0)) {
+      DART_LOG_ERROR("dart_memalloc: out of memory in local pool "
+                     "(requested %zu bytes), consider increasing %s",
+                     nbytes, DART_LOCAL_ALLOC_SIZE_ENVSTR);
+      return DART_ERR_OTHER;
+    }
+    offset = chunk_begin(pool->localsz, chunk) +
+             (((char*)addr) - _localpool_chunks[myid.id][chunk]);
+  }
+  gptr->unitid  = myid.id;
+  gptr->segid   = LOCALPOOL_ID;
+  gptr->teamid  = DART_TEAM_ALL;
+  gptr->flags   = 0;
+  gptr->addr_or_offs.offset = offset;
+  return DART_OK;
+}
+
+dart_ret_t dart_memfree(
+  dart_gptr_t gptr) {
+  dart_mempoolptr pool;
+  dart_global_unit_t myid;
+  if (DART_GPTR_ISNULL(gptr)) {
+    return DART_OK;
   }
   dart_myid(&myid);
-  gptr->unitid  = myid;
-  gptr->segid   = poolid;
-  gptr->addr_or_offs.offset =
-    ((char*)addr)-((char*)pool->localbase_addr);
+  if (gptr.segid != LOCALPOOL_ID || gptr.unitid != myid.id) {
+    DART_LOG_ERROR("dart_memfree: invalid global pointer "
+                   "(unit %d, segment %d)", gptr.unitid, gptr.segid);
+    return DART_ERR_INVAL;
+  }
+  pool = dart_memarea_get_mempool_by_id(LOCALPOOL_ID);
+  if (!pool || !pool->bucket) {
+    return DART_ERR_OTHER;
+  }
+  uint64_t       offset = gptr.addr_or_offs.offset;
+  int            chunk  = chunk_of(pool->localsz, offset);
+  dart_membucket bucket = pool->bucket;
+  char         * base   = (char*)pool->localbase_addr;
+  if (chunk > 0) {
+    bucket = (chunk < NUM_LOCALPOOL_CHUNKS) ? _localpool_buckets[chunk]
+                                            : DART_MEMBUCKET_NULL;
+    base   = (bucket) ? _localpool_chunks[myid.id][chunk] : NULL;
+    offset -= chunk_begin(pool->localsz, chunk);
+  }
+  if (!bucket || dart_membucket_free(bucket, base + offset) != 0) {
+    DART_LOG_ERROR("dart_memfree: no allocation at offset %lu",
+                   (unsigned long)gptr.addr_or_offs.offset);
+    return DART_ERR_INVAL;
+  }
   return DART_OK;
 }
 
 dart_ret_t dart_team_memalloc_aligned(
   dart_team_t teamid,
-  size_t nbytes,
+  size_t nelem,
+  dart_datatype_t dtype,
   dart_gptr_t *gptr) {
   dart_ret_t ret;
   size_t teamsize;
-  dart_unit_t myid;
-  dart_unit_t unit;
-  dart_mempoolptr pool;
+  dart_team_unit_t myid;
   int poolid;
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
   if (!gptr) {
-    return DART_ERR_OTHER;
+    return DART_ERR_INVAL;
   }
+  *gptr = DART_GPTR_NULL;
   ret = dart_team_size(teamid, &teamsize);
   if (ret != DART_OK) {
-    return DART_ERR_OTHER;
+    DART_LOG_ERROR("dart_team_memalloc_aligned ! Unknown team %d", teamid);
+    return DART_ERR_INVAL;
   }
-  ret = dart_team_myid(teamid, &myid);
+  dart_team_myid(teamid, &myid);
+  // units may request different sizes, the segment is partitioned
+  // by the largest one
+  size_t maxbytes;
+  ret = dart_allreduce(&nbytes, &maxbytes, 1, DART_TYPE_SIZET,
+                       DART_OP_MAX, teamid);
   if (ret != DART_OK) {
-    return DART_ERR_OTHER;
+    return ret;
   }
   poolid = dart_memarea_create_mempool(
              teamid,
              teamsize,
-             myid,
-             nbytes,
+             myid.id,
+             maxbytes,
              1);
   if (poolid < 0) {
     return DART_ERR_OTHER;
   }
-  pool = dart_memarea_get_mempool_by_id(poolid);
-  if (!pool) {
-    return DART_ERR_OTHER;
-  }
-  dart_team_unit_l2g(teamid, 0, &unit);
-  gptr->unitid  = unit;
+  gptr->unitid  = 0;
   gptr->segid   = poolid;
+  gptr->teamid  = teamid;
+  gptr->flags   = 0;
   gptr->addr_or_offs.offset = 0;
   return DART_OK;
 }
 
-dart_ret_t dart_memfree(
+dart_ret_t dart_team_memfree(
   dart_gptr_t gptr) {
-  // TODO: Implement
+  dart_team_unit_t myid;
+  if (DART_GPTR_ISNULL(gptr)) {
+    return DART_OK;
+  }
+  dart_mempoolptr pool = dart_memarea_get_mempool_by_id(gptr.segid);
+  if (gptr.segid == LOCALPOOL_ID || !pool ||
+      pool->state == MEMPOOL_REGISTERED) {
+    DART_LOG_ERROR("dart_team_memfree: invalid segment %d", gptr.segid);
+    return DART_ERR_INVAL;
+  }
+  dart_team_myid(pool->teamid, &myid);
+  return dart_memarea_destroy_mempool(gptr.segid, myid.id);
+}
+
+dart_ret_t dart_team_memregister(
+  dart_team_t teamid,
+  size_t nelem,
+  dart_datatype_t dtype,
+  void *addr,
+  dart_gptr_t *gptr) {
+  size_t teamsize;
+  dart_team_unit_t myid;
+  int i, poolid;
+  size_t nbytes = nelem * dart__shmem__datatype_sizeof(dtype);
+  struct dart_mempool_regentry entry = { -1, 0, 0 };
+
+  if (!gptr) {
+    return DART_ERR_INVAL;
+  }
+  *gptr = DART_GPTR_NULL;
+  if (dart_team_size(teamid, &teamsize) != DART_OK) {
+    DART_LOG_ERROR("dart_team_memregister ! Unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  dart_team_myid(teamid, &myid);
+
+  // memory can only be shared with other units if it is located in
+  // one of the shared mempools, find the pool containing addr
+  if (nbytes > 0) {
+    for (i = 0; i < MAXNUM_MEMPOOLS; i++) {
+      dart_mempoolptr pool = dart_memarea_get_mempool_by_id(i);
+      if (!pool || pool->state == MEMPOOL_REGISTERED) {
+        continue;
+      }
+      char *base = (char*)pool->base_addr;
+      char *end  = base + pool->teamsize * pool->localsz;
+      if (base <= (char*)addr && (char*)addr + nbytes <= end) {
+        size_t disp  = (char*)addr - base;
+        entry.poolid = i;
+        entry.unit   = disp / pool->localsz;
+        entry.offset = disp % pool->localsz;
+        break;
+      }
+    }
+  }
+  if (nbytes > 0 && entry.poolid < 0) {
+    // memory allocated in one of the chunks extending the local pool
+    dart_global_unit_t gid;
+    dart_mempoolptr    pool = dart_memarea_get_mempool_by_id(LOCALPOOL_ID);
+    dart_myid(&gid);
+    for (i = 1; pool && i < NUM_LOCALPOOL_CHUNKS; i++) {
+      char *cbase = _localpool_chunks[gid.id][i];
+      if (cbase != NULL && cbase <= (char*)addr &&
+          (char*)addr + nbytes <= cbase + chunk_size(pool->localsz, i)) {
+        entry.poolid = LOCALPOOL_ID;
+        entry.unit   = gid.id;
+        entry.offset = chunk_begin(pool->localsz, i) + ((char*)addr - cbase);
+        break;
+      }
+    }
+  }
+  if (nbytes > 0 && entry.poolid < 0) {
+    DART_LOG_ERROR("dart_team_memregister: memory at %p is not located "
+                   "in a shared segment, only memory allocated using "
+                   "DART can be registered", addr);
+  }
+
+  // the registration is collective even if it failed on some units,
+  // failures are reported on access
+  poolid = dart_memarea_register_mempool(teamid, teamsize,
+                                         myid.id, &entry);
+  if (poolid < 0) {
+    return DART_ERR_OTHER;
+  }
+  if (nbytes > 0 && entry.poolid < 0) {
+    return DART_ERR_INVAL;
+  }
+  gptr->unitid  = 0;
+  gptr->segid   = poolid;
+  gptr->teamid  = teamid;
+  gptr->flags   = 0;
+  gptr->addr_or_offs.offset = 0;
   return DART_OK;
 }
 
-dart_ret_t dart_team_memfree(
+dart_ret_t dart_team_memregister_aligned(
   dart_team_t teamid,
+  size_t nelem,
+  dart_datatype_t dtype,
+  void *addr,
+  dart_gptr_t *gptr) {
+  return dart_team_memregister(teamid, nelem, dtype, addr, gptr);
+}
+
+dart_ret_t dart_team_memderegister(
   dart_gptr_t gptr) {
-  // TODO: Implement
-  return DART_OK;
+  dart_team_unit_t myid;
+  if (DART_GPTR_ISNULL(gptr)) {
+    return DART_OK;
+  }
+  dart_mempoolptr pool = dart_memarea_get_mempool_by_id(gptr.segid);
+  if (!pool || pool->state != MEMPOOL_REGISTERED) {
+    DART_LOG_ERROR("dart_team_memderegister: invalid segment %d",
+                   gptr.segid);
+    return DART_ERR_INVAL;
+  }
+  dart_team_myid(pool->teamid, &myid);
+  return dart_memarea_destroy_mempool(gptr.segid, myid.id);
 }
@@ -1,12 +1,18 @@
 
+#include <stdlib.h>
+#include <string.h>
+
+#include <dash/dart/if/dart.h>
+
 #include <dash/dart/shmem/dart_memarea.h>
+#include <dash/dart/shmem/shmem_barriers_if.h>
+#include <dash/dart/shmem/shmem_logger.h>
 
 dart_memarea_t memarea;
 
 void dart_memarea_init()
 {
   int i;
-  memarea.next_free = 0;
   for (i = 0; i < MAXNUM_MEMPOOLS; i++) {
     dart_mempool_init(
       &((memarea.mempools)[i])
@@ -14,16 +20,40 @@ void dart_memarea_init()
   }
 }
 
-dart_mempoolptr 
+void dart_memarea_fini()
+{
+  int i;
+  for (i = 0; i < MAXNUM_MEMPOOLS; i++) {
+    dart_mempool_destroy(
+      &((memarea.mempools)[i])
+    );
+  }
+}
+
+dart_mempoolptr
 dart_memarea_get_mempool_by_id(int id)
 {
   dart_mempoolptr res = 0;
-  if (0 <= id && id < MAXNUM_MEMPOOLS) {
+  if (0 <= id && id < MAXNUM_MEMPOOLS &&
+      memarea.mempools[id].state != MEMPOOL_NULL) {
     res = &((memarea.mempools)[id]);
   }
   return res;
 }
 
+// the team's root reserves a segment id that is unique
+// across all teams and shares it with the team
+static int new_poolid(dart_team_t teamid, dart_unit_t myid)
+{
+  int poolid = -1;
+  if (myid == 0) {
+    poolid = shmem_syncarea_newpool();
+  }
+  dart_bcast(&poolid, sizeof(int), DART_TYPE_BYTE,
+             DART_TEAM_UNIT_ID(0), teamid);
+  return poolid;
+}
+
 int dart_memarea_create_mempool(
   dart_team_t teamid,
   size_t teamsize,
@@ -32,23 +62,70 @@ int dart_memarea_create_mempool(
   int is_aligned)
 {
   dart_ret_t ret;
-  int res =- 1; 
-  if (0 <= memarea.next_free && 
-      memarea.next_free < MAXNUM_MEMPOOLS) {
-    dart_mempoolptr pool = 
-      &((memarea.mempools)[memarea.next_free]);
-    ret = dart_mempool_create(
-            pool,
-            teamid,
-            teamsize, 
-            myid,
-            localsize);
-    if (ret == DART_OK) {
-      res = memarea.next_free;
-      pool->state = (is_aligned?MEMPOOL_ALIGNED:MEMPOOL_UNALIGNED);
-      pool->teamid = teamid;
-      memarea.next_free++;
+  int poolid = new_poolid(teamid, myid);
+  if (poolid < 0) {
+    ERROR("No free mempool for team %d", teamid);
+    return -1;
+  }
+
+  dart_mempoolptr pool = &((memarea.mempools)[poolid]);
+  ret = dart_mempool_create(
+          pool,
+          teamid,
+          teamsize,
+          myid,
+          localsize);
+  if (ret != DART_OK) {
+    if (myid == 0) {
+      shmem_syncarea_delpool(poolid);
     }
+    return -1;
   }
-  return res;
+  pool->state = (is_aligned?MEMPOOL_ALIGNED:MEMPOOL_UNALIGNED);
+  return poolid;
+}
+
+int dart_memarea_register_mempool(
+  dart_team_t teamid,
+  size_t teamsize,
+  dart_unit_t myid,
+  const struct dart_mempool_regentry *entry)
+{
+  int poolid = new_poolid(teamid, myid);
+  if (poolid < 0) {
+    ERROR("No free mempool for team %d", teamid);
+    return -1;
+  }
+
+  struct dart_mempool_regentry *regtab =
+    malloc(sizeof(struct dart_mempool_regentry) * teamsize);
+  dart_allgather(entry, regtab, sizeof(struct dart_mempool_regentry),
+                 DART_TYPE_BYTE, teamid);
+
+  dart_mempoolptr pool = &((memarea.mempools)[poolid]);
+  dart_mempool_init(pool);
+  pool->state    = MEMPOOL_REGISTERED;
+  pool->teamid   = teamid;
+  pool->teamsize = teamsize;
+  pool->regtab   = regtab;
+  return poolid;
+}
+
+dart_ret_t dart_memarea_destroy_mempool(
+  int id,
+  dart_unit_t myid)
+{
+  dart_mempoolptr pool = dart_memarea_get_mempool_by_id(id);
+  if (!pool) {
+    return DART_ERR_INVAL;
+  }
+  dart_team_t teamid = pool->teamid;
+
+  // no unit may access the pool anymore
+  dart_barrier(teamid);
+  dart_mempool_destroy(pool);
+  if (myid == 0) {
+    shmem_syncarea_delpool(id);
+  }
+  return DART_OK;
 }
@@ -1,4 +1,6 @@
 
+#include <stdlib.h>
+
 #include <dash/dart/if/dart.h>
 
 #include <dash/dart/shmem/dart_membucket.h>
@@ -13,9 +15,13 @@ void dart_mempool_init(dart_mempoolptr pool)
   pool->state     = MEMPOOL_NULL;
   pool->base_addr = 0;
   pool->localbase_addr = 0;
+  pool->localsz   = 0;
+  pool->teamsize  = 0;
   pool->shmem_key = -1;
   pool->teamid    = -1;
+  pool->flags     = 0;
   pool->bucket    = DART_MEMBUCKET_NULL;
+  pool->regtab    = 0;
 }
 
 dart_ret_t dart_mempool_create(dart_mempoolptr pool,
@@ -26,38 +32,60 @@ dart_ret_t dart_mempool_create(dart_mempoolptr pool,
 {
   if( !pool ) return DART_ERR_INVAL;
 
+  // keep the memory of every unit aligned
+  localsz = ((localsz + MEMPOOL_UNIT_ALIGN - 1) / MEMPOOL_UNIT_ALIGN)
+            * MEMPOOL_UNIT_ALIGN;
+
   size_t totalsz = teamsize * localsz;
-  int   attach_key;
+  int   attach_key = -1;
   void *attach_addr;
 
-  // TODO: maybe a barrier here...
-
   if( myid==0 ) {
-    attach_key = shmem_mm_create(totalsz);
+    // shmget does not accept empty segments
+    attach_key = shmem_mm_create(totalsz > 0 ? totalsz : 1);
   }
-  
-  dart_bcast(&attach_key, sizeof(int), 0, teamid );
+
+  dart_bcast(&attach_key, sizeof(int), DART_TYPE_BYTE,
+	     DART_TEAM_UNIT_ID(0), teamid);
 
   attach_addr = shmem_mm_attach(attach_key);
 
+  // once all units are attached, the segment can be marked for
+  // removal so it does not outlive the application
+  dart_barrier(teamid);
+  if( myid==0 ) {
+    shmem_mm_destroy(attach_key);
+  }
+
   dart_membucket membucket;
-  int myoffset = myid * localsz;
+  size_t myoffset = myid * localsz;
 
-  membucket = 
-    dart_membucket_create( ((char*)attach_addr)+myoffset, 
+  membucket =
+    dart_membucket_create( ((char*)attach_addr)+myoffset,
 			   localsz );
 
-  // todo: check if everything is ok
-    
   pool->bucket    = membucket;
   pool->base_addr = attach_addr;
   pool->localbase_addr = ((char*)attach_addr)+myoffset;
   pool->localsz   = localsz;
+  pool->teamsize  = teamsize;
   pool->shmem_key = attach_key;
-
-  //pool->state = ...
-  
-  // TODO: maybe a barrier here...
+  pool->teamid    = teamid;
 
   return DART_OK;
 }
+
+void dart_mempool_destroy(dart_mempoolptr pool)
+{
+  if( !pool || pool->state==MEMPOOL_NULL ) return;
+
+  if( pool->bucket ) {
+    dart_membucket_destroy(pool->bucket);
+  }
+  if( pool->state==MEMPOOL_REGISTERED ) {
+    free(pool->regtab);
+  } else if( pool->base_addr ) {
+    shmem_mm_detach(pool->base_addr);
+  }
+  dart_mempool_init(pool);
+}
@@ -1,244 +1,356 @@
 
 #include <string.h>
+#include <sched.h>
 
 #include <dash/dart/base/logging.h>
 #include <dash/dart/if/dart.h>
 #include <dash/dart/if/dart_types.h>
-#include <dash/dart/shmem/dart_mempool.h>
-#include <dash/dart/shmem/dart_memarea.h>
+#include <dash/dart/shmem/dart_malloc.h>
+#include <dash/dart/shmem/dart_types_impl.h>
+
+/*
+ * All units share the memory pools, so one-sided operations are
+ * plain memory accesses that are completed before they return.
+ * Operations on handles therefore never return a valid handle.
+ */
+
+#define CHECK_IS_CONTIGUOUSTYPE(_dtype)                               \
+  do {                                                                \
+    if (!dart__shmem__datatype_iscontiguous(_dtype)) {                \
+      DART_LOG_ERROR("%s ! Only contiguous data types supported",     \
+                     __func__);                                       \
+      return DART_ERR_INVAL;                                          \
+    }                                                                 \
+  } while (0)
+
+dart_ret_t dart_get_blocking(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
+{
+  void *addr;
+  dart_ret_t ret = dart_shmem_gptr_addr(gptr, &addr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_get ! failed to resolve global pointer");
+    return ret;
+  }
+  return dart__shmem__datatype_copy(dest, dst_type, addr, src_type, nelem);
+}
+
+dart_ret_t dart_put_blocking(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
+{
+  void *addr;
+  dart_ret_t ret = dart_shmem_gptr_addr(gptr, &addr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_put ! failed to resolve global pointer");
+    return ret;
+  }
+  return dart__shmem__datatype_copy(addr, dst_type, src, src_type, nelem);
+}
 
 dart_ret_t dart_get(
-  void *dest,
-  dart_gptr_t ptr,
-  size_t nbytes)
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
 {
-  return dart_get_blocking(dest, ptr, nbytes);
+  return dart_get_blocking(dest, gptr, nelem, src_type, dst_type);
 }
 
 dart_ret_t dart_put(
-  dart_gptr_t  ptr,
-  const void * src,
-  size_t       nbytes)
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type)
 {
-  return dart_put_blocking(ptr, src, nbytes);
+  return dart_put_blocking(gptr, src, nelem, src_type, dst_type);
 }
 
-/*
- * dart_accumulate_* implementation, to be defined as macro
- * DART_SHMEM_DEFINE_ACCUMULATE(type)
- */
+dart_ret_t dart_get_handle(
+  void            * dest,
+  dart_gptr_t       gptr,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_handle_t   * handle)
+{
+  *handle = DART_HANDLE_NULL;
+  return dart_get_blocking(dest, gptr, nelem, src_type, dst_type);
+}
 
-inline int dart_shmem_reduce_int(int a, int b, dart_operation_t op) {
-  switch (op) {
-    case DART_OP_MIN  : return (a < b) ? a : b;
-    case DART_OP_MAX  : return (a > b) ? a : b;
-    case DART_OP_SUM  : return a + b;
-    case DART_OP_PROD : return a * b;
-    case DART_OP_BAND : return a & b;
-    case DART_OP_LAND : return a && b;
-    case DART_OP_BOR  : return a | b;
-    case DART_OP_LOR  : return a || b;
-    case DART_OP_BXOR : return a ^ b;
-    case DART_OP_LXOR : return (!a) ? b : !b;
-    default           : DART_LOG_ERROR("Unknown reduce operation (%d)",
-                                       (int)op);
-                        return 0;
-  }
+dart_ret_t dart_put_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_handle_t   * handle)
+{
+  *handle = DART_HANDLE_NULL;
+  return dart_put_blocking(gptr, src, nelem, src_type, dst_type);
 }
 
 dart_ret_t dart_accumulate(
-  dart_gptr_t      ptr_dest,
-  char  *          values,
-  size_t           nvalues,
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
   dart_datatype_t  dtype,
-  dart_operation_t op,
-  dart_team_t      team)
+  dart_operation_t op)
 {
-  int             * addr;
-  int               poolid;
-  dart_unit_t       myid;
-  dart_mempoolptr   pool;
+  char *addr;
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  dart_ret_t ret = dart_shmem_gptr_addr(gptr, (void**)&addr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_accumulate ! failed to resolve global pointer");
+    return ret;
+  }
+  size_t esize = dart__shmem__datatype_sizeof(dtype);
+  for (size_t i = 0; i < nelem; i++) {
+    dart_gptr_t elem_gptr = gptr;
+    elem_gptr.addr_or_offs.offset += i * esize;
+    ret = dart__shmem__atomic_apply(
+            dart_shmem_gptr_key(elem_gptr),
+            addr + i * esize,
+            ((const char *)values) + i * esize,
+            NULL, dtype, op);
+    if (ret != DART_OK) {
+      return ret;
+    }
+  }
+  return DART_OK;
+}
+
+dart_ret_t dart_accumulate_blocking_local(
+  dart_gptr_t      gptr,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op)
+{
+  return dart_accumulate(gptr, values, nelem, dtype, op);
+}
 
-  if (dtype != DART_TYPE_INT) {
-    DART_LOG_ERROR("dart_accumulate: "
-                   "only datatype DART_TYPE_INT supported");
+dart_ret_t dart_fetch_and_op(
+  dart_gptr_t      gptr,
+  const void     * value,
+  void           * result,
+  dart_datatype_t  dtype,
+  dart_operation_t op)
+{
+  void *addr;
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  dart_ret_t ret = dart_shmem_gptr_addr(gptr, &addr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_fetch_and_op ! failed to resolve global pointer");
+    return ret;
+  }
+  return dart__shmem__atomic_apply(
+           dart_shmem_gptr_key(gptr), addr, value, result, dtype, op);
+}
+
+dart_ret_t dart_compare_and_swap(
+  dart_gptr_t      gptr,
+  const void     * value,
+  const void     * compare,
+  void           * result,
+  dart_datatype_t  dtype)
+{
+  void *addr;
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+  dart_ret_t ret = dart_shmem_gptr_addr(gptr, &addr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_compare_and_swap ! "
+                   "failed to resolve global pointer");
+    return ret;
+  }
+  return dart__shmem__atomic_cas(
+           dart_shmem_gptr_key(gptr), addr, value, compare, result, dtype);
+}
+
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   src_type,
+  dart_datatype_t   dst_type,
+  dart_gptr_t       notify,
+  int64_t           value,
+  dart_operation_t  op)
+{
+  if (op != DART_OP_SUM && op != DART_OP_REPLACE) {
+    DART_LOG_ERROR("dart_put_notify ! "
+                   "Notification only supports DART_OP_SUM and DART_OP_REPLACE");
     return DART_ERR_INVAL;
   }
+  if (notify.teamid != gptr.teamid || notify.unitid != gptr.unitid) {
+    DART_LOG_ERROR("dart_put_notify ! "
+                   "Notification counter not located at the target unit %d",
+                   gptr.unitid);
+    return DART_ERR_INVAL;
+  }
+  dart_ret_t ret = dart_put_blocking(gptr, src, nelem, src_type, dst_type);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  // the atomic update is a full barrier, the payload is visible before it
+  return dart_fetch_and_op(notify, &value, NULL, DART_TYPE_LONGLONG, op);
+}
 
-  dart_myid(&myid);
-  poolid = ptr_dest.segid;
-  pool   = dart_memarea_get_mempool_by_id(poolid);
-  if(!pool) {
-    return DART_ERR_OTHER;
+static dart_ret_t notify_read(
+  dart_gptr_t   notify,
+  int64_t     * result)
+{
+  dart_team_unit_t team_myid;
+  if (dart_team_myid(notify.teamid, &team_myid) != DART_OK) {
+    DART_LOG_ERROR("dart_notify ! failed: Unknown team %i!", notify.teamid);
+    return DART_ERR_INVAL;
   }
-  addr   = ((int*)(pool->localbase_addr)) +               /* pool base addr */
-           ((ptr_dest.unitid - myid) * (pool->localsz)) + /* unit offset    */
-           ptr_dest.addr_or_offs.offset;                  /* element offset */
-  DART_LOG_DEBUG("ACC  - t:%d o:%d, pool:%d lbase:%p lsz:%d offs:%d",
-                  ptr_dest.unitid,
-                  myid,
-                  poolid,
-                  (int*)(pool->localbase_addr),
-                  pool->localsz,
-                  ptr_dest.addr_or_offs.offset);
-  DART_LOG_DEBUG("ACC  - %d elements, addr: %p", nvalues, addr);
-  for (size_t i = 0; i < nvalues; i++) {
-    int * ptr_src  = &values[i];
-    int * ptr_dest = &addr[i];
-    int exp_value  = *(ptr_dest);
-    int new_value;
-    DART_LOG_DEBUG("ACC  - CAS on element %d (%p) to %d",
-                   i, ptr_dest, new_value);
-    int old_value;
-    /* Compare-and-Swap single elements */
-    for(;;) {
-      new_value = dart_shmem_reduce_int(exp_value, *(ptr_src), op);
-      old_value = __sync_val_compare_and_swap(
-        ptr_dest,
-        exp_value,
-        new_value);
-      if (old_value == exp_value) {
-        /* Assume success, disregarding ABA for now */
-        DART_LOG_DEBUG("ACC  - CAS succeeded on element %d ", i);
-        break;
-      }
-      exp_value = old_value;
-    }
+  if (notify.unitid != team_myid.id) {
+    DART_LOG_ERROR("dart_notify ! "
+                   "Notification counter not located at the calling unit");
+    return DART_ERR_INVAL;
   }
+  int64_t *addr;
+  dart_ret_t ret = dart_shmem_gptr_addr(notify, (void**)&addr);
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart_notify ! failed to resolve global pointer");
+    return ret;
+  }
+  *result = __atomic_load_n(addr, __ATOMIC_ACQUIRE);
   return DART_OK;
 }
 
-dart_ret_t dart_get_handle(
-  void *dest,
-  dart_gptr_t ptr,
-	size_t nbytes,
-  dart_handle_t *handle)
+dart_ret_t dart_notify_wait(
+  dart_gptr_t       notify,
+  int64_t           value)
 {
-  return DART_ERR_OTHER;
+  int64_t    counter;
+  dart_ret_t ret;
+  while ((ret = notify_read(notify, &counter)) == DART_OK &&
+         counter < value) {
+    sched_yield();
+  }
+  return ret;
 }
 
-dart_ret_t dart_put_handle(
-  dart_gptr_t     ptr,
-  const void    * src,
-	size_t          nbytes,
-  dart_handle_t * handle)
+dart_ret_t dart_notify_test(
+  dart_gptr_t       notify,
+  int64_t           value,
+  int32_t         * flag)
 {
-  return DART_ERR_OTHER;
+  int64_t    counter;
+  dart_ret_t ret = notify_read(notify, &counter);
+  *flag = (ret == DART_OK && counter >= value) ? 1 : 0;
+  return ret;
 }
 
 dart_ret_t dart_flush(
   dart_gptr_t gptr)
 {
-  // No flush needed for SHMEM
+  // make preceding stores visible to other units
+  __sync_synchronize();
   return DART_OK;
 }
 
 dart_ret_t dart_flush_all(
   dart_gptr_t gptr)
 {
-  // No flush needed for SHMEM
+  __sync_synchronize();
   return DART_OK;
 }
 
 dart_ret_t dart_flush_local(
   dart_gptr_t gptr)
 {
-  // No flush needed for SHMEM
+  // local completion is implied by the copy
   return DART_OK;
 }
 
 dart_ret_t dart_flush_local_all(
   dart_gptr_t gptr)
 {
-  // No flush needed for SHMEM
   return DART_OK;
 }
 
 dart_ret_t dart_wait(
-  dart_handle_t handle)
+  dart_handle_t * handle)
 {
-  // TODO: Not implemented
-  return DART_ERR_OTHER;
+  if (handle != NULL) {
+    *handle = DART_HANDLE_NULL;
+  }
+  return DART_OK;
 }
 
-dart_ret_t dart_test(
-  dart_handle_t handle)
+dart_ret_t dart_wait_local(
+  dart_handle_t * handle)
 {
-  // TODO: Not implemented
-  return DART_ERR_OTHER;
+  return dart_wait(handle);
 }
 
-dart_ret_t dart_waitall_local(
-  dart_handle_t * handle,
-  size_t          num_handles)
+dart_ret_t dart_waitall(
+  dart_handle_t handles[],
+  size_t        n)
 {
-  return dart_waitall(handle, num_handles);
+  if (handles != NULL) {
+    for (size_t i = 0; i < n; i++) {
+      handles[i] = DART_HANDLE_NULL;
+    }
+  }
+  return DART_OK;
 }
 
-dart_ret_t dart_waitall(
-  dart_handle_t *handle,
-  size_t n)
+dart_ret_t dart_waitall_local(
+  dart_handle_t handles[],
+  size_t        n)
 {
-  return DART_ERR_OTHER;
+  return dart_waitall(handles, n);
 }
 
-dart_ret_t dart_testall(
-  dart_handle_t *handle,
-  size_t n)
+dart_ret_t dart_test(
+  dart_handle_t * handle,
+  int32_t       * is_finished)
 {
-  // TODO: Not implemented
-  return DART_ERR_OTHER;
+  dart_wait(handle);
+  *is_finished = 1;
+  return DART_OK;
 }
 
-dart_ret_t dart_get_blocking(
-  void *dest,
-	dart_gptr_t ptr,
-  size_t nbytes)
+dart_ret_t dart_test_local(
+  dart_handle_t * handle,
+  int32_t       * result)
 {
-  char *addr;
-  int poolid;
-  dart_unit_t myid;
-  dart_mempoolptr pool;
-
-  poolid = ptr.segid;
-  pool = dart_memarea_get_mempool_by_id(poolid);
-
-  if(!pool)
-    return DART_ERR_OTHER;
-
-  dart_myid(&myid);
-
-  addr = ((char*)pool->localbase_addr) +
-    ((ptr.unitid-myid)*(pool->localsz)) +
-    ptr.addr_or_offs.offset;
+  return dart_test(handle, result);
+}
 
-  memcpy(dest, addr, nbytes);
+dart_ret_t dart_testall(
+  dart_handle_t   handles[],
+  size_t          n,
+  int32_t       * is_finished)
+{
+  dart_waitall(handles, n);
+  *is_finished = 1;
   return DART_OK;
 }
 
-dart_ret_t dart_put_blocking(
-  dart_gptr_t  ptr,
-  const void * src,
-  size_t       nbytes)
+dart_ret_t dart_testall_local(
+  dart_handle_t   handles[],
+  size_t          n,
+  int32_t       * result)
 {
-  char *addr;
-  int poolid;
-  dart_unit_t myid;
-  dart_mempoolptr pool;
-
-  poolid = ptr.segid;
-  pool = dart_memarea_get_mempool_by_id(poolid);
-
-  if(!pool)
-    return DART_ERR_OTHER;
-
-  dart_myid(&myid);
-
-  addr = ((char*)pool->localbase_addr) +
-    ((ptr.unitid-myid)*(pool->localsz)) +
-    ptr.addr_or_offs.offset;
-
-  memcpy(addr, src, nbytes);
-  return DART_OK;
+  return dart_testall(handles, n, result);
 }
 
+dart_ret_t dart_handle_free(
+  dart_handle_t * handle)
+{
+  return dart_wait(handle);
+}
@@ -1,5 +1,7 @@
-
 #include <stdio.h>
+#include <stdlib.h>
+
+#include <dash/dart/base/logging.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_team_group.h>
@@ -8,6 +10,7 @@
 
 #include <dash/dart/shmem/dart_teams_impl.h>
 #include <dash/dart/shmem/dart_groups_impl.h>
+#include <dash/dart/shmem/dart_malloc.h>
 #include <dash/dart/shmem/dart_shmem.h>
 #include <dash/dart/shmem/shmem_p2p_if.h>
 #include <dash/dart/shmem/shmem_logger.h>
@@ -18,247 +21,244 @@ static struct team_impl_struct teams[MAXNUM_TEAMS];
 struct newteam_msg
 {
   int size;
-  int newid;
   int slot;
   dart_team_t teamid;
 };
 
-dart_ret_t dart_team_create(dart_team_t oldteamid, 
-			    const dart_group_t *group, 
+// the slot of a team this unit is a member of, -1 otherwise
+static int team_slot(dart_team_t teamid)
+{
+  int slot;
+  if (teamid == DART_TEAM_ALL) {
+    return 0;
+  }
+  if (teamid == DART_TEAM_NULL) {
+    return -1;
+  }
+  slot = shmem_syncarea_findteam(teamid);
+  if (SLOT_IS_VALID(slot) &&
+      teams[slot].state == VALID &&
+      teams[slot].teamid == teamid) {
+    return slot;
+  }
+  return -1;
+}
+
+dart_ret_t dart_team_create(dart_team_t oldteamid,
+			    const dart_group_t group,
 			    dart_team_t *newteam)
 {
-  size_t oldsize, newsize, globalsize;
-  dart_unit_t oldmyid;
-  dart_unit_t oldmyid_global;
-  dart_unit_t newmaster = 0;
-  int i_am_member = 0; 
-  int i_am_master = 0; 
+  size_t oldsize, newsize;
+  dart_team_unit_t oldmyid;
+  dart_global_unit_t oldmyid_global;
+  dart_global_unit_t newmaster = DART_UNDEFINED_GLOBAL_UNIT_ID;
+  int32_t i_am_member = 0;
+  int i_am_master = 0;
   int i;
 
   *newteam=DART_TEAM_NULL;
 
   struct newteam_msg nmsg;
 
-  /* 
+  /*
      1. sanity check of old team
-     2. barrier on old team 
+     2. barrier on old team
      3. sanity check of group specificiation
-        - if group is not empty, it must be the same on all 
+        - if group is not empty, it must be the same on all
 	  participating procs
-     4. find the master proc in new team 
+     4. find the master proc in new team
         (the master identifies itself)
      5. the master calls "dart_shmem_team_new"
      6. the master sends the information on the new team to
-        all participants in the new team (using the 
+        all participants in the new team (using the
 	old team communication infrastructure)
      7. *all members* of the new team call
         "dart_shmem_team_init"
      8. DONE! The new team is ready to be used
 
   */
-  
+
   // STEP 1
   dart_ret_t ret;
   ret = dart_shmem_team_valid(oldteamid);
-  if( ret!=DART_OK ) 
+  if( ret!=DART_OK )
     return ret;
 
   // STEP 2
   dart_barrier(oldteamid);
   dart_team_size(oldteamid, &oldsize);
   dart_team_myid(oldteamid, &oldmyid);
-  dart_team_size(DART_TEAM_ALL, &globalsize);
-  
-  // get the global old id 
-  dart_team_unit_l2g(oldteamid, 
+
+  // get the global old id
+  dart_team_unit_l2g(oldteamid,
 		     oldmyid, &oldmyid_global);
-  
+
   // STEP 3
-  // TODO: check santiy of group spec
-  // if group is not empty, it must be the same on all 
-  // participating processes 
-  if( !group ) {
+  // units not contained in any of the new teams pass an empty group
+  newsize = 0;
+  if (group) {
+    dart_group_size(group, &newsize);
+  }
+  if (newsize == 0) {
     dart_barrier(oldteamid);
     return DART_OK;
   }
 
-  dart_group_size(group, &newsize);
-
-  // TODO:
-  // dart_group_sort
-
-  // STEP 4: find new master 
-  int ismember;
-  for (i = 0; i<globalsize; i++ ) {
-    dart_group_ismember(group, i, &ismember);
-    if (ismember) {
-      newmaster = i;
-      break;
-    }
-  }
-
-  if (ismember && oldmyid_global == newmaster) {
+  // STEP 4: find new master, the member with the lowest global id
+  newmaster.id = group->l2g[0];
+  if (oldmyid_global.id == newmaster.id) {
     i_am_master = 1;
   }
 
   dart_group_ismember(group, oldmyid_global, &i_am_member);
 
-  if (i_am_master ) 
+  if (i_am_master)
   {
-    nmsg.slot = -1;
     nmsg.size = newsize;
     // STEP 5: master calls dart_shmem_team_new
     nmsg.slot = dart_shmem_team_new(
-                  &(nmsg.teamid), 
+                  &(nmsg.teamid),
                   newsize);
     if (!SLOT_IS_VALID(nmsg.slot)) {
       ERROR("dart_shmem_team_new failed (slot: %d)", nmsg.slot);
     }
     // STEP 6: send out info to all other members
-    nmsg.newid=1;
-    for (i = 0; i < globalsize; i++) {
-      dart_group_ismember(group, i, &ismember);
-      if (ismember && i != oldmyid_global) {
-        // get the local id of our comm partner
-        dart_unit_t sendto;
-        dart_team_unit_g2l(
-          oldteamid, 
-          i,
-          &sendto);
-        // note: communication in old team
-        dart_shmem_send(
-          &nmsg,
-          sizeof(struct newteam_msg),
-          oldteamid,
-          sendto);
-        nmsg.newid++;
-      }
-    }
-    // reset id for master to 0
-    nmsg.newid = 0;
-  } 
-  else 
-  {
-    if (i_am_member) {
+    for (i = 1; i < group->nmem; i++) {
       // get the local id of our comm partner
-      dart_unit_t recvfrom;
+      dart_team_unit_t sendto;
       dart_team_unit_g2l(
-        oldteamid, 
-        newmaster,
-        &recvfrom);
-      dart_shmem_recv(
+        oldteamid,
+        DART_GLOBAL_UNIT_ID(group->l2g[i]),
+        &sendto);
+      // note: communication in old team
+      dart_shmem_send(
         &nmsg,
         sizeof(struct newteam_msg),
         oldteamid,
-        recvfrom);
-      DEBUG("Received newteam_msg: %d %d %d %d", 
-            nmsg.size, nmsg.newid, nmsg.slot, nmsg.teamid);
+        sendto.id);
     }
   }
+  else if (i_am_member)
+  {
+    // get the local id of our comm partner
+    dart_team_unit_t recvfrom;
+    dart_team_unit_g2l(
+      oldteamid,
+      newmaster,
+      &recvfrom);
+    dart_shmem_recv(
+      &nmsg,
+      sizeof(struct newteam_msg),
+      oldteamid,
+      recvfrom.id);
+    DEBUG("Received newteam_msg: %d %d %d",
+          nmsg.size, nmsg.slot, nmsg.teamid);
+  }
+
   // STEP 7: all new members call dart_shmem_team_init
-  if (i_am_member) 
+  ret = DART_OK;
+  if (i_am_member)
   {
-    int slot;
-    dart_shmem_team_init(
-      nmsg.teamid,
-      nmsg.newid, 
-      nmsg.size,
-      group);
-    slot = shmem_syncarea_findteam(nmsg.teamid);	
-    if (SLOT_IS_VALID(slot)) {
-      teams[slot].myid = nmsg.newid; 
-      (*newteam)=nmsg.teamid;
+    if (!SLOT_IS_VALID(nmsg.slot)) {
+      ret = DART_ERR_OTHER;
     } else {
-      ERROR("dart_shmem_team_init failed (slot: %d)", slot);
+      ret = dart_shmem_team_init(
+              nmsg.teamid,
+              group->g2l[oldmyid_global.id],
+              nmsg.size,
+              group);
+      if (ret == DART_OK) {
+        (*newteam)=nmsg.teamid;
+      } else {
+        ERROR("dart_shmem_team_init failed (team: %d)", nmsg.teamid);
+      }
     }
   }
   dart_barrier(oldteamid);
-  return DART_OK;
+  return ret;
 }
 
-dart_ret_t dart_team_destroy(dart_team_t teamid)
+dart_ret_t dart_team_destroy(dart_team_t *teamid)
 {
   size_t size;
-  dart_unit_t myid;
-  
-  if( teamid==DART_TEAM_ALL ) {
+  dart_team_unit_t myid;
+
+  if( *teamid==DART_TEAM_ALL ) {
     // can't delete the default team
-    return DART_ERR_INVAL; 
+    return DART_ERR_INVAL;
   }
-  
+
   dart_ret_t ret;
-  ret = dart_shmem_team_valid(teamid);
+  ret = dart_shmem_team_valid(*teamid);
   if( ret!=DART_OK ) {
-    fprintf(stderr, "got %d\n", ret);
+    DART_LOG_ERROR("dart_team_destroy ! Unknown team %d", *teamid);
     return ret;
   }
 
-  dart_barrier(teamid);
+  dart_barrier(*teamid);
+
+  dart_team_size(*teamid, &size);
+  dart_team_myid(*teamid, &myid);
 
-  dart_team_size(teamid, &size);
-  dart_team_myid(teamid, &myid);
-  
-  DEBUG("dart_team_destroy team=%d, size=%d, myid=%d", 
-	teamid, size, myid);
-  
-  ret = dart_shmem_team_delete( teamid, myid, size);
+  DEBUG("dart_team_destroy team=%d, size=%zu, myid=%d",
+	*teamid, size, myid.id);
+
+  ret = dart_shmem_team_delete( *teamid, myid.id, size);
+  *teamid = DART_TEAM_NULL;
   return ret;
 }
 
-dart_ret_t dart_team_myid(dart_team_t teamid, dart_unit_t *myid)
+dart_ret_t dart_team_clone(dart_team_t team, dart_team_t *newteam)
 {
-  dart_ret_t ret;
+  dart_group_t group;
+  dart_ret_t ret = dart_team_get_group(team, &group);
+  if (ret != DART_OK) {
+    *newteam = DART_TEAM_NULL;
+    return ret;
+  }
+  ret = dart_team_create(team, group, newteam);
+  dart_group_destroy(&group);
+  return ret;
+}
 
-  if (teamid == DART_TEAM_NULL) {
-    return DART_ERR_INVAL;
+dart_ret_t dart_team_myid(dart_team_t teamid, dart_team_unit_t *myid)
+{
+  int slot;
+
+  *myid = DART_UNDEFINED_TEAM_UNIT_ID;
+  if (teamid == DART_TEAM_ALL) {
+    myid->id = _glob_myid;
+    return DART_OK;
   }
-  if (teamid == DART_TEAM_ALL) 
-  {
-    ret = DART_OK;
-    *myid = _glob_myid;
-  } 
-  else 
-  {
-    int slot;
-    slot = shmem_syncarea_findteam(teamid);
-    if( SLOT_IS_VALID(slot) ) {
-      *myid = teams[slot].myid; 
-      ret = DART_OK;
-    } else {
-      ret = DART_ERR_INVAL;
-    }
+  slot = team_slot(teamid);
+  if (!SLOT_IS_VALID(slot)) {
+    return DART_ERR_INVAL;
   }
-  return ret;
+  myid->id = teams[slot].myid;
+  return DART_OK;
 }
 
 dart_ret_t dart_team_size(dart_team_t teamid, size_t *size)
 {
-  dart_ret_t ret = DART_ERR_INVAL;
-  int slot = -1;
-  *size = 0;
+  int slot;
 
-  if (teamid == DART_TEAM_NULL) {
-    return ret;
-  }
+  *size = 0;
   if (teamid == DART_TEAM_ALL) {
-    ret   = DART_OK;
     *size = _glob_size;
-  } else {
-    slot = shmem_syncarea_findteam(teamid);
-    if (SLOT_IS_VALID(slot)) {
-      dart_group_size(&(teams[slot].group), size);
-      ret = DART_OK;
-    } else {
-      ret = DART_ERR_INVAL;
-    }
+    return DART_OK;
   }
-  return ret;
+  slot = team_slot(teamid);
+  if (!SLOT_IS_VALID(slot)) {
+    return DART_ERR_INVAL;
+  }
+  *size = teams[slot].group.nmem;
+  return DART_OK;
 }
 
-dart_ret_t dart_myid(dart_unit_t *myid)
+dart_ret_t dart_myid(dart_global_unit_t *myid)
 {
   DART_INIT_CHECK();
-  *myid = _glob_myid;
+  myid->id = _glob_myid;
   return DART_OK;
 }
 
@@ -270,24 +270,24 @@ dart_ret_t dart_size(size_t *size)
 }
 
 int dart_shmem_team_new(
-  dart_team_t *team, 
-	size_t tsize )
+  dart_team_t *team,
+  size_t tsize )
 {
   int slot;
   dart_team_t newteam;
-  
+
   slot = shmem_syncarea_newteam(&newteam, tsize);
   if (SLOT_IS_VALID(slot)) {
     (*team) = newteam;
-  } 
+  }
   return slot;
 }
 
 dart_ret_t dart_shmem_team_init(
   dart_team_t team,
-  dart_unit_t myid, 
-	size_t tsize, 
-	const dart_group_t *group)
+  dart_unit_t myid,
+  size_t tsize,
+  const dart_group_t group)
 {
   int i, slot;
   if (team == DART_TEAM_ALL)  {
@@ -301,48 +301,59 @@ dart_ret_t dart_shmem_team_init(
   } else {
     slot = shmem_syncarea_findteam(team);
   }
-  
+
   if (!SLOT_IS_VALID(slot)) {
     return DART_ERR_NOTFOUND;
   }
-  
+
   teams[slot].syncslot=slot;
   teams[slot].teamid=team;
-  
+  teams[slot].myid=myid;
+
   // build the group for this team
-  dart_group_create(&(teams[slot].group));
-  if( slot==0 && !group ) {
-    for( i=0; i<tsize; i++ ) {
-      dart_group_addmember(&(teams[slot].group), i);
+  if (slot == 0 && !group) {
+    teams[slot].group.nmem = 0;
+    for (i = 0; i < MAXSIZE_GROUP; i++) {
+      teams[slot].group.g2l[i] = -1;
+      teams[slot].group.l2g[i] = -1;
     }
-  } else  {
-    dart_group_clone(group,
-		    &(teams[slot].group));
+    for (i = 0; i < (int)tsize; i++) {
+      teams[slot].group.g2l[i] = i;
+      teams[slot].group.l2g[i] = i;
+    }
+    teams[slot].group.nmem = tsize;
+  } else {
+    teams[slot].group = *group;
   }
-    
+
   int shmid = shmem_syncarea_get_shmid();
 
-  // TODO: check return value of below 
-  dart_shmem_p2p_init(team, tsize, myid, shmid);
+  if (dart_shmem_p2p_init(team, tsize, myid, shmid) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+  teams[slot].state = VALID;
 
-  // --- from here on, we can use 
+  // --- from here on, we can use
   //          communication in the new team ---
 
-  if (team == DART_TEAM_ALL) 
+  if (team == DART_TEAM_ALL)
   {
+    // the mempool of DART_TEAM_ALL serves non-collective allocations,
+    // the barrier ensures all pipes of the team have been created
+    dart_barrier(DART_TEAM_ALL);
     int res;
     res = dart_memarea_create_mempool(
             DART_TEAM_ALL,
-            tsize, 
-            myid, 
-            1024 * 1024,
+            tsize,
+            myid,
+            dart_shmem_localpool_size(),
             0 /* not aligned */
           );
-    if (res < 0) {
-      return DART_ERR_INVAL;
+    if (res != DART_SEGMENT_LOCAL) {
+      ERROR("Failed to create the local allocation pool (id: %d)", res);
+      return DART_ERR_OTHER;
     }
   }
-  teams[slot].state = VALID;
   return DART_OK;
 }
 
@@ -355,28 +366,21 @@ dart_ret_t dart_shmem_team_delete(dart_team_t teamid,
   dart_ret_t ret;
 
   ret = dart_shmem_team_valid(teamid);
-  if (ret != DART_OK) { 
+  if (ret != DART_OK) {
     return ret;
   }
   int shmid = shmem_syncarea_get_shmid();
-  slot = shmem_syncarea_findteam(teamid);
+  slot = team_slot(teamid);
   if (!SLOT_IS_VALID(slot)) {
     return DART_ERR_INVAL;
   }
 
-#if 0
-  dart_memarea_destroy_mempool( &(teams[slot].mem),
-				0,
-				teamid,
-				myid );
-#endif 
-  
-  // todo: check return value of below
   dart_shmem_p2p_destroy(
     teamid,
     tsize,
     myid,
     shmid);
+  teams[slot].state = NOT_INITIALIZED;
   dart_barrier(teamid);
   if (myid == 0) {
     shmem_syncarea_delteam(teamid, tsize);
@@ -386,111 +390,54 @@ dart_ret_t dart_shmem_team_delete(dart_team_t teamid,
 
 dart_ret_t dart_team_get_group(dart_team_t teamid, dart_group_t *group)
 {
-  dart_ret_t ret;
-  int slot;
-  
-  if( teamid==DART_TEAM_ALL )  {
-    slot=0;
-  } 
-  else {
-    slot = shmem_syncarea_findteam(teamid);
-  }
-      
-  if( SLOT_IS_VALID(slot) ) {
-    ret = dart_group_clone( &(teams[slot].group),
-			   group);
-  } else {
-    ret = DART_ERR_INVAL;
-  }
+  int slot = team_slot(teamid);
 
-  return ret;
+  if (!SLOT_IS_VALID(slot)) {
+    *group = DART_GROUP_NULL;
+    DART_LOG_ERROR("dart_team_get_group ! Unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  return dart_group_clone(&(teams[slot].group), group);
 }
 
 dart_ret_t dart_shmem_team_valid(dart_team_t team)
 {
-  int i;
-
-  for( i=0; i<MAXNUM_TEAMS; i++ ) {
-    if( teams[i].state==VALID && 
-	teams[i].teamid==team ) {
-      return DART_OK;
-    }
-  }
-
-  return DART_ERR_NOTFOUND;
+  return SLOT_IS_VALID(team_slot(team)) ? DART_OK : DART_ERR_NOTFOUND;
 }
 
-#if 0
-dart_memarea_t *dart_shmem_team_get_memarea(dart_team_t team) 
+dart_ret_t dart_team_unit_l2g(dart_team_t teamid,
+			      dart_team_unit_t localid,
+			      dart_global_unit_t *globalid)
 {
-  int i;
-  dart_memarea_t *ret=0;
-  
-  for( i=0; i<MAXNUM_TEAMS; i++ ) {
-    if( teams[i].state==VALID && 
-	teams[i].teamid==team ) {
-      ret = &(teams[i].mem);
-      break;
-    }
-  }
+  int slot = team_slot(teamid);
 
-  return ret;
-}
-#endif
-
-dart_ret_t dart_team_unit_l2g(dart_team_t teamid, 
-			      dart_unit_t localid,
-			      dart_unit_t *globalid)
-{
-  dart_ret_t ret;
-  int slot;
-  
-  if( teamid==DART_TEAM_ALL )  {
-    slot=0;
-  } else {
-    slot = shmem_syncarea_findteam(teamid);
+  *globalid = DART_UNDEFINED_GLOBAL_UNIT_ID;
+  if (!SLOT_IS_VALID(slot)) {
+    return DART_ERR_INVAL;
   }
-  
-  ret=DART_ERR_INVAL;
-
-  if( SLOT_IS_VALID(slot) ) {
-    dart_group_t *group;
-    group = &(teams[slot].group);
-    if (group && (0<=localid) && (localid<=(group->nmem)))
-    {
-      (*globalid) = group->l2g[localid];
-      ret = DART_OK;
-    }
+  struct dart_group_struct *group = &(teams[slot].group);
+  if (localid.id < 0 || localid.id >= group->nmem) {
+    return DART_ERR_INVAL;
   }
-
-  return ret;  
+  globalid->id = group->l2g[localid.id];
+  return DART_OK;
 }
 
 dart_ret_t dart_team_unit_g2l(
-  dart_team_t teamid, 
-  dart_unit_t globalid,
-  dart_unit_t *localid)
+  dart_team_t teamid,
+  dart_global_unit_t globalid,
+  dart_team_unit_t *localid)
 {
-  dart_ret_t ret;
-  int slot;
-  
-  if( teamid==DART_TEAM_ALL )  {
-    slot=0;
-  } else {
-    slot = shmem_syncarea_findteam(teamid);
+  int slot = team_slot(teamid);
+
+  *localid = DART_UNDEFINED_TEAM_UNIT_ID;
+  if (!SLOT_IS_VALID(slot)) {
+    return DART_ERR_INVAL;
   }
-  
-  ret=DART_ERR_INVAL;
-  if( SLOT_IS_VALID(slot) ) {
-    dart_group_t *group;
-    group = &(teams[slot].group);
-
-    if( group && (0<=globalid) ) 
-      {
-	(*localid) = group->g2l[globalid];
-	ret = DART_OK;
-      }
+  if (globalid.id < 0 || globalid.id >= MAXSIZE_GROUP) {
+    return DART_ERR_INVAL;
   }
-
-  return ret;  
+  // non-members are mapped to DART_UNDEFINED_UNIT_ID
+  localid->id = teams[slot].group.g2l[globalid.id];
+  return DART_OK;
 }
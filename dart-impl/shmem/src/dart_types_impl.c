@@ -0,0 +1,613 @@
+/**
+ * \file dart_types_impl.c
+ *
+ * Data types and reduction operations of the shared memory backend.
+ *
+ * Transfers between units are plain memory copies, so derived data types
+ * are described by their block layout and resolved in
+ * dart__shmem__datatype_copy.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/assert.h>
+
+#include <dash/dart/if/dart_types.h>
+#include <dash/dart/shmem/dart_types_impl.h>
+#include <dash/dart/shmem/shmem_barriers_if.h>
+
+dart_datatype_struct_t dart__shmem__base_types[DART_TYPE_LAST];
+
+static void
+init_basic_datatype(
+  dart_datatype_t dart_type_id,
+  size_t          size)
+{
+  dart_datatype_struct_t *dts = &dart__shmem__base_types[dart_type_id];
+  dts->base_type = dart_type_id;
+  dts->kind      = DART_KIND_BASIC;
+  dts->size      = size;
+  // basic types only represent a single element
+  dts->num_elem  = (size > 0) ? 1 : 0;
+}
+
+dart_ret_t dart__shmem__datatype_init()
+{
+  init_basic_datatype(DART_TYPE_UNDEFINED,   0);
+  init_basic_datatype(DART_TYPE_BYTE,        sizeof(char));
+  init_basic_datatype(DART_TYPE_SHORT,       sizeof(short));
+  init_basic_datatype(DART_TYPE_INT,         sizeof(int));
+  init_basic_datatype(DART_TYPE_UINT,        sizeof(unsigned int));
+  init_basic_datatype(DART_TYPE_LONG,        sizeof(long));
+  init_basic_datatype(DART_TYPE_ULONG,       sizeof(unsigned long));
+  init_basic_datatype(DART_TYPE_LONGLONG,    sizeof(long long));
+  init_basic_datatype(DART_TYPE_ULONGLONG,   sizeof(unsigned long long));
+  init_basic_datatype(DART_TYPE_FLOAT,       sizeof(float));
+  init_basic_datatype(DART_TYPE_DOUBLE,      sizeof(double));
+  init_basic_datatype(DART_TYPE_LONG_DOUBLE, sizeof(long double));
+  return DART_OK;
+}
+
+dart_ret_t
+dart_type_create_strided(
+  dart_datatype_t   basetype,
+  size_t            stride,
+  size_t            blocklen,
+  dart_datatype_t * newtype)
+{
+  if (newtype == NULL) {
+    DART_LOG_ERROR("newtype pointer may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+
+  *newtype = DART_TYPE_UNDEFINED;
+
+  if (!dart__shmem__datatype_iscontiguous(basetype)) {
+    DART_LOG_ERROR("Only contiguous data types allowed in strided datatypes!");
+    return DART_ERR_INVAL;
+  }
+
+  // the stride may be smaller than the block length if the type
+  // describes a single block
+  if (blocklen == 0 || stride == 0) {
+    DART_LOG_ERROR("dart_type_create_strided: invalid block length %zu "
+                   "for stride %zu", blocklen, stride);
+    return DART_ERR_INVAL;
+  }
+
+  dart_datatype_struct_t *new_struct = malloc(sizeof(dart_datatype_struct_t));
+  new_struct->base_type      = basetype;
+  new_struct->kind           = DART_KIND_STRIDED;
+  new_struct->num_elem       = blocklen;
+  new_struct->size           = dart__shmem__datatype_sizeof(basetype);
+  new_struct->strided.stride = stride;
+
+  *newtype = (dart_datatype_t)new_struct;
+
+  DART_LOG_TRACE("Created new strided data type %p", (void*)new_struct);
+  return DART_OK;
+}
+
+dart_ret_t
+dart_type_create_indexed(
+  dart_datatype_t   basetype,
+  size_t            count,
+  const size_t      blocklen[],
+  const size_t      offset[],
+  dart_datatype_t * newtype)
+{
+  if (newtype == NULL) {
+    DART_LOG_ERROR("newtype pointer may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+
+  *newtype = DART_TYPE_UNDEFINED;
+
+  if (!dart__shmem__datatype_iscontiguous(basetype)) {
+    DART_LOG_ERROR("Only contiguous data types allowed in indexed datatypes!");
+    return DART_ERR_INVAL;
+  }
+
+  if (count == 0) {
+    DART_LOG_ERROR("dart_type_create_indexed: count may not be zero");
+    return DART_ERR_INVAL;
+  }
+
+  size_t * blocklens = malloc(sizeof(size_t) * count);
+  size_t * offsets   = malloc(sizeof(size_t) * count);
+  size_t   num_elem  = 0;
+  size_t   extent    = 0;
+  for (size_t i = 0; i < count; ++i) {
+    blocklens[i] = blocklen[i];
+    offsets[i]   = offset[i];
+    num_elem    += blocklen[i];
+    if (offset[i] + blocklen[i] > extent) {
+      extent = offset[i] + blocklen[i];
+    }
+  }
+
+  if (num_elem == 0) {
+    DART_LOG_ERROR("dart_type_create_indexed: type contains no elements");
+    free(blocklens);
+    free(offsets);
+    return DART_ERR_INVAL;
+  }
+
+  dart_datatype_struct_t *new_struct = malloc(sizeof(dart_datatype_struct_t));
+  new_struct->base_type          = basetype;
+  new_struct->kind               = DART_KIND_INDEXED;
+  new_struct->num_elem           = num_elem;
+  new_struct->size               = dart__shmem__datatype_sizeof(basetype);
+  new_struct->indexed.blocklens  = blocklens;
+  new_struct->indexed.offsets    = offsets;
+  new_struct->indexed.num_blocks = count;
+  new_struct->indexed.extent     = extent;
+
+  *newtype = (dart_datatype_t)new_struct;
+
+  DART_LOG_TRACE("Created new indexed data type %p with %zu elements",
+                 (void*)new_struct, num_elem);
+  return DART_OK;
+}
+
+dart_ret_t
+dart_type_create_custom(
+  size_t            num_bytes,
+  dart_datatype_t * newtype)
+{
+  if (newtype == NULL) {
+    DART_LOG_ERROR("newtype pointer may not be NULL!");
+    return DART_ERR_INVAL;
+  }
+
+  *newtype = DART_TYPE_UNDEFINED;
+
+  if (num_bytes == 0) {
+    DART_LOG_ERROR("dart_type_create_custom: size may not be zero");
+    return DART_ERR_INVAL;
+  }
+
+  dart_datatype_struct_t *new_struct = malloc(sizeof(dart_datatype_struct_t));
+  new_struct->base_type = DART_TYPE_BYTE;
+  new_struct->kind      = DART_KIND_CUSTOM;
+  new_struct->num_elem  = 1;
+  new_struct->size      = num_bytes;
+
+  *newtype = (dart_datatype_t)new_struct;
+
+  DART_LOG_TRACE("Created new custom data type %p with %zu bytes",
+                 (void*)new_struct, num_bytes);
+  return DART_OK;
+}
+
+dart_ret_t
+dart_type_destroy(dart_datatype_t *dart_type_ptr)
+{
+  if (dart_type_ptr == NULL) {
+    return DART_ERR_INVAL;
+  }
+
+  dart_datatype_struct_t *dts = dart__shmem__datatype_struct(*dart_type_ptr);
+
+  if (dts->kind == DART_KIND_BASIC) {
+    DART_LOG_ERROR("dart_type_destroy: Cannot destroy basic type!");
+    return DART_ERR_INVAL;
+  }
+
+  if (dts->kind == DART_KIND_INDEXED) {
+    free(dts->indexed.blocklens);
+    free(dts->indexed.offsets);
+  }
+
+  free(dts);
+  *dart_type_ptr = DART_TYPE_UNDEFINED;
+
+  return DART_OK;
+}
+
+/*
+ * Position in the layout of a data type, in elements.
+ */
+typedef struct {
+  const dart_datatype_struct_t * dts;
+  /// global index of the current block
+  size_t                         block;
+  /// element offset of the current position
+  size_t                         offset;
+  /// number of elements left in the current block
+  size_t                         remain;
+} type_cursor_t;
+
+static void
+cursor_set_block(type_cursor_t *cur, size_t block)
+{
+  const dart_datatype_struct_t *dts = cur->dts;
+  cur->block = block;
+  if (dts->kind == DART_KIND_STRIDED) {
+    cur->offset = block * dts->strided.stride;
+    cur->remain = dts->num_elem;
+  } else {
+    size_t rep  = block / dts->indexed.num_blocks;
+    size_t idx  = block % dts->indexed.num_blocks;
+    cur->offset = rep * dts->indexed.extent + dts->indexed.offsets[idx];
+    cur->remain = dts->indexed.blocklens[idx];
+  }
+}
+
+static void
+cursor_init(type_cursor_t *cur, dart_datatype_t type, size_t nelem)
+{
+  cur->dts = dart__shmem__datatype_struct(type);
+  if (dart__shmem__datatype_iscontiguous(type)) {
+    cur->block  = 0;
+    cur->offset = 0;
+    cur->remain = nelem;
+  } else {
+    cursor_set_block(cur, 0);
+  }
+}
+
+static void
+cursor_advance(type_cursor_t *cur, size_t nelem)
+{
+  cur->offset += nelem;
+  cur->remain -= nelem;
+  if (cur->remain == 0 && cur->dts->kind != DART_KIND_BASIC
+                       && cur->dts->kind != DART_KIND_CUSTOM) {
+    // skip empty blocks of indexed types
+    do {
+      cursor_set_block(cur, cur->block + 1);
+    } while (cur->remain == 0);
+  }
+}
+
+dart_ret_t dart__shmem__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem)
+{
+  dart_datatype_struct_t *src_dts = dart__shmem__datatype_struct(src_type);
+  dart_datatype_struct_t *dst_dts = dart__shmem__datatype_struct(dst_type);
+  size_t esize = src_dts->size;
+
+  if (esize != dst_dts->size) {
+    DART_LOG_ERROR("dart__shmem__datatype_copy: "
+                   "mismatching element sizes (%zu and %zu)",
+                   esize, dst_dts->size);
+    return DART_ERR_INVAL;
+  }
+
+  if (nelem == 0) {
+    return DART_OK;
+  }
+
+  if (dart__shmem__datatype_iscontiguous(src_type) &&
+      dart__shmem__datatype_iscontiguous(dst_type)) {
+    memcpy(dst, src, nelem * esize);
+    return DART_OK;
+  }
+
+  if ((nelem % src_dts->num_elem) != 0 || (nelem % dst_dts->num_elem) != 0) {
+    DART_LOG_ERROR("dart__shmem__datatype_copy: number of elements (%zu) "
+                   "is not a multiple of the type's block size", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  type_cursor_t src_cur;
+  type_cursor_t dst_cur;
+  cursor_init(&src_cur, src_type, nelem);
+  cursor_init(&dst_cur, dst_type, nelem);
+
+  while (nelem > 0) {
+    size_t n = src_cur.remain;
+    if (dst_cur.remain < n) n = dst_cur.remain;
+    if (nelem < n)          n = nelem;
+    memcpy((char *)dst + dst_cur.offset * esize,
+           (const char *)src + src_cur.offset * esize,
+           n * esize);
+    nelem -= n;
+    if (nelem > 0) {
+      cursor_advance(&src_cur, n);
+      cursor_advance(&dst_cur, n);
+    }
+  }
+  return DART_OK;
+}
+
+/*
+ * Reduction kernels of the predefined operations, one for every
+ * basic type.
+ */
+
+#define DART_SHMEM_REDUCE_LOOP(__type, __expr)                  \
+  do {                                                         \
+    const __type * a = (const __type *)in;                     \
+    __type       * b = (__type *)inout;                        \
+    for (size_t i = 0; i < nelem; ++i) {                       \
+      b[i] = (__expr);                                         \
+    }                                                          \
+  } while (0)
+
+#define DART_SHMEM_REDUCE_BITOPS(__type)                        \
+    case DART_OP_BAND:                                         \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i] & b[i]);             \
+      return DART_OK;                                          \
+    case DART_OP_BOR:                                          \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i] | b[i]);             \
+      return DART_OK;                                          \
+    case DART_OP_BXOR:                                         \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i] ^ b[i]);             \
+      return DART_OK;
+
+#define DART_SHMEM_DEFINE_REDUCE(__name, __type, __bitops)      \
+static dart_ret_t reduce_##__name(                             \
+  dart_operation_t op, const void *in, void *inout, size_t nelem) \
+{                                                              \
+  switch (op) {                                                \
+    case DART_OP_MIN:                                          \
+      DART_SHMEM_REDUCE_LOOP(__type, (a[i] < b[i]) ? a[i] : b[i]); \
+      return DART_OK;                                          \
+    case DART_OP_MAX:                                          \
+      DART_SHMEM_REDUCE_LOOP(__type, (a[i] > b[i]) ? a[i] : b[i]); \
+      return DART_OK;                                          \
+    case DART_OP_SUM:                                          \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i] + b[i]);             \
+      return DART_OK;                                          \
+    case DART_OP_PROD:                                         \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i] * b[i]);             \
+      return DART_OK;                                          \
+    case DART_OP_LAND:                                         \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i] && b[i]);            \
+      return DART_OK;                                          \
+    case DART_OP_LOR:                                          \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i] || b[i]);            \
+      return DART_OK;                                          \
+    case DART_OP_LXOR:                                         \
+      DART_SHMEM_REDUCE_LOOP(__type, (!a[i]) != (!b[i]));      \
+      return DART_OK;                                          \
+    case DART_OP_REPLACE:                                      \
+      DART_SHMEM_REDUCE_LOOP(__type, a[i]);                    \
+      return DART_OK;                                          \
+    case DART_OP_MINMAX:                                       \
+      if ((nelem % 2) != 0) {                                  \
+        DART_LOG_ERROR("DART_OP_MINMAX requires multiple of two elements"); \
+        return DART_ERR_INVAL;                                 \
+      }                                                        \
+      {                                                        \
+        const __type * a = (const __type *)in;                 \
+        __type       * b = (__type *)inout;                    \
+        for (size_t i = 0; i < nelem; i += 2) {                \
+          if (a[i + DART_OP_MINMAX_MIN] < b[i + DART_OP_MINMAX_MIN]) \
+            b[i + DART_OP_MINMAX_MIN] = a[i + DART_OP_MINMAX_MIN];   \
+          if (a[i + DART_OP_MINMAX_MAX] > b[i + DART_OP_MINMAX_MAX]) \
+            b[i + DART_OP_MINMAX_MAX] = a[i + DART_OP_MINMAX_MAX];   \
+        }                                                      \
+      }                                                        \
+      return DART_OK;                                          \
+    __bitops                                                   \
+    default:                                                   \
+      return DART_ERR_INVAL;                                   \
+  }                                                            \
+}
+
+DART_SHMEM_DEFINE_REDUCE(byte,       char,
+                         DART_SHMEM_REDUCE_BITOPS(char))
+DART_SHMEM_DEFINE_REDUCE(short,      short,
+                         DART_SHMEM_REDUCE_BITOPS(short))
+DART_SHMEM_DEFINE_REDUCE(int,        int,
+                         DART_SHMEM_REDUCE_BITOPS(int))
+DART_SHMEM_DEFINE_REDUCE(uint,       unsigned int,
+                         DART_SHMEM_REDUCE_BITOPS(unsigned int))
+DART_SHMEM_DEFINE_REDUCE(long,       long,
+                         DART_SHMEM_REDUCE_BITOPS(long))
+DART_SHMEM_DEFINE_REDUCE(ulong,      unsigned long,
+                         DART_SHMEM_REDUCE_BITOPS(unsigned long))
+DART_SHMEM_DEFINE_REDUCE(longlong,   long long,
+                         DART_SHMEM_REDUCE_BITOPS(long long))
+DART_SHMEM_DEFINE_REDUCE(ulonglong,  unsigned long long,
+                         DART_SHMEM_REDUCE_BITOPS(unsigned long long))
+DART_SHMEM_DEFINE_REDUCE(float,      float,       )
+DART_SHMEM_DEFINE_REDUCE(double,     double,      )
+DART_SHMEM_DEFINE_REDUCE(longdouble, long double, )
+
+dart_ret_t dart__shmem__op_apply(
+  dart_operation_t   op,
+  dart_datatype_t    dtype,
+  const void       * in,
+  void             * inout,
+  size_t             nelem)
+{
+  dart_ret_t ret = DART_ERR_INVAL;
+
+  if (op == DART_OP_NO_OP) {
+    return DART_OK;
+  }
+  if (op >= DART_OP_LAST) {
+    struct dart_operation_struct *dop = (struct dart_operation_struct *)op;
+    dop->op(in, inout, nelem, dop->user_data);
+    return DART_OK;
+  }
+
+  dart_datatype_struct_t *dts = dart__shmem__datatype_struct(dtype);
+  if (dts->kind == DART_KIND_CUSTOM) {
+    if (op == DART_OP_REPLACE) {
+      memcpy(inout, in, nelem * dts->size);
+      return DART_OK;
+    }
+  } else {
+    switch (dts->base_type) {
+      case DART_TYPE_BYTE:
+        ret = reduce_byte(op, in, inout, nelem); break;
+      case DART_TYPE_SHORT:
+        ret = reduce_short(op, in, inout, nelem); break;
+      case DART_TYPE_INT:
+        ret = reduce_int(op, in, inout, nelem); break;
+      case DART_TYPE_UINT:
+        ret = reduce_uint(op, in, inout, nelem); break;
+      case DART_TYPE_LONG:
+        ret = reduce_long(op, in, inout, nelem); break;
+      case DART_TYPE_ULONG:
+        ret = reduce_ulong(op, in, inout, nelem); break;
+      case DART_TYPE_LONGLONG:
+        ret = reduce_longlong(op, in, inout, nelem); break;
+      case DART_TYPE_ULONGLONG:
+        ret = reduce_ulonglong(op, in, inout, nelem); break;
+      case DART_TYPE_FLOAT:
+        ret = reduce_float(op, in, inout, nelem); break;
+      case DART_TYPE_DOUBLE:
+        ret = reduce_double(op, in, inout, nelem); break;
+      case DART_TYPE_LONG_DOUBLE:
+        ret = reduce_longdouble(op, in, inout, nelem); break;
+      default:
+        break;
+    }
+  }
+  if (ret != DART_OK) {
+    DART_LOG_ERROR("dart__shmem__op_apply: operation %lu not supported "
+                   "on data type %ld", (unsigned long)op, (long)dtype);
+  }
+  return ret;
+}
+
+dart_ret_t
+dart_op_create(
+  dart_operator_t    op,
+  void             * userdata,
+  bool               commute,
+  dart_datatype_t    dtype,
+  bool               dtype_is_tmp,
+  dart_operation_t * new_op)
+{
+  // the data type is owned by the caller in any case
+  (void)commute;
+  (void)dtype_is_tmp;
+  if (new_op == NULL || op == NULL) {
+    DART_LOG_ERROR("dart_op_create: invalid arguments");
+    return DART_ERR_INVAL;
+  }
+  if (!dart__shmem__datatype_iscontiguous(dtype)) {
+    DART_LOG_ERROR("dart_op_create: only contiguous data types allowed");
+    return DART_ERR_INVAL;
+  }
+  struct dart_operation_struct *dop = malloc(sizeof(*dop));
+  dop->op           = op;
+  dop->user_data    = userdata;
+  dop->dtype        = dtype;
+  *new_op = (dart_operation_t)dop;
+  return DART_OK;
+}
+
+dart_ret_t
+dart_op_destroy(dart_operation_t *op)
+{
+  if (op == NULL || *op < DART_OP_LAST) {
+    DART_LOG_ERROR("dart_op_destroy: Cannot destroy predefined operation!");
+    return DART_ERR_INVAL;
+  }
+  free((struct dart_operation_struct *)*op);
+  *op = DART_OP_UNDEFINED;
+  return DART_OK;
+}
+
+/*
+ * Atomic updates on memory shared between processes.
+ *
+ * Elements of 1, 2, 4 or 8 bytes are updated in a compare-and-swap loop,
+ * all other elements are updated while holding one of the process-shared
+ * atomic locks in the syncarea.
+ */
+
+#define DART_SHMEM_ATOMIC_RMW(__type)                                   \
+  do {                                                                 \
+    __type * addr    = (__type *)target;                               \
+    __type   old_val = __atomic_load_n(addr, __ATOMIC_ACQUIRE);        \
+    __type   new_val;                                                  \
+    do {                                                               \
+      memcpy(buf, &old_val, sizeof(__type));                           \
+      ret = dart__shmem__op_apply(op, dtype, value, buf, 1);           \
+      if (ret != DART_OK) {                                            \
+        return ret;                                                    \
+      }                                                                \
+      memcpy(&new_val, buf, sizeof(__type));                           \
+    } while (!__atomic_compare_exchange_n(                             \
+               addr, &old_val, new_val, false,                         \
+               __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));                   \
+    if (result != NULL) {                                              \
+      memcpy(result, &old_val, sizeof(__type));                        \
+    }                                                                  \
+  } while (0)
+
+#define DART_SHMEM_ATOMIC_CAS(__type)                                   \
+  do {                                                                 \
+    __type expected;                                                   \
+    __type desired;                                                    \
+    memcpy(&expected, compare, sizeof(__type));                        \
+    memcpy(&desired,  value,   sizeof(__type));                        \
+    __atomic_compare_exchange_n(                                       \
+      (__type *)target, &expected, desired, false,                     \
+      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);                             \
+    memcpy(result, &expected, sizeof(__type));                         \
+  } while (0)
+
+dart_ret_t dart__shmem__atomic_apply(
+  uint64_t           key,
+  void             * target,
+  const void       * value,
+  void             * result,
+  dart_datatype_t    dtype,
+  dart_operation_t   op)
+{
+  dart_ret_t ret;
+  size_t     size = dart__shmem__datatype_sizeof(dtype);
+  char       buf[sizeof(uint64_t)];
+
+  switch (size) {
+    case 1: DART_SHMEM_ATOMIC_RMW(uint8_t);  return DART_OK;
+    case 2: DART_SHMEM_ATOMIC_RMW(uint16_t); return DART_OK;
+    case 4: DART_SHMEM_ATOMIC_RMW(uint32_t); return DART_OK;
+    case 8: DART_SHMEM_ATOMIC_RMW(uint64_t); return DART_OK;
+    default: break;
+  }
+
+  pthread_mutex_t *lock = shmem_syncarea_atomic_lock(key);
+  pthread_mutex_lock(lock);
+  if (result != NULL) {
+    memcpy(result, target, size);
+  }
+  ret = dart__shmem__op_apply(op, dtype, value, target, 1);
+  pthread_mutex_unlock(lock);
+  return ret;
+}
+
+dart_ret_t dart__shmem__atomic_cas(
+  uint64_t           key,
+  void             * target,
+  const void       * value,
+  const void       * compare,
+  void             * result,
+  dart_datatype_t    dtype)
+{
+  size_t size = dart__shmem__datatype_sizeof(dtype);
+
+  switch (size) {
+    case 1: DART_SHMEM_ATOMIC_CAS(uint8_t);  return DART_OK;
+    case 2: DART_SHMEM_ATOMIC_CAS(uint16_t); return DART_OK;
+    case 4: DART_SHMEM_ATOMIC_CAS(uint32_t); return DART_OK;
+    case 8: DART_SHMEM_ATOMIC_CAS(uint64_t); return DART_OK;
+    default: break;
+  }
+
+  pthread_mutex_t *lock = shmem_syncarea_atomic_lock(key);
+  pthread_mutex_lock(lock);
+  memcpy(result, target, size);
+  if (memcmp(target, compare, size) == 0) {
+    memcpy(target, value, size);
+  }
+  pthread_mutex_unlock(lock);
+  return DART_OK;
+}
@@ -48,8 +48,26 @@ int shmem_syncarea_init(int numprocs, void* shm_addr, int shmid)
     (area->locks[i]).inuse=0;
   }
 
+  for( i=0; i<MAXNUM_LOCKS; i++ ) {
+    PTHREAD_SAFE(pthread_mutex_init(&((area->rwlocks[i]).writer_lock),
+				    &mutex_shared_attr));
+    (area->rwlocks[i]).writer=0;
+    (area->rwlocks[i]).readers=0;
+    (area->rwlocks[i]).inuse=0;
+  }
+
+  for( i=0; i<NUM_ATOMIC_LOCKS; i++ ) {
+    PTHREAD_SAFE(pthread_mutex_init(&(area->atomic_locks[i]),
+				    &mutex_shared_attr));
+  }
+
   PTHREAD_SAFE(pthread_mutexattr_destroy(&mutex_shared_attr));
 
+
+  for( i=0; i<MAXNUM_MEMPOOLS; i++ ) {
+    area->mempool_inuse[i]=0;
+  }
+
   
   sysv_barrier_create( &((area->teams[0]).barr), numprocs );
   area->teams[0].teamid = DART_TEAM_ALL;
@@ -58,6 +76,10 @@ int shmem_syncarea_init(int numprocs, void* shm_addr, int shmid)
 
   for( i=0; i<MAXNUM_UNITS; i++ ) {
     area->unitstate[i] = UNIT_STATE_NOT_INITIALIZED;
+    int j;
+    for( j=0; j<NUM_LOCALPOOL_CHUNKS; j++ ) {
+      area->localpool_chunks[i][j] = -1;
+    }
   }
 
 #ifdef USE_EVENTFD
@@ -177,6 +199,47 @@ int shmem_syncarea_delteam(dart_team_t teamid, int numprocs)
   return 0;
 }
 
+// reserve a segment id for a new mempool,
+// returns -1 if all ids are in use
+int shmem_syncarea_newpool()
+{
+  int i, poolid=-1;
+
+  PTHREAD_SAFE_NORET(pthread_mutex_lock(&(area->barrier_lock)));
+
+  for( i=0; i<MAXNUM_MEMPOOLS; i++ ) {
+    if( !(area->mempool_inuse[i]) ) {
+      area->mempool_inuse[i]=1;
+      poolid=i;
+      break;
+    }
+  }
+
+  PTHREAD_SAFE_NORET(pthread_mutex_unlock(&(area->barrier_lock)));
+  return poolid;
+}
+
+int shmem_syncarea_delpool(int poolid)
+{
+  if( poolid<0 || poolid>=MAXNUM_MEMPOOLS ) {
+    return -1;
+  }
+
+  PTHREAD_SAFE_NORET(pthread_mutex_lock(&(area->barrier_lock)));
+  area->mempool_inuse[poolid]=0;
+  PTHREAD_SAFE_NORET(pthread_mutex_unlock(&(area->barrier_lock)));
+  return 0;
+}
+
+pthread_mutex_t * shmem_syncarea_atomic_lock(uint64_t key)
+{
+  // mix the bits so that neighboring elements use different locks
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  return &(area->atomic_locks[key % NUM_ATOMIC_LOCKS]);
+}
+
 // do a wait for barrier at slot 'slot'"
 int shmem_syncarea_barrier_wait(int slot) 
 {
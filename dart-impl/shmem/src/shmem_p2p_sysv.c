@@ -16,6 +16,8 @@
 #include <dash/dart/shmem/dart_helper_thread.h>
 #endif
 
+fifo_pair_t team2fifos[MAXNUM_TEAMS][MAXSIZE_GROUP];
+
 int dart_shmem_mkfifo(char *pname) {
   if (mkfifo(pname, 0666) < 0)
     {
@@ -79,28 +81,42 @@ int dart_shmem_p2p_destroy(dart_team_t teamid, size_t tsize,
 
   for (i = 0; i < tsize; i++)
     {
+      if (team2fifos[slot][i].readfrom >= 0)
+	close(team2fifos[slot][i].readfrom);
+      if (team2fifos[slot][i].writeto >= 0)
+	close(team2fifos[slot][i].writeto);
+      team2fifos[slot][i].readfrom = -1;
+      team2fifos[slot][i].writeto  = -1;
+
       if ((pname = team2fifos[slot][i].pname_read))
 	{
 	  DEBUG("unlinking '%s'", pname);
 	  if(pname && unlink(pname) == -1)
 	    ERRNO("unlink '%s'", pname);
-	  pname=0;
 	}
+      free(team2fifos[slot][i].pname_read);
+      free(team2fifos[slot][i].pname_write);
+      team2fifos[slot][i].pname_read  = 0;
+      team2fifos[slot][i].pname_write = 0;
     }
   return DART_OK;
 }
 
-int dart_shmem_send(void *buf, size_t nbytes, 
+int dart_shmem_send(const void *buf, size_t nbytes, 
 		    dart_team_t teamid, dart_unit_t dest)
 {
   int ret, slot;
+  size_t offs;
 
   slot = shmem_syncarea_findteam(teamid);
 
   if (team2fifos[slot][dest].writeto < 0)
     {
-      ret = team2fifos[slot][dest].writeto = 
-	open( team2fifos[slot][dest].pname_write, O_WRONLY);
+      // opening the pipe for reading and writing does not block
+      // until the receiver opened it, so messages that fit into
+      // the pipe buffer can be sent before the receive is posted
+      ret = team2fifos[slot][dest].writeto =
+	open( team2fifos[slot][dest].pname_write, O_RDWR);
       if (ret < 0)
 	{
 	  fprintf(stderr, "Error sending to %d (pipename: '%s') ret=%d\n",
@@ -108,9 +124,16 @@ int dart_shmem_send(void *buf, size_t nbytes,
 	  return -1;
 	}
     }
-  ret = write(team2fifos[slot][dest].writeto, buf, nbytes);
-  
-  return ret;
+  offs = 0;
+  while (offs < nbytes) {
+    ret = write(team2fifos[slot][dest].writeto,
+		((const char*)buf)+offs, nbytes-offs);
+    if (ret < 0)
+      return ret;
+    offs += ret;
+  }
+
+  return offs;
 }
 
 int dart_shmem_sendevt(void *buf, size_t nbytes, 
@@ -141,7 +164,7 @@ int dart_shmem_recvevt(void *buf, size_t nbytes,
 int dart_shmem_recv(void *buf, size_t nbytes,
 		    dart_team_t teamid, dart_unit_t source)
 {
-  int offs;
+  size_t offs;
   int ret  = 0;
   int slot = shmem_syncarea_findteam(teamid);
   
@@ -157,17 +180,17 @@ int dart_shmem_recv(void *buf, size_t nbytes,
   }
   offs = 0; 
   while (offs<nbytes) {
-    ret = read(team2fifos[slot][source].readfrom, 
-	       buf+offs, nbytes-offs);
-    if (ret < 0) 
+    ret = read(team2fifos[slot][source].readfrom,
+	       ((char*)buf)+offs, nbytes-offs);
+    if (ret <= 0)
       break;
      offs+=ret;
   }
   if (offs != nbytes) {
-    ERROR("read only %d bytes error=%s\n", 
+    ERROR("read only %zu bytes error=%s\n",
 	  offs, strerror(errno));
   }
-  return (ret != nbytes) ? -999 : 0;
+  return (offs != nbytes) ? -999 : 0;
 }
 
 
@@ -8,7 +8,7 @@
 #define MSGLEN  800000
 #define REPEAT  1000
 
-int dart_shmem_send(void *buf, size_t nbytes, 
+int dart_shmem_send(const void *buf, size_t nbytes, 
 		    dart_team_t teamid, dart_unit_t dest);
 int dart_shmem_recv(void *buf, size_t nbytes,
 		    dart_team_t teamid, dart_unit_t source);
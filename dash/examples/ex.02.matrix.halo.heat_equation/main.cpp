@@ -121,49 +121,19 @@ int main(int argc, char *argv[])
     auto& current_matrix = current_halo->matrix();
     auto& new_matrix = new_halo->matrix();
 
-    // Update Halos asynchroniously
-    current_halo->update_async();
-
-    // optimized calculation of inner matrix elements
-    auto* current_begin = current_matrix.lbegin();
     auto* new_begin = new_matrix.lbegin();
-#if 0
-    for (auto i = inner_start; i < inner_end; i += offset) {
-      auto* center = current_begin + i;
-      auto* center_y_plus = center + offset;
-      auto* center_y_minus = center - offset;
-      for (auto j = 0; j < offset - 2;
-           ++j, ++center, ++center_y_plus, ++center_y_minus) {
-        /*auto dtheta =
-            (*(center - 1) + *(center + 1) - 2 * (*center)) / (dx * dx) +
-            (*(center_y_minus) + *(center_y_plus) - 2 * (*center)) / (dy * dy);
-        *(new_begin + i + j) = *center + k * dtheta * dt;*/
-        *(new_begin + i + j) = calc(center, center_y_minus, center_y_plus, center - 1, center + 1);
-      }
-    }
-#endif
-    // slow version
-    auto it_end = current_op->inner.end();
-    for(auto it = current_op->inner.begin(); it != it_end; ++it)
-    {
-      auto core = *it;
-      auto dtheta = (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
-                    (it.value_at(2) + it.value_at(3) - 2 * core) /(dy * dy);
-      new_begin[it.lpos()] = core + k * dtheta * dt;
-    }
-
-    // Wait until all Halo updates ready
-    current_halo->wait();
-
-    // Calculation of boundary Halo elements
-    auto it_bend = current_op->boundary.end();
-    for (auto it = current_op->boundary.begin(); it != it_bend; ++it) {
-      auto core = *it;
-      double dtheta =
+
+    // Updates the halos asynchroniously, calculates the inner elements
+    // meanwhile and the boundary elements as soon as their halos arrived
+    current_op->apply(
+      [&](const auto& it) {
+        auto core = *it;
+        auto dtheta =
           (it.value_at(0) + it.value_at(1) - 2 * core) / (dx * dx) +
           (it.value_at(2) + it.value_at(3) - 2 * core) / (dy * dy);
-      new_begin[it.lpos()] = core + k * dtheta * dt;
-    }
+        return core + k * dtheta * dt;
+      },
+      new_begin);
 
     // swap current matrix and current halo matrix
     std::swap(current_halo, new_halo);
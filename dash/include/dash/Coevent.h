@@ -9,11 +9,81 @@
 
 #include <dash/Algorithm.h>
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 #include <dash/coarray/CoEventIter.h>
 #include <dash/coarray/CoEventRef.h>
 
 namespace dash {
 
+class Coevent;
+
+namespace coarray {
+
+template<typename CoeventIter>
+CoeventIter wait_any(CoeventIter first, CoeventIter last, int count = 1);
+
+template<typename CoeventIter>
+void wait_all(CoeventIter first, CoeventIter last, int count = 1);
+
+namespace detail {
+
+/**
+ * Backoff for waiting on a counter in local memory: spins first, then
+ * yields the processor and finally sleeps for exponentially growing
+ * intervals so that idle waiting does not occupy the core.
+ */
+class SpinBackoff {
+private:
+  static constexpr int spin_rounds  = 64;
+  static constexpr int yield_rounds = 128;
+  static constexpr int max_sleep_us = 256;
+
+public:
+  /**
+   * Pause before polling again.
+   *
+   * \return  true if the spinning phase is over and the caller should
+   *          trigger progress of the communication layer.
+   */
+  inline bool pause() {
+    if (_round < spin_rounds) {
+      for (int i = 0; i < (1 << (_round / 8)); ++i) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        __asm__ __volatile__("" ::: "memory");
+#endif
+      }
+      ++_round;
+      return false;
+    }
+    if (_round < yield_rounds) {
+      std::this_thread::yield();
+      ++_round;
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(_sleep_us));
+    _sleep_us = std::min(2 * _sleep_us, max_sleep_us);
+    return true;
+  }
+
+  inline void reset() {
+    _round    = 0;
+    _sleep_us = 1;
+  }
+
+private:
+  int _round    = 0;
+  int _sleep_us = 1;
+};
+
+} // namespace detail
+} // namespace coarray
+
 /**
  * \ingroup DashCoarrayConcept
  *
@@ -22,6 +92,9 @@ namespace dash {
  *
  * Coevent can be used for point-to-point synchronization. Events can be posted
  * to any image. Waiting on non-local events is not supported.
+ * Waiting units poll their counter in local memory, use
+ * \c dash::coarray::wait_any and \c dash::coarray::wait_all to wait for
+ * events on several coevents at once.
  *
  * \note Coevents might deadlock if multiple units are pinned to the same
  *       cpu-core. This is due to progress problems in MPI.
@@ -88,23 +161,17 @@ public:
 
   /**
    * wait for a given number of incoming events.
+   * The counter in local memory is polled without communication, the
+   * caller backs off exponentially while no events arrive.
    * This function is thread-safe
    */
   inline void wait(int count = 1) {
-    auto gref = _event_counts.at(_team->myid().id);
-    int current;
-    do {
-#ifdef DASH_DEBUG
-      // avoid spamming the logs while busy waiting
-      DASH_LOG_DEBUG("waiting for event at gptr",
-                     static_cast<gptr_t>(_event_counts.begin()
-                                         +_team->myid().id));
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-#endif
-      current = gref.get();
-    } while (current < count);
-    // decrement the counter
-    gref.sub(count);
+    DASH_LOG_DEBUG("waiting for event at gptr",
+                   static_cast<gptr_t>(_event_counts.begin()
+                                       +_team->myid().id));
+    coarray::detail::SpinBackoff backoff;
+    while (!arrived(count, backoff.pause())) { }
+    consume(count);
   }
 
   inline int test() {
@@ -146,11 +213,101 @@ public:
     return this->operator()(static_cast<int>(unit));
   }
 
+private:
+  /**
+   * Whether \c count events arrived at the calling unit. The local counter
+   * is read directly, unless \c progress is set, in which case it is read
+   * through DART to also progress incoming updates.
+   */
+  inline bool arrived(int count, bool progress = false) const {
+    if (__atomic_load_n(
+          reinterpret_cast<const int *>(_event_counts.lbegin()),
+          __ATOMIC_ACQUIRE) >= count) {
+      return true;
+    }
+    return progress &&
+           _event_counts.at(_team->myid().id).get() >= count;
+  }
+
+  /**
+   * Remove \c count arrived events from the counter of the calling unit.
+   */
+  inline void consume(int count) {
+    _event_counts.at(_team->myid().id).sub(count);
+  }
+
+  template<typename CoeventIter>
+  friend CoeventIter coarray::wait_any(
+    CoeventIter first, CoeventIter last, int count);
+
+  template<typename CoeventIter>
+  friend void coarray::wait_all(
+    CoeventIter first, CoeventIter last, int count);
+
 private:
   Team * _team;
   bool   _is_initialized = false;
 };
 
+namespace coarray {
+
+/**
+ * Wait until one of the coevents in the range \c [first, last) received
+ * \c count events at the calling unit and consume them.
+ *
+ * \return iterator to the coevent whose events have been consumed
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename CoeventIter>
+CoeventIter wait_any(CoeventIter first, CoeventIter last, int count) {
+  if (first == last) {
+    return last;
+  }
+  detail::SpinBackoff backoff;
+  while (true) {
+    bool progress = backoff.pause();
+    for (auto it = first; it != last; ++it) {
+      Coevent & event = *it;
+      if (event.arrived(count, progress)) {
+        event.consume(count);
+        return it;
+      }
+    }
+  }
+}
+
+/**
+ * Wait until every coevent in the range \c [first, last) received
+ * \c count events at the calling unit and consume them.
+ * Events are consumed as soon as they arrive at a coevent.
+ *
+ * \ingroup DashCoarrayLib
+ */
+template<typename CoeventIter>
+void wait_all(CoeventIter first, CoeventIter last, int count) {
+  std::vector<Coevent *> pending;
+  for (auto it = first; it != last; ++it) {
+    pending.push_back(&static_cast<Coevent &>(*it));
+  }
+  detail::SpinBackoff backoff;
+  while (!pending.empty()) {
+    bool progress = backoff.pause();
+    auto it = pending.begin();
+    while (it != pending.end()) {
+      if ((*it)->arrived(count, progress)) {
+        (*it)->consume(count);
+        it = pending.erase(it);
+        backoff.reset();
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+} // namespace coarray
+
 } // namespace dash
 
 #endif /* DASH__COEVENT_H__INCLUDED */
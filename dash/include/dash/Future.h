@@ -114,6 +114,99 @@ public:
 
 }; // class Future
 
+/**
+ * Specialization of \c dash::Future for asynchronous operations that do not
+ * provide a result value, like \c dash::Team::barrier_async.
+ */
+template<>
+class Future<void>
+{
+private:
+  typedef Future<void>                   self_t;
+  typedef std::function<void (void)>     get_func_t;
+  typedef std::function<bool (void)>     test_func_t;
+  typedef std::function<void (void)>     destroy_func_t;
+
+private:
+  get_func_t     _get_func;
+  test_func_t    _test_func;
+  destroy_func_t _destroy_func;
+  bool           _ready = false;
+
+public:
+
+  /**
+   * Creates a future that is ready immediately.
+   */
+  Future()
+  : _ready(true)
+  { }
+
+  Future(const get_func_t & func)
+  : _get_func(func)
+  { }
+
+  Future(
+    const get_func_t     & get_func,
+    const test_func_t    & test_func)
+  : _get_func(get_func),
+    _test_func(test_func)
+  { }
+
+  Future(
+    const get_func_t     & get_func,
+    const test_func_t    & test_func,
+    const destroy_func_t & destroy_func)
+  : _get_func(get_func),
+    _test_func(test_func),
+    _destroy_func(destroy_func)
+  { }
+
+  Future(const self_t& other) = delete;
+  Future(self_t&& other)      = default;
+
+  ~Future() {
+    if (_destroy_func) {
+      _destroy_func();
+    }
+  }
+
+  /// copy-assignment is not permitted
+  Future<void> & operator=(const self_t& other) = delete;
+  Future<void> & operator=(self_t&& other)      = default;
+
+  void wait()
+  {
+    DASH_LOG_TRACE_VAR("Future<void>.wait()", _ready);
+    if (_ready) {
+      return;
+    }
+    if (!_get_func) {
+      DASH_LOG_ERROR("Future<void>.wait()", "No function");
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "Future not initialized with function");
+    }
+    _get_func();
+    _ready = true;
+    DASH_LOG_TRACE_VAR("Future<void>.wait >", _ready);
+  }
+
+  bool test()
+  {
+    if (!_ready && _test_func) {
+      _ready = _test_func();
+    }
+    return _ready;
+  }
+
+  void get()
+  {
+    wait();
+  }
+
+}; // class Future<void>
+
 template<typename ResultT>
 std::ostream & operator<<(
   std::ostream & os,
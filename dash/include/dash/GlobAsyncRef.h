@@ -38,6 +38,9 @@ class GlobRef;
  *   array.flush();
  *   // From here, all changes are published
  * \endcode
+ *
+ * Small operations on many elements can be buffered and issued in batches
+ * using \c dash::AsyncAggregation.
  */
 template<typename T>
 class GlobAsyncRef
@@ -226,6 +229,8 @@ public:
   nonconst_value_type get() const {
     nonconst_value_type value;
     DASH_LOG_TRACE_VAR("GlobAsyncRef.T()", _gptr);
+    // buffered operations precede the get in program order
+    dash::internal::AsyncAggregator::instance().flush(_gptr);
     dash::internal::get_blocking(_gptr, &value, 1);
     return value;
   }
@@ -237,6 +242,11 @@ public:
    * at which point the referenced value can be used.
    */
   void get(nonconst_value_type *tptr) const {
+    auto & aggregator = dash::internal::AsyncAggregator::instance();
+    if (aggregator.enabled()) {
+      aggregator.get(_gptr, tptr, sizeof(nonconst_value_type));
+      return;
+    }
     dash::internal::get(_gptr, tptr, 1);
   }
 
@@ -261,6 +271,11 @@ public:
                   "Cannot modify value through GlobAsyncRef<const T>!");
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", *tptr);
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", _gptr);
+    auto & aggregator = dash::internal::AsyncAggregator::instance();
+    if (aggregator.enabled()) {
+      aggregator.put(_gptr, tptr, sizeof(nonconst_value_type));
+      return;
+    }
     dash::internal::put(_gptr, tptr, 1);
   }
 
@@ -276,6 +291,12 @@ public:
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", new_value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef.set()", _gptr);
 
+    auto & aggregator = dash::internal::AsyncAggregator::instance();
+    if (aggregator.enabled()) {
+      aggregator.put(_gptr, &new_value, sizeof(nonconst_value_type));
+      return;
+    }
+
     _value = new_value;
 
     dart_handle_t new_handle;
@@ -317,6 +338,7 @@ public:
    */
   void flush() const
   {
+    dash::internal::AsyncAggregator::instance().flush(_gptr);
     DASH_ASSERT_RETURNS(
       dart_flush(_gptr),
       DART_OK
@@ -321,9 +321,9 @@ public:
    */
   self_t & operator+=(index_type n)
   {
-    if (n >= 0) {
+    if (n > 0) {
       increment(n);
-    } else {
+    } else if (n < 0) {
       decrement(-n);
     }
     return *this;
@@ -487,6 +487,40 @@ public:
     return nullptr;
   }
 
+  /**
+   * Conversion to a native pointer that can be dereferenced directly if the
+   * referenced element is stored at the calling unit or at a unit on the
+   * same shared memory node.
+   *
+   * \returns  A native pointer to the element referenced by this GlobPtr
+   *           instance, or \c nullptr if the referenced element is not
+   *           directly accessible by the calling unit.
+   */
+  value_type * shared_local() {
+    void *addr = 0;
+    if (dart_gptr_getaddr_shared(_rbegin_gptr, &addr) == DART_OK) {
+      return static_cast<value_type*>(addr);
+    }
+    return nullptr;
+  }
+
+  /**
+   * Conversion to a native const pointer that can be dereferenced directly
+   * if the referenced element is stored at the calling unit or at a unit on
+   * the same shared memory node.
+   *
+   * \returns  A native pointer to the element referenced by this GlobPtr
+   *           instance, or \c nullptr if the referenced element is not
+   *           directly accessible by the calling unit.
+   */
+  const value_type * shared_local() const {
+    void *addr = 0;
+    if (dart_gptr_getaddr_shared(_rbegin_gptr, &addr) == DART_OK) {
+      return static_cast<const value_type*>(addr);
+    }
+    return nullptr;
+  }
+
   /**
    * Set the global pointer's associated unit.
    */
@@ -658,6 +692,14 @@ class GlobConstPtr
     return base_t::local();
   }
 
+  value_type * shared_local() {
+    return base_t::shared_local();
+  }
+
+  const value_type * shared_local() const {
+    return base_t::shared_local();
+  }
+
   bool is_local() const {
     return base_t::is_local();
   }
@@ -3,6 +3,8 @@
 
 #include <dash/Team.h>
 
+#include <dash/internal/AsyncAggregator.h>
+
 #include <dash/dart/if/dart.h>
 
 
@@ -152,6 +154,7 @@ template<typename T, typename GlobPtrType>
 void fence(
   const GlobPtrType & gptr)
 {
+  dash::internal::AsyncAggregator::instance().flush(gptr.dart_gptr());
   DASH_ASSERT_RETURNS(
     dart_flush(gptr.dart_gptr()),
     DART_OK);
@@ -164,6 +167,7 @@ template<typename T, typename GlobPtrType>
 void fence_local(
   const GlobPtrType & gptr)
 {
+  dash::internal::AsyncAggregator::instance().flush(gptr.dart_gptr());
   DASH_ASSERT_RETURNS(
     dart_flush_local(gptr.dart_gptr()),
     DART_OK);
@@ -237,6 +241,60 @@ void get_value(
   dash::internal::get_blocking(gptr.dart_gptr(), ptr, 1);
 }
 
+/**
+ * Aggregates asynchronous operations on \c dash::GlobAsyncRef for the
+ * lifetime of the object.
+ *
+ * Puts, gets and atomic updates issued through asynchronous references are
+ * buffered per target unit instead of being issued one by one. Operations
+ * on adjacent addresses are coalesced and issued in batches once the
+ * buffered data of a target exceeds \c max_bytes or when the target is
+ * flushed, e.g. using \c GlobAsyncRef::flush or the \c flush methods of a
+ * container. Remaining operations are completed when the last active
+ * instance is destroyed.
+ *
+ * Example:
+ * \code
+ *   dash::Array<dash::Atomic<int>> hist(nbins);
+ *   {
+ *     dash::AsyncAggregation aggregate;
+ *     for (auto key : keys) {
+ *       hist.async[key].add(1);
+ *     }
+ *     hist.async.flush();
+ *   }
+ *   hist.barrier();
+ * \endcode
+ *
+ * \note Aggregation is not thread-safe.
+ */
+class AsyncAggregation
+{
+public:
+  explicit AsyncAggregation(
+    /// Maximum number of bytes buffered for a single target unit
+    size_t max_bytes = dash::internal::AsyncAggregator::default_max_bytes)
+  {
+    dash::internal::AsyncAggregator::instance().enable(max_bytes);
+  }
+
+  ~AsyncAggregation()
+  {
+    dash::internal::AsyncAggregator::instance().disable();
+  }
+
+  AsyncAggregation(const AsyncAggregation & other)             = delete;
+  AsyncAggregation & operator=(const AsyncAggregation & other) = delete;
+
+  /**
+   * Issue and complete all buffered operations.
+   */
+  void flush()
+  {
+    dash::internal::AsyncAggregator::instance().flush_all();
+  }
+};
+
 } // namespace dash
 
 #endif // DASH__ONESIDED_H__
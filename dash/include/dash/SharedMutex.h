@@ -0,0 +1,102 @@
+#ifndef DASH__SHARED_MUTEX_H__INCLUDED
+#define DASH__SHARED_MUTEX_H__INCLUDED
+
+#include <dash/Team.h>
+
+namespace dash {
+
+/**
+ * Behaves similar to \c std::shared_mutex and is used to ensure mutual
+ * exclusion of writers within a dash team while readers can hold the mutex
+ * concurrently.
+ *
+ * Acquiring and releasing the mutex in shared mode only requires atomic
+ * operations on local memory as long as no unit holds or waits for the
+ * mutex in exclusive mode. Units waiting for exclusive access take
+ * precedence over new readers.
+ *
+ * \note This works properly with \c std::lock_guard and \c std::shared_lock
+ * \note SharedMutex cannot be placed in DASH containers
+ * \note A unit holding the mutex in shared mode must not acquire it in
+ *       exclusive mode.
+ *
+ * \code
+ * dash::SharedMutex mx; // mutex for dash::Team::All();
+ * dash::UnorderedMap<int, int> table;
+ * {
+ *    std::shared_lock<dash::SharedMutex> sl(mx);
+ *    auto it = table.find(key);
+ * }
+ * {
+ *    std::lock_guard<dash::SharedMutex> lg(mx);
+ *    table.insert(std::make_pair(key, value));
+ * }
+ * \endcode
+ */
+class SharedMutex {
+private:
+  using self_t = SharedMutex;
+
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team & team = dash::Team::All());
+
+  SharedMutex(const SharedMutex & other)   = delete;
+  SharedMutex(SharedMutex && other)        = default;
+
+  self_t & operator=(const self_t & other) = delete;
+  self_t & operator=(self_t && other)      = default;
+
+  /**
+   * Collective destructor to destruct a DART reader-writer lock.
+   *
+   * This function is not thread-safe
+   */
+  ~SharedMutex();
+
+  /**
+   * Block until the lock was acquired in exclusive mode.
+   */
+  void lock();
+
+  /**
+   * Try to acquire the lock in exclusive mode and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock();
+
+  /**
+   * Release the lock acquired through \c lock() or \c try_lock().
+   */
+  void unlock();
+
+  /**
+   * Block until the lock was acquired in shared mode.
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire the lock in shared mode and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Release the lock acquired through \c lock_shared() or
+   * \c try_lock_shared().
+   */
+  void unlock_shared();
+
+private:
+  dart_rwlock_t _mutex;
+}; // class SharedMutex
+
+} // namespace dash
+
+#endif // DASH__SHARED_MUTEX_H__INCLUDED
@@ -6,6 +6,7 @@
 #include <dash/Init.h>
 #include <dash/Types.h>
 #include <dash/Exception.h>
+#include <dash/Future.h>
 
 #include <dash/util/Locality.h>
 
@@ -474,6 +475,50 @@ public:
     }
   }
 
+  /**
+   * Non-blocking barrier. Returns immediately, the barrier is completed
+   * once \c wait or a successful \c test has been called on the returned
+   * future. Allows to overlap synchronization with local computation.
+   *
+   * \return  Future that is ready once all units in this team entered
+   *          the barrier.
+   */
+  dash::Future<void> barrier_async() const
+  {
+    if (is_null()) {
+      return dash::Future<void>();
+    }
+    dart_handle_t handle;
+    DASH_ASSERT_RETURNS(
+      dart_ibarrier(_dartid, &handle),
+      DART_OK);
+    auto handle_ptr = std::make_shared<dart_handle_t>(handle);
+    return dash::Future<void>(
+      // wait
+      [handle_ptr]() {
+        DASH_ASSERT_RETURNS(
+          dart_wait(handle_ptr.get()),
+          DART_OK);
+      },
+      // test
+      [handle_ptr]() {
+        int32_t flag;
+        DASH_ASSERT_RETURNS(
+          dart_test(handle_ptr.get(), &flag),
+          DART_OK);
+        return (flag != 0);
+      },
+      // destroy: the barrier has to be completed before the handle is
+      // released
+      [handle_ptr]() {
+        if (*handle_ptr != DART_HANDLE_NULL) {
+          DASH_ASSERT_RETURNS(
+            dart_wait(handle_ptr.get()),
+            DART_OK);
+        }
+      });
+  }
+
   inline team_unit_t myid() const
   {
     return _myid;
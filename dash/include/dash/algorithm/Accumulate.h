@@ -1,12 +1,15 @@
 #ifndef DASH__ALGORITHM__ACCUMULATE_H__
 #define DASH__ALGORITHM__ACCUMULATE_H__
 
+#include <dash/Future.h>
 #include <dash/iterator/GlobIter.h>
 #include <dash/iterator/IteratorTraits.h>
 
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 
+#include <memory>
+
 
 namespace dash {
 
@@ -223,6 +226,171 @@ ValueType accumulate(
                           team);
 }
 
+/**
+ * Asynchronous variant of \c dash::accumulate for local ranges.
+ *
+ * Accumulates the local range [\ref in_first, \ref in_last) immediately
+ * and starts the reduction across units without waiting for its
+ * completion. The accumulated value is available from the returned future
+ * once all units in \c team have started the operation.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Local iterator describing the beginning of the range to
+ *                  accumulate.
+ * \param in_last   Local iterator describing the end of the range to
+ *                  accumulate.
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The binary operation to apply to accumulate two elements.
+ * \param non_empty Whether all units are guaranteed to provide a non-empty
+ *                  local range (default \c false).
+ * \param team      The team to use for the collective operation.
+ *
+ * \return  Future providing the accumulated value.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class LocalInputIter,
+  class ValueType,
+  class BinaryOperation,
+  typename = typename std::enable_if<
+                        !dash::detail::is_global_iterator<LocalInputIter>::value
+                      >::type>
+dash::Future<ValueType> accumulate_async(
+  const LocalInputIter   in_first,
+  const LocalInputIter   in_last,
+  const ValueType      & init,
+  BinaryOperation        binary_op,
+  bool                   non_empty = false,
+  dash::Team           & team = dash::Team::All())
+{
+  using local_result_t = struct dash::internal::local_result<ValueType>;
+
+  // Buffers and reduction operation have to outlive this call until the
+  // reduction completed:
+  struct async_state {
+    local_result_t   l_result;
+    local_result_t   g_result;
+    BinaryOperation  binary_op;
+    dart_datatype_t  dtype;
+    dart_operation_t dop;
+    bool             custom = false;
+    dart_handle_t    handle = DART_HANDLE_NULL;
+
+    explicit async_state(BinaryOperation op) : binary_op(op) { }
+
+    ~async_state() {
+      if (handle != DART_HANDLE_NULL) {
+        // pending collective operation must complete before its buffers
+        // are released
+        dart_wait_local(&handle);
+      }
+      if (custom) {
+        dart_op_destroy(&dop);
+        dart_type_destroy(&dtype);
+      }
+    }
+  };
+  auto state = std::make_shared<async_state>(binary_op);
+
+  if (in_first != in_last) {
+    state->l_result.value = std::accumulate(std::next(in_first),
+                                            in_last, *in_first,
+                                            binary_op);
+    state->l_result.valid = true;
+  }
+  state->dop   = dash::internal::dart_reduce_operation<BinaryOperation>::value;
+  state->dtype = dash::dart_storage<ValueType>::dtype;
+
+  if (!non_empty ||
+      state->dop   == DART_OP_UNDEFINED ||
+      state->dtype == DART_TYPE_UNDEFINED)
+  {
+    dart_type_create_custom(sizeof(local_result_t), &state->dtype);
+    dart_op_create(
+      &dash::internal::accumulate_custom_fn<ValueType, BinaryOperation>,
+      &state->binary_op, true, state->dtype, true, &state->dop);
+    state->custom = true;
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(&state->l_result, &state->g_result, 1,
+                      state->dtype, state->dop, team.dart_id(),
+                      &state->handle),
+      DART_OK);
+  } else {
+    // ideal case: we can use DART predefined reductions
+    state->g_result.valid = true;
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(&state->l_result.value, &state->g_result.value, 1,
+                      state->dtype, state->dop, team.dart_id(),
+                      &state->handle),
+      DART_OK);
+  }
+
+  return dash::Future<ValueType>(
+    // wait
+    [state, init]() {
+      DASH_ASSERT_RETURNS(
+        dart_wait_local(&state->handle),
+        DART_OK);
+      if (!state->g_result.valid) {
+        DASH_LOG_ERROR("Found invalid reduction value!");
+      }
+      return state->binary_op(init, state->g_result.value);
+    },
+    // test
+    [state, init](ValueType * out) {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_test_local(&state->handle, &flag),
+        DART_OK);
+      if (flag) {
+        *out = state->binary_op(init, state->g_result.value);
+      }
+      return (flag != 0);
+    });
+}
+
+/**
+ * Asynchronous variant of \c dash::accumulate for global ranges.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Global iterator describing the beginning of the range to
+ *                  accumulate.
+ * \param in_last   Global iterator describing the end of the range to
+ *                  accumulate.
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The associative, commutative binary operation to to apply.
+ *
+ * \return  Future providing the accumulated value.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+dash::Future<ValueType> accumulate_async(
+        GlobInputIt   in_first,
+        GlobInputIt   in_last,
+  const ValueType   & init,
+  BinaryOperation     binary_op = dash::plus<ValueType>())
+{
+  auto & team      = in_first.team();
+  auto index_range = dash::local_range(in_first, in_last);
+
+  return dash::accumulate_async(index_range.begin,
+                                index_range.end,
+                                init,
+                                binary_op,
+                                false,
+                                team);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__ACCUMULATE_H__
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <future>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace dash {
@@ -97,6 +98,34 @@ namespace internal {
 // Global to Local
 // =========================================================================
 
+/**
+ * Copies \c nelem elements from the global memory referenced by
+ * \c src_gptr to \c dest.
+ * Elements that are directly accessible via a shared memory window are
+ * copied using load/store, otherwise a non-blocking get is started and its
+ * handle appended to \c handles.
+ */
+template <typename ValueType>
+void copy_get_segment(
+  dart_gptr_t                  src_gptr,
+  ValueType                  * dest,
+  size_t                       nelem,
+  std::vector<dart_handle_t> & handles)
+{
+  void * shared_src = nullptr;
+  if (dart_gptr_getaddr_shared(src_gptr, &shared_src) == DART_OK &&
+      shared_src != nullptr) {
+    auto l_src = static_cast<const ValueType *>(shared_src);
+    std::copy(l_src, l_src + nelem, dest);
+    return;
+  }
+  dart_handle_t handle;
+  dash::internal::get_handle(src_gptr, dest, nelem, &handle);
+  if (handle != DART_HANDLE_NULL) {
+    handles.push_back(handle);
+  }
+}
+
 /**
  * Blocking implementation of \c dash::copy (global to local) without
  * optimization for local subrange.
@@ -147,15 +176,11 @@ ValueType * copy_impl(
                     "get elements:",   num_elem_total);
     auto cur_in_first  = g_in_first;
     auto cur_out_first = out_first;
-    dart_handle_t handle;
-    dash::internal::get_handle(
+    dash::internal::copy_get_segment(
       cur_in_first.dart_gptr(),
       cur_out_first,
       num_elem_total,
-      &handle);
-    if (handle != DART_HANDLE_NULL) {
-      handles.push_back(handle);
-    }
+      handles);
     num_elem_copied = num_elem_total;
   } else {
     // Input range is spread over several remote units:
@@ -198,12 +223,9 @@ ValueType * copy_impl(
                      "left:",           total_elem_left);
       auto dest_ptr = out_first + num_elem_copied;
       auto src_gptr = cur_in_first.dart_gptr();
-      dart_handle_t handle;
-      dash::internal::get_handle(src_gptr, dest_ptr, num_copy_elem, &handle);
+      dash::internal::copy_get_segment(
+        src_gptr, dest_ptr, num_copy_elem, handles);
       num_elem_copied += num_copy_elem;
-      if (handle != DART_HANDLE_NULL) {
-        handles.push_back(handle);
-      }
     }
   }
 
@@ -235,14 +257,24 @@ GlobOutputIt copy_impl(
                  "g_out_first:", out_first);
 
   auto num_elements = std::distance(in_first, in_last);
-  dart_handle_t handle;
-  dash::internal::put_handle(
-    out_first.dart_gptr(),
-    in_first,
-    num_elements,
-    &handle);
-  if (handle != DART_HANDLE_NULL) {
-    handles.push_back(handle);
+  auto dest_gptr    = out_first.dart_gptr();
+  void * shared_dest = nullptr;
+  if (dart_gptr_getaddr_shared(dest_gptr, &shared_dest) == DART_OK &&
+      shared_dest != nullptr) {
+    // target is located on the same shared memory node
+    std::copy(in_first, in_last,
+              static_cast<typename std::remove_const<ValueType>::type *>(
+                shared_dest));
+  } else {
+    dart_handle_t handle;
+    dash::internal::put_handle(
+      dest_gptr,
+      in_first,
+      num_elements,
+      &handle);
+    if (handle != DART_HANDLE_NULL) {
+      handles.push_back(handle);
+    }
   }
 
   auto out_last = out_first + num_elements;
@@ -252,6 +284,121 @@ GlobOutputIt copy_impl(
   return out_last;
 }
 
+/**
+ * Calls \c copy_run for every run of elements in the local part of the
+ * global output range \c [g_out_begin, g_out_end) that is contiguous in
+ * local memory of both the input and the output range.
+ *
+ * Specialization for one-dimensional patterns, runs are obtained by
+ * intersecting the local blocks of the output pattern with the blocks of
+ * the input pattern.
+ */
+template <
+  class InPatternT,
+  class OutPatternT,
+  class CopyRunFn >
+void for_each_copy_run(
+  const InPatternT                 & in_pattern,
+  const OutPatternT                & out_pattern,
+  typename InPatternT::index_type    g_in_begin,
+  typename OutPatternT::index_type   g_out_begin,
+  typename OutPatternT::index_type   g_out_end,
+  CopyRunFn                       && copy_run,
+  std::true_type                     /* one-dimensional */)
+{
+  typedef typename InPatternT::index_type  in_index_t;
+  typedef typename OutPatternT::index_type out_index_t;
+
+  out_index_t l_size = out_pattern.local_size();
+  out_index_t l_idx  = 0;
+  while (l_idx < l_size) {
+    // Local elements of a block are contiguous in local memory:
+    out_index_t g_block_first = out_pattern.global(l_idx);
+    auto        out_block     = out_pattern.block(
+                                  out_pattern.block_at({{ g_block_first }}));
+    out_index_t g_block_end   = out_block.offset(0) + out_block.extent(0);
+    DASH_ASSERT_GT(g_block_end, g_block_first, "empty local block");
+    l_idx += g_block_end - g_block_first;
+
+    out_index_t g_out_idx = std::max(g_block_first, g_out_begin);
+    out_index_t g_out_run = std::min(g_block_end,   g_out_end);
+    while (g_out_idx < g_out_run) {
+      // Split intersection of output block and output range at the
+      // boundaries of input blocks:
+      in_index_t g_in_idx = g_in_begin + (g_out_idx - g_out_begin);
+      auto       in_block = in_pattern.block(
+                              in_pattern.block_at({{ g_in_idx }}));
+      in_index_t nelem    = std::min<in_index_t>(
+                              g_out_run - g_out_idx,
+                              in_block.offset(0) + in_block.extent(0)
+                                - g_in_idx);
+      copy_run(g_out_idx, in_pattern.local(g_in_idx), nelem);
+      g_out_idx += nelem;
+    }
+  }
+}
+
+/**
+ * Calls \c copy_run for every run of elements in the local part of the
+ * global output range \c [g_out_begin, g_out_end) that is contiguous in
+ * local memory of both the input and the output range.
+ *
+ * Specialization for multi-dimensional patterns, the order of blocks in
+ * the global index domain depends on the pattern so every local element
+ * is mapped to the input range.
+ */
+template <
+  class InPatternT,
+  class OutPatternT,
+  class CopyRunFn >
+void for_each_copy_run(
+  const InPatternT                 & in_pattern,
+  const OutPatternT                & out_pattern,
+  typename InPatternT::index_type    g_in_begin,
+  typename OutPatternT::index_type   g_out_begin,
+  typename OutPatternT::index_type   g_out_end,
+  CopyRunFn                       && copy_run,
+  std::false_type                    /* one-dimensional */)
+{
+  typedef typename InPatternT::local_index_t in_local_pos_t;
+  typedef typename OutPatternT::index_type   index_type;
+
+  // Global output index, source position and size of the current run:
+  index_type     run_g_out = 0;
+  in_local_pos_t run_in_lpos;
+  index_type     run_size  = 0;
+  index_type     l_size    = out_pattern.local_size();
+  for (index_type l_idx = 0; l_idx < l_size; ++l_idx) {
+    index_type g_out_idx = out_pattern.global(l_idx);
+    if (g_out_idx < g_out_begin || g_out_idx >= g_out_end) {
+      // Local element is not in output range:
+      if (run_size > 0) {
+        copy_run(run_g_out, run_in_lpos, run_size);
+        run_size = 0;
+      }
+      continue;
+    }
+    auto in_lpos = in_pattern.local(g_in_begin + (g_out_idx - g_out_begin));
+    if (run_size > 0 &&
+        g_out_idx     == run_g_out + run_size &&
+        in_lpos.unit  == run_in_lpos.unit &&
+        in_lpos.index == run_in_lpos.index + run_size) {
+      // Element extends current run in both input and output range:
+      ++run_size;
+      continue;
+    }
+    if (run_size > 0) {
+      copy_run(run_g_out, run_in_lpos, run_size);
+    }
+    run_g_out   = g_out_idx;
+    run_in_lpos = in_lpos;
+    run_size    = 1;
+  }
+  if (run_size > 0) {
+    copy_run(run_g_out, run_in_lpos, run_size);
+  }
+}
+
 } // namespace internal
 
 
@@ -941,21 +1088,114 @@ copy_async(
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Being a collaborative operation, each unit copies the elements of the
+ * input range that are mapped to its local section of the output range.
+ * Input and output ranges may be distributed by different patterns.
+ * Every run of elements that is contiguous in the unit's local section
+ * of the output range and at a single unit in the input range is
+ * transferred by a single get operation directly into local memory, or
+ * copied from shared memory if the input unit is co-located.
+ *
+ * Collective operation over the team of the output range. Units start
+ * reading the input range immediately, so it has to be synchronized
+ * before the call, e.g. by a barrier.
+ * Elements copied at remote units are visible after synchronization of
+ * the team, e.g. by a barrier.
+ *
+ * \tparam      ValueType  Optional, only allows to state the element type
+ *                         explicitly like in the other variants of
+ *                         \c dash::copy.
+ * \complexity  O(nl) index computations and at most O(nl) transfers,
+ *              with \c nl local elements in the output pattern
+ *
  * \ingroup  DashAlgorithms
  */
-template <typename ValueType, class GlobInputIt, class GlobOutputIt>
+template <
+  typename ValueType = void,
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value &&
+               dash::detail::is_global_iterator<GlobOutputIt>::value
+             >::type >
 GlobOutputIt copy(
-    GlobInputIt /*in_first*/,
-    GlobInputIt /*in_last*/,
-    GlobOutputIt /*out_first*/)
+  GlobInputIt  in_first,
+  GlobInputIt  in_last,
+  GlobOutputIt out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
 
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
+  auto num_elem_total = dash::distance(in_first, in_last);
+  auto out_last       = out_first + num_elem_total;
+  if (num_elem_total <= 0) {
+    DASH_LOG_TRACE("dash::copy", "input range empty");
+    return out_last;
+  }
+  // Input and output iterators could be relative to views, map them to
+  // global index domain (see dash::internal::copy_impl):
+  auto g_in_first          = in_first.global();
+  auto g_out_first         = out_first.global();
+  const auto & in_pattern  = g_in_first.pattern();
+  const auto & out_pattern = g_out_first.pattern();
+
+  typedef typename std::decay<decltype(out_pattern)>::type
+    out_pattern_t;
+  typedef typename std::decay<decltype(in_pattern)>::type::local_index_t
+    in_local_pos_t;
+  typedef typename out_pattern_t::index_type
+    index_type;
+
+  index_type g_out_begin = g_out_first.pos();
+  index_type g_out_end   = g_out_begin + num_elem_total;
+  index_type g_in_begin  = g_in_first.pos();
+  index_type l_size      = out_pattern.local_size();
+  // Unit ids of the input pattern refer to the input range's team:
+  auto       in_myid     = in_pattern.team().myid();
+  DASH_LOG_TRACE("dash::copy",
+                 "g_in_first:",  g_in_begin,
+                 "g_out_first:", g_out_begin,
+                 "g_out_last:",  g_out_end,
+                 "local size:",  l_size);
+
+  std::vector<dart_handle_t> handles;
+  // Copy run of elements starting at the given global output index:
+  auto copy_run = [&](index_type          g_out_idx,
+                      const in_local_pos_t & in_lpos,
+                      index_type          nelem) {
+    auto in_it  = g_in_first  + (g_out_idx - g_out_begin);
+    auto out_it = g_out_first + (g_out_idx - g_out_begin);
+    auto l_dest = out_it.local();
+    DASH_LOG_TRACE("dash::copy", "copy run",
+                   "g_in_idx:",  in_it.pos(),
+                   "src unit:",  in_lpos.unit,
+                   "g_out_idx:", g_out_idx,
+                   "nelem:",     nelem);
+    if (in_lpos.unit == in_myid) {
+      auto l_src = in_it.local();
+      std::copy(l_src, l_src + nelem, l_dest);
+      return;
+    }
+    dash::internal::copy_get_segment(
+      in_it.dart_gptr(), l_dest, nelem, handles);
+  };
+
+  typedef std::integral_constant<
+            bool,
+            out_pattern_t::ndim() == 1 &&
+            std::decay<decltype(in_pattern)>::type::ndim() == 1 >
+    is_one_dimensional;
+  dash::internal::for_each_copy_run(
+    in_pattern, out_pattern, g_in_begin, g_out_begin, g_out_end, copy_run,
+    is_one_dimensional());
 
-  return GlobOutputIt();
+  if (!handles.empty()) {
+    DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
+                  "num_handles: ", handles.size());
+    dart_waitall_local(handles.data(), handles.size());
+  }
+  DASH_LOG_TRACE("dash::copy >", "finished,",
+                 "out_last:", out_last.pos());
+  return out_last;
 }
 
 #endif // DOXYGEN
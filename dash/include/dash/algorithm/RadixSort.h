@@ -0,0 +1,341 @@
+#ifndef DASH__ALGORITHM__RADIX_SORT_H
+#define DASH__ALGORITHM__RADIX_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <dash/Exception.h>
+#include <dash/Team.h>
+#include <dash/dart/if/dart.h>
+
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/LocalRange.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/util/Trace.h>
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) in ascending
+ * order using a distributed least significant digit radix sort. The order of
+ * equal elements is preserved.
+ *
+ * The elements must be arithmetic, i.e. std::is_arithmetic<T> must be
+ * satisfied. Integral and floating point types up to 64 bit are supported.
+ *
+ * In contrast to \c dash::sort, the number of communication rounds is fixed
+ * by the width of the key: every pass over an 8 bit digit combines the local
+ * digit histograms with \c dart_allreduce and \c dart_exscan, after which
+ * every unit computes the global target positions of its elements and puts
+ * them to their owners. Passes in which all keys share the same digit are
+ * skipped.
+ *
+ * The local ranges of the units must be ordered by unit id in the global
+ * range, as in a \c dash::BLOCKED distribution.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<int> arr(100);
+ *       dash::generate(arr.begin(), arr.end());
+ *       dash::radix_sort(array.begin(),
+ *                        array.end());
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end);
+
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) in ascending
+ * order of the keys returned by \c key using a distributed least significant
+ * digit radix sort. The order of elements with equal keys is preserved.
+ *
+ * The key function must return an integral or floating point value of up to
+ * 64 bit.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * Example:
+ *
+ * \code
+ *       struct pair { int x; int y; };
+ *       dash::Array<pair> arr(100);
+ *       dash::generate(arr.begin(), arr.end(), random());
+ *       dash::radix_sort(array.begin(),
+ *                        array.end(),
+ *                        [](pair const & p){ return p.x; }
+ *                       );
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class KeyFunc>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end, KeyFunc key);
+
+#else
+
+#define RADIX_SORT_DIGIT_BITS 8
+#define RADIX_SORT_NBUCKETS (1 << RADIX_SORT_DIGIT_BITS)
+
+namespace detail {
+
+/**
+ * Maps keys to unsigned integers of the same width whose natural order
+ * matches the order of the keys.
+ */
+template <typename KeyType, typename Enable = void>
+struct radix_key_traits;
+
+template <typename KeyType>
+struct radix_key_traits<
+    KeyType,
+    typename std::enable_if<std::is_integral<KeyType>::value>::type> {
+  using radix_type = typename std::make_unsigned<KeyType>::type;
+
+  static constexpr radix_type sign_bit = std::is_signed<KeyType>::value
+                                             ? radix_type(1)
+                                                   << (sizeof(radix_type) * 8 - 1)
+                                             : radix_type(0);
+
+  static radix_type encode(KeyType key)
+  {
+    // flip the sign bit so negative keys precede positive keys
+    return static_cast<radix_type>(key) ^ sign_bit;
+  }
+};
+
+template <typename KeyType>
+struct radix_key_traits<
+    KeyType,
+    typename std::enable_if<std::is_floating_point<KeyType>::value>::type> {
+  using radix_type = typename std::conditional<
+      sizeof(KeyType) == sizeof(uint32_t),
+      uint32_t,
+      uint64_t>::type;
+
+  static_assert(
+      sizeof(KeyType) == sizeof(radix_type),
+      "Only 32 and 64 bit floating point keys are supported");
+
+  static constexpr radix_type sign_bit = radix_type(1)
+                                         << (sizeof(radix_type) * 8 - 1);
+
+  static radix_type encode(KeyType key)
+  {
+    radix_type bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    // negative values are ordered by descending magnitude
+    return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+  }
+};
+
+}  // namespace detail
+
+template <class GlobRandomIt, class KeyFunc>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end, KeyFunc key)
+{
+  using value_type =
+      typename std::remove_cv<typename GlobRandomIt::value_type>::type;
+  using key_type = typename std::decay<decltype(
+      key(std::declval<value_type const&>()))>::type;
+  using key_traits = detail::radix_key_traits<key_type>;
+  using bucket_hist_t = std::array<size_t, RADIX_SORT_NBUCKETS>;
+
+  static_assert(
+      std::is_arithmetic<key_type>::value,
+      "Only arithmetic keys are supported");
+
+  auto pattern = begin.pattern();
+
+  dash::util::Trace trace("RadixSort");
+
+  if (pattern.team() == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::radix_sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+
+  dash::Team& team   = pattern.team();
+  auto const  nunits = team.size();
+  auto const  myid   = team.myid();
+
+  if (begin >= end) {
+    DASH_LOG_TRACE("dash::radix_sort", "empty range");
+    team.barrier();
+    return;
+  }
+
+  auto const l_range  = dash::local_index_range(begin, end);
+  auto const lbegin   = begin.globmem().lbegin() + l_range.begin;
+  size_t     n_l_elem = l_range.end - l_range.begin;
+  size_t     n_g_elem = dash::distance(begin, end);
+
+  trace.enter_state("1:unit_offsets (allgather)");
+
+  // Offsets of the local ranges in the global range
+  std::vector<size_t> unit_offsets(nunits + 1, 0);
+
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          &n_l_elem,
+          std::next(unit_offsets.data()),
+          1,
+          dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  std::partial_sum(
+      std::next(std::begin(unit_offsets)),
+      std::end(unit_offsets),
+      std::next(std::begin(unit_offsets)));
+
+  trace.exit_state("1:unit_offsets (allgather)");
+
+  std::vector<value_type>    lbuf(n_l_elem);
+  std::vector<dart_handle_t> handles;
+
+  bucket_hist_t l_hist;
+  bucket_hist_t g_hist;
+  bucket_hist_t p_hist;
+  bucket_hist_t l_displs;
+
+  for (size_t pass = 0; pass < sizeof(key_type); ++pass) {
+    auto const shift = pass * RADIX_SORT_DIGIT_BITS;
+    auto const digit = [&key, shift](value_type const& v) {
+      return (key_traits::encode(key(v)) >> shift) &
+             (RADIX_SORT_NBUCKETS - 1);
+    };
+
+    trace.enter_state("2:local_histogram");
+    l_hist.fill(0);
+    std::for_each(lbegin, lbegin + n_l_elem, [&](value_type const& v) {
+      ++l_hist[digit(v)];
+    });
+    trace.exit_state("2:local_histogram");
+
+    trace.enter_state("3:global_histogram");
+
+    dart_handle_t hist_handle;
+    DASH_ASSERT_RETURNS(
+        dart_iallreduce(
+            l_hist.data(),
+            g_hist.data(),
+            RADIX_SORT_NBUCKETS,
+            dart_datatype<size_t>::value,
+            DART_OP_SUM,
+            team.dart_id(),
+            &hist_handle),
+        DART_OK);
+
+    // stable local counting sort, overlapped with the global reduction
+    l_displs[0] = 0;
+    std::partial_sum(
+        l_hist.begin(), std::prev(l_hist.end()), std::next(l_displs.begin()));
+
+    auto l_pos = l_displs;
+    std::for_each(lbegin, lbegin + n_l_elem, [&](value_type const& v) {
+      lbuf[l_pos[digit(v)]++] = v;
+    });
+
+    // Number of elements in every bucket at all preceding units
+    DASH_ASSERT_RETURNS(
+        dart_exscan(
+            l_hist.data(),
+            p_hist.data(),
+            RADIX_SORT_NBUCKETS,
+            dart_datatype<size_t>::value,
+            DART_OP_SUM,
+            team.dart_id()),
+        DART_OK);
+    if (0 == myid) {
+      p_hist.fill(0);
+    }
+
+    DASH_ASSERT_RETURNS(dart_wait(&hist_handle), DART_OK);
+
+    trace.exit_state("3:global_histogram");
+
+    if (std::find(g_hist.begin(), g_hist.end(), n_g_elem) != g_hist.end()) {
+      // All keys share this digit, the stable order is unchanged
+      DASH_LOG_TRACE("dash::radix_sort", "skipping pass", pass);
+      continue;
+    }
+
+    trace.enter_state("4:barrier");
+    team.barrier();
+    trace.exit_state("4:barrier");
+
+    trace.enter_state("5:exchange_data");
+
+    size_t g_bucket_offset = 0;
+    for (size_t b = 0; b < RADIX_SORT_NBUCKETS; ++b) {
+      auto   gidx  = g_bucket_offset + p_hist[b];
+      auto   l_src = lbuf.data() + l_displs[b];
+      size_t nleft = l_hist[b];
+
+      g_bucket_offset += g_hist[b];
+
+      // split at the boundaries of the units' local ranges
+      while (nleft > 0) {
+        auto const unit = std::distance(
+            std::next(unit_offsets.begin()),
+            std::upper_bound(
+                std::next(unit_offsets.begin()), unit_offsets.end(), gidx));
+        auto const ncopy = std::min(nleft, unit_offsets[unit + 1] - gidx);
+
+        if (unit == myid.id) {
+          std::copy(
+              l_src, l_src + ncopy, lbegin + (gidx - unit_offsets[myid.id]));
+        }
+        else {
+          dash::internal::copy_impl(
+              l_src, l_src + ncopy, begin + gidx, handles);
+        }
+        l_src += ncopy;
+        gidx  += ncopy;
+        nleft -= ncopy;
+      }
+    }
+
+    if (!handles.empty()) {
+      DASH_ASSERT_RETURNS(
+          dart_waitall(handles.data(), handles.size()), DART_OK);
+      handles.clear();
+    }
+
+    trace.exit_state("5:exchange_data");
+
+    trace.enter_state("6:barrier");
+    team.barrier();
+    trace.exit_state("6:barrier");
+  }
+}
+
+template <class GlobRandomIt>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::radix_sort(
+      begin, end, [](value_t const& v) -> value_t const& { return v; });
+}
+
+#endif  // DOXYGEN
+
+}  // namespace dash
+
+#endif  // DASH__ALGORITHM__RADIX_SORT_H
@@ -0,0 +1,242 @@
+#ifndef DASH__ALGORITHM__SCAN_H__
+#define DASH__ALGORITHM__SCAN_H__
+
+#include <dash/iterator/GlobIter.h>
+#include <dash/iterator/IteratorTraits.h>
+
+#include <dash/algorithm/Accumulate.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <iterator>
+#include <numeric>
+
+
+namespace dash {
+
+namespace internal {
+
+  /**
+   * Combines the totals of the local ranges of all units preceding the
+   * calling unit in \c team.
+   * Returns a result marked as invalid if all preceding units provided an
+   * empty range.
+   */
+  template <
+    class ValueType,
+    class BinaryOperation >
+  local_result<ValueType> scan_exclusive_prefix(
+    const local_result<ValueType> & l_total,
+    BinaryOperation                 binary_op,
+    dash::Team                    & team)
+  {
+    using local_result_t = struct local_result<ValueType>;
+
+    local_result_t   prefix;
+    dart_operation_t dop   =
+                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
+    dart_datatype_t  dtype = dash::dart_storage<ValueType>::dtype;
+
+    if (dop == DART_OP_SUM && dtype != DART_TYPE_UNDEFINED) {
+      // ideal case: the value-initialized total of empty ranges is the
+      // identity of the predefined reduction
+      ValueType l_value = l_total.value;
+      DASH_ASSERT_RETURNS(
+        dart_exscan(&l_value, &prefix.value, 1, dtype, dop, team.dart_id()),
+        DART_OK);
+      prefix.valid = true;
+    } else {
+      dart_type_create_custom(sizeof(local_result_t), &dtype);
+
+      // we need a custom reduction operation because not every unit
+      // may have valid values, scan order has to be preserved
+      dart_op_create(
+        &dash::internal::accumulate_custom_fn<ValueType, BinaryOperation>,
+        &binary_op, false, dtype, true, &dop);
+      DASH_ASSERT_RETURNS(
+        dart_exscan(&l_total, &prefix, 1, dtype, dop, team.dart_id()),
+        DART_OK);
+      dart_op_destroy(&dop);
+      dart_type_destroy(&dtype);
+    }
+    if (team.myid() == 0) {
+      // result of exscan at first unit is undefined
+      prefix.valid = false;
+    }
+    return prefix;
+  }
+
+} // namespace internal
+
+/**
+ * Computes the inclusive prefix reduction of the elements in the global
+ * range [\c in_first, \c in_last) using \c binary_op and writes the result
+ * to the range beginning at \c out_first.
+ *
+ * Each unit first scans its local elements, the totals of the local ranges
+ * are then combined across units using \c dart_exscan before every unit
+ * applies the prefix of its preceding units to its local results.
+ *
+ * The iteration order is the order of units in the team, the local range of
+ * every unit must therefore be contiguous in the global range, as in a
+ * \c dash::BLOCKED distribution. The output range must have the same
+ * distribution as the input range and may be identical to it.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Global iterator describing the beginning of the range to
+ *                  scan.
+ * \param in_last   Global iterator describing the end of the range to scan.
+ * \param out_first Global iterator describing the beginning of the output
+ *                  range.
+ * \param binary_op The associative binary operation to apply
+ *                  (default: using \c operator+)
+ *
+ * \return  Global iterator to the end of the output range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class BinaryOperation = dash::plus<
+                            typename dash::iterator_traits<GlobInputIt>::value_type>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt inclusive_scan(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  GlobOutputIt    out_first,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  using value_t        = typename std::remove_cv<
+                           typename dash::iterator_traits<GlobInputIt>::value_type
+                         >::type;
+  using local_result_t = struct dash::internal::local_result<value_t>;
+
+  auto & team     = in_first.team();
+  auto   out_last = out_first + dash::distance(in_first, in_last);
+
+  auto in_range  = dash::local_range(in_first, in_last);
+  auto out_range = dash::local_range(out_first, out_last);
+  auto l_first   = in_range.begin;
+  auto l_last    = in_range.end;
+  auto l_out     = out_range.begin;
+
+  DASH_ASSERT_EQ(
+    std::distance(l_first, l_last),
+    std::distance(out_range.begin, out_range.end),
+    "dash::inclusive_scan: output range must have the distribution of the "
+    "input range");
+
+  local_result_t l_total;
+  if (l_first != l_last) {
+    auto l_out_last = std::partial_sum(l_first, l_last, l_out, binary_op);
+    l_total.value   = *std::prev(l_out_last);
+    l_total.valid   = true;
+  }
+
+  auto prefix = dash::internal::scan_exclusive_prefix(
+                  l_total, binary_op, team);
+
+  if (prefix.valid) {
+    std::transform(
+      out_range.begin, out_range.end, out_range.begin,
+      [&](const value_t & v) { return binary_op(prefix.value, v); });
+  }
+  return out_last;
+}
+
+/**
+ * Computes the exclusive prefix reduction of the elements in the global
+ * range [\c in_first, \c in_last) using \c binary_op and writes the result
+ * to the range beginning at \c out_first, i.e. the i-th output element is
+ * the reduction of \c init and the first \c i-1 input elements.
+ *
+ * Each unit first scans its local elements, the totals of the local ranges
+ * are then combined across units using \c dart_exscan before every unit
+ * applies the prefix of its preceding units to its local results.
+ *
+ * The iteration order is the order of units in the team, the local range of
+ * every unit must therefore be contiguous in the global range, as in a
+ * \c dash::BLOCKED distribution. The output range must have the same
+ * distribution as the input range and may be identical to it.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Global iterator describing the beginning of the range to
+ *                  scan.
+ * \param in_last   Global iterator describing the end of the range to scan.
+ * \param out_first Global iterator describing the beginning of the output
+ *                  range.
+ * \param init      The initial element of the scan.
+ * \param binary_op The associative binary operation to apply
+ *                  (default: using \c operator+)
+ *
+ * \return  Global iterator to the end of the output range.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  class ValueType,
+  class BinaryOperation = dash::plus<ValueType>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+GlobOutputIt exclusive_scan(
+  GlobInputIt       in_first,
+  GlobInputIt       in_last,
+  GlobOutputIt      out_first,
+  const ValueType & init,
+  BinaryOperation   binary_op = BinaryOperation())
+{
+  using local_result_t = struct dash::internal::local_result<ValueType>;
+
+  auto & team     = in_first.team();
+  auto   out_last = out_first + dash::distance(in_first, in_last);
+
+  auto in_range  = dash::local_range(in_first, in_last);
+  auto out_range = dash::local_range(out_first, out_last);
+  auto l_first   = in_range.begin;
+  auto l_last    = in_range.end;
+  auto l_out     = out_range.begin;
+  auto l_size    = std::distance(l_first, l_last);
+
+  DASH_ASSERT_EQ(
+    l_size,
+    std::distance(out_range.begin, out_range.end),
+    "dash::exclusive_scan: output range must have the distribution of the "
+    "input range");
+
+  // local inclusive scan, shifted into exclusive order after the prefix of
+  // preceding units is known
+  local_result_t l_total;
+  if (l_size > 0) {
+    auto l_out_last = std::partial_sum(l_first, l_last, l_out, binary_op);
+    l_total.value   = *std::prev(l_out_last);
+    l_total.valid   = true;
+  }
+
+  auto prefix = dash::internal::scan_exclusive_prefix(
+                  l_total, binary_op, team);
+
+  if (l_size > 0) {
+    ValueType offset = prefix.valid
+                       ? binary_op(init, prefix.value)
+                       : init;
+    for (auto i = l_size - 1; i > 0; --i) {
+      l_out[i] = binary_op(offset, l_out[i - 1]);
+    }
+    l_out[0] = offset;
+  }
+  return out_last;
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SCAN_H__
@@ -20,8 +20,14 @@
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
 
+#include <dash/internal/Config.h>
 #include <dash/internal/Logging.h>
 #include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace dash {
 
@@ -63,6 +69,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end);
  * This variant may be appropriate if the underlying container does not hold
  * arithmetic values (e.g. structs).
  *
+ * If OpenMP is enabled, the node-local phases run on the threads available
+ * to the unit, so the hash function must be safe to call concurrently.
+ *
  * In terms of data distribution, source and destination ranges passed to
  * \c dash::sort must be global (\c GlobIter<ValueType>).
  *
@@ -96,8 +105,80 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
 
 #define NLT_NLE_BLOCK 2
 
+/// Minimum number of local elements per thread in node-local phases
+#define PSORT_MIN_ELEM_PER_THREAD 4096
+
 namespace detail {
 
+#ifdef DASH_ENABLE_OPENMP
+/**
+ * Merges the adjacent sorted runs [first + run_displs[i],
+ * first + run_displs[i+1]) in place. Runs are merged pairwise in rounds of
+ * doubling width, the merges of a round are distributed among \c n_threads
+ * threads.
+ */
+template <class RandomIt, class Compare>
+inline void psort__parallel_merge_runs(
+    RandomIt                   first,
+    std::vector<size_t> const& run_displs,
+    Compare                    comp,
+    int                        n_threads)
+{
+  DASH_LOG_TRACE("< psort__parallel_merge_runs", "threads:", n_threads);
+
+  int const nruns = static_cast<int>(run_displs.size()) - 1;
+
+  for (int width = 1; width < nruns; width *= 2) {
+#pragma omp parallel for num_threads(n_threads) schedule(dynamic)
+    for (int r = 0; r < nruns; r += 2 * width) {
+      auto const mid  = std::min(r + width, nruns);
+      auto const last = std::min(r + 2 * width, nruns);
+      if (mid < last) {
+        std::inplace_merge(
+            first + run_displs[r],
+            first + run_displs[mid],
+            first + run_displs[last],
+            comp);
+      }
+    }
+  }
+
+  DASH_LOG_TRACE("psort__parallel_merge_runs >");
+}
+#endif
+
+/**
+ * Sorts the local range [first, last). If OpenMP is enabled and the range is
+ * large enough, equally sized chunks are sorted by \c n_threads threads and
+ * merged afterwards.
+ */
+template <class RandomIt, class Compare>
+inline void psort__local_sort(
+    RandomIt first, RandomIt last, Compare comp, int n_threads)
+{
+#ifdef DASH_ENABLE_OPENMP
+  auto const n_l_elem = std::distance(first, last);
+
+  if (n_threads > 1 && n_l_elem >= n_threads * PSORT_MIN_ELEM_PER_THREAD) {
+    DASH_LOG_TRACE("psort__local_sort", "threads:", n_threads);
+
+    std::vector<size_t> chunk_displs(n_threads + 1);
+    for (int t = 0; t <= n_threads; ++t) {
+      chunk_displs[t] = (n_l_elem * t) / n_threads;
+    }
+
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+    for (int t = 0; t < n_threads; ++t) {
+      std::sort(first + chunk_displs[t], first + chunk_displs[t + 1], comp);
+    }
+
+    psort__parallel_merge_runs(first, chunk_displs, comp, n_threads);
+    return;
+  }
+#endif
+  std::sort(first, last, comp);
+}
+
 struct UnitInfo {
   std::size_t nunits;
   // prefix sum over the number of local elements of all unit
@@ -190,7 +271,8 @@ psort__local_histogram(
     PartitionBorder<MappedType> const& p_borders,
     ElementType const*                 lbegin,
     ElementType const*                 lend,
-    SortableHash&&                     sortable_hash)
+    SortableHash&&                     sortable_hash,
+    int                                n_threads = 1)
 {
   DASH_LOG_TRACE("< psort__local_histogram");
 
@@ -219,15 +301,42 @@ psort__local_histogram(
     return b < sortable_hash(a);
   };
 
-  for (auto const& idx : valid_partitions) {
-    auto lb_it = std::lower_bound(lbegin, lend, partitions[idx], comp_lower);
-    auto ub_it = std::upper_bound(lbegin, lend, partitions[idx], comp_upper);
+  auto const n_valid = static_cast<int>(valid_partitions.size());
+
+  // bounds of the valid partitions, searched independently
+  std::vector<std::size_t> v_lt(n_valid);
+  std::vector<std::size_t> v_le(n_valid);
+
+#ifdef DASH_ENABLE_OPENMP
+  if (n_threads > 1 && n_valid > 1 &&
+      n_l_elem >= n_threads * PSORT_MIN_ELEM_PER_THREAD) {
+#pragma omp parallel for num_threads(n_threads) schedule(static)
+    for (int v = 0; v < n_valid; ++v) {
+      auto const& p_val = partitions[valid_partitions[v]];
+      v_lt[v] = std::distance(
+          lbegin, std::lower_bound(lbegin, lend, p_val, comp_lower));
+      v_le[v] = std::distance(
+          lbegin, std::upper_bound(lbegin, lend, p_val, comp_upper));
+    }
+  }
+  else
+#endif
+  {
+    for (int v = 0; v < n_valid; ++v) {
+      auto const& p_val = partitions[valid_partitions[v]];
+      v_lt[v] = std::distance(
+          lbegin, std::lower_bound(lbegin, lend, p_val, comp_lower));
+      v_le[v] = std::distance(
+          lbegin, std::upper_bound(lbegin, lend, p_val, comp_upper));
+    }
+  }
 
-    auto const p_left = p_borders.left_partition[idx];
+  for (int v = 0; v < n_valid; ++v) {
+    auto const p_left = p_borders.left_partition[valid_partitions[v]];
     DASH_ASSERT_NE(p_left, dash::team_unit_t{}, "invalid bounding unit");
 
-    n_lt[p_left + 1] = std::distance(lbegin, lb_it);
-    n_le[p_left + 1] = std::distance(lbegin, ub_it);
+    n_lt[p_left + 1] = v_lt[v];
+    n_le[p_left + 1] = v_le[v];
   }
 
   auto const last_valid_border_idx = *std::prev(valid_partitions.cend());
@@ -515,52 +624,34 @@ inline void psort__calc_send_count(
   DASH_LOG_TRACE("psort__calc_send_count >");
 }
 
-template <typename ElementType>
-inline void psort__calc_target_displs(
-    PartitionBorder<ElementType> const& p_borders,
-    std::vector<size_t> const&          valid_partitions,
-    dash::Array<size_t>&                g_partition_data)
+inline void psort__calc_target_displs(dash::Array<size_t>& g_partition_data)
 {
   DASH_LOG_TRACE("< psort__calc_target_displs");
   auto const nunits = g_partition_data.team().size();
   auto const myid   = g_partition_data.team().myid();
 
+  auto l_send_count    = &(g_partition_data.local[IDX_SEND_COUNT(nunits)]);
   auto l_target_displs = &(g_partition_data.local[IDX_TARGET_DISP(nunits)]);
 
+  // The displacement in the local range of unit u is the number of elements
+  // which all preceding units send to u, i.e. an exclusive scan over the
+  // send counts.
+  DASH_ASSERT_RETURNS(
+      dart_exscan(
+          l_send_count,
+          l_target_displs,
+          nunits,
+          dart_datatype<size_t>::value,
+          DART_OP_SUM,
+          g_partition_data.team().dart_id()),
+      DART_OK);
+
   if (0 == myid) {
     // Unit 0 always writes to target offset 0
     std::fill(l_target_displs, l_target_displs + nunits, 0);
   }
 
-  std::vector<size_t> target_displs(nunits, 0);
-
-  auto const u_blocksize = g_partition_data.lsize();
-
-  for (auto const& border_idx : valid_partitions) {
-    auto const     left_u  = p_borders.left_partition[border_idx];
-    auto const     right_u = border_idx + 1;
-    size_t const val =
-        (left_u == myid)
-            ? g_partition_data.local[left_u + IDX_SEND_COUNT(nunits)]
-            : g_partition_data
-                  [left_u * u_blocksize + myid + IDX_SEND_COUNT(nunits)];
-    target_displs[right_u] = val + target_displs[left_u];
-
-    if (right_u == myid) {
-      // we are local
-      g_partition_data.local[IDX_TARGET_DISP(nunits) + myid] =
-          target_displs[right_u];
-    }
-    else {
-      auto const target_offset =
-          right_u * u_blocksize + myid + IDX_TARGET_DISP(nunits);
-
-      g_partition_data.async[target_offset].set(&(target_displs[right_u]));
-    }
-  }
-
   DASH_LOG_TRACE("psort__calc_target_displs >");
-  g_partition_data.async.flush();
 }
 
 template <typename GlobIterT>
@@ -730,6 +821,60 @@ inline void psort__init_partition_borders(
   DASH_LOG_TRACE("psort__init_partition_borders >");
 }
 
+/**
+ * Merges the sorted runs [first + run_displs[i], first + run_displs[i+1])
+ * into the range beginning at \c out using a min-heap over the heads of
+ * all non-empty runs, i.e. in O(n log k) for k runs.
+ */
+template <class InputIt, class OutputIt, class Compare>
+inline OutputIt psort__merge_local_runs(
+    InputIt                    first,
+    std::vector<size_t> const& run_displs,
+    OutputIt                   out,
+    Compare                    comp)
+{
+  DASH_LOG_TRACE("< psort__merge_local_runs");
+
+  using run_t = std::pair<InputIt, InputIt>;
+
+  std::vector<run_t> runs;
+  runs.reserve(run_displs.size());
+
+  for (std::size_t r = 0; r + 1 < run_displs.size(); ++r) {
+    if (run_displs[r] < run_displs[r + 1]) {
+      runs.emplace_back(
+          std::next(first, run_displs[r]), std::next(first, run_displs[r + 1]));
+    }
+  }
+
+  // the run with the smallest head is on top of the heap
+  auto const heap_comp = [&comp](run_t const& a, run_t const& b) {
+    return comp(*b.first, *a.first);
+  };
+
+  std::make_heap(runs.begin(), runs.end(), heap_comp);
+
+  while (runs.size() > 1) {
+    std::pop_heap(runs.begin(), runs.end(), heap_comp);
+    auto& run = runs.back();
+    *out      = std::move(*run.first);
+    ++out;
+    if (++run.first == run.second) {
+      runs.pop_back();
+    }
+    else {
+      std::push_heap(runs.begin(), runs.end(), heap_comp);
+    }
+  }
+
+  if (!runs.empty()) {
+    out = std::move(runs.front().first, runs.front().second, out);
+  }
+
+  DASH_LOG_TRACE("psort__merge_local_runs >");
+  return out;
+}
+
 }  // namespace detail
 
 template <class GlobRandomIt, class SortableHash>
@@ -749,6 +894,19 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   dash::util::Trace trace("Sort");
 
+  auto const sort_comp = [&sortable_hash](
+                             const value_type& a, const value_type& b) {
+    return sortable_hash(a) < sortable_hash(b);
+  };
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto const n_threads = uloc.num_domain_threads();
+  DASH_LOG_DEBUG("dash::sort", "thread capacity:", n_threads);
+#else
+  int const n_threads = 1;
+#endif
+
   if (pattern.team() == dash::Team::Null()) {
     DASH_LOG_TRACE("dash::sort", "Sorting on dash::Team::Null()");
     return;
@@ -756,7 +914,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   if (pattern.team().size() == 1) {
     DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
     trace.enter_state("final_local_sort");
-    std::sort(begin.local(), end.local());
+    detail::psort__local_sort(begin.local(), end.local(), sort_comp, n_threads);
     trace.exit_state("final_local_sort");
     return;
   }
@@ -785,14 +943,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto lbegin = l_mem_begin + l_range.begin;
   auto lend   = l_mem_begin + l_range.end;
 
-  auto const sort_comp = [&sortable_hash](
-                             const value_type& a, const value_type& b) {
-    return sortable_hash(a) < sortable_hash(b);
-  };
-
   // initial local_sort
   trace.enter_state("1:initial_local_sort");
-  std::sort(lbegin, lend, sort_comp);
+  detail::psort__local_sort(lbegin, lend, sort_comp, n_threads);
   trace.exit_state("1:initial_local_sort");
 
   trace.enter_state("2:init_temporary_global_data");
@@ -896,8 +1049,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     return;
   }
 
-  // Temporary local buffer (sorted);
-  std::vector<value_type> const lcopy(lbegin, lend);
+  // Temporary local buffer (sorted), reused as merge buffer in the final
+  // phase
+  std::vector<value_type> lcopy(lbegin, lend);
 
   trace.exit_state("3:init_temporary_local_data");
 
@@ -916,7 +1070,13 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         "partition borders", std::begin(partitions), std::end(partitions));
 
     auto const histograms = detail::psort__local_histogram(
-        partitions, valid_partitions, p_borders, lbegin, lend, sortable_hash);
+        partitions,
+        valid_partitions,
+        p_borders,
+        lbegin,
+        lend,
+        sortable_hash,
+        n_threads);
 
     auto const& l_nlt = histograms.first;
     auto const& l_nle = histograms.second;
@@ -953,7 +1113,13 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("5:final_local_histogram");
   auto histograms = detail::psort__local_histogram(
-      partitions, valid_partitions, p_borders, lbegin, lend, sortable_hash);
+      partitions,
+      valid_partitions,
+      p_borders,
+      lbegin,
+      lend,
+      sortable_hash,
+      n_threads);
   trace.exit_state("5:final_local_histogram");
 
   /* How many elements are less than P
@@ -972,43 +1138,36 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   DASH_LOG_TRACE_RANGE("final histograms: l_nle", l_nle.begin(), l_nle.end());
 
   trace.enter_state("6:transpose_local_histograms (all-to-all)");
-  if (n_l_elem > 0) {
-    // TODO(kowalewski): minimize communication to copy only until the last
-    // valid border
+  {
     /*
      * Transpose (Shuffle) the final histograms to communicate
      * the partition distribution
      */
-    for (std::size_t idx = 1; idx < l_nlt.size(); ++idx) {
-      auto const transposed_unit = idx - 1;
-
-      if (transposed_unit != myid) {
-        auto const offset = transposed_unit * g_partition_data.lsize() + myid;
-        // We communicate only non-zero values
-        if (l_nlt[idx] > 0) {
-          g_partition_data.async[offset + IDX_DIST(nunits)].set(
-              &(l_nlt[idx]));
-        }
-
-        if (l_nle[idx] > 0) {
-          g_partition_data.async[offset + IDX_SUPP(nunits)].set(
-              &(l_nle[idx]));
-        }
-      }
-      else {
-        g_partition_data.local[myid + IDX_DIST(nunits)] = l_nlt[idx];
-        g_partition_data.local[myid + IDX_SUPP(nunits)] = l_nle[idx];
-      }
+    std::vector<size_t> l_nlt_nle(NLT_NLE_BLOCK * nunits);
+    std::vector<size_t> g_nlt_nle(NLT_NLE_BLOCK * nunits);
+    for (std::size_t unit = 0; unit < nunits; ++unit) {
+      l_nlt_nle[unit * NLT_NLE_BLOCK]     = l_nlt[unit + 1];
+      l_nlt_nle[unit * NLT_NLE_BLOCK + 1] = l_nle[unit + 1];
+    }
+
+    DASH_ASSERT_RETURNS(
+        dart_alltoall(
+            l_nlt_nle.data(),
+            g_nlt_nle.data(),
+            NLT_NLE_BLOCK,
+            dart_datatype<size_t>::value,
+            team.dart_id()),
+        DART_OK);
+
+    auto l_dist = &(g_partition_data.local[IDX_DIST(nunits)]);
+    auto l_supp = &(g_partition_data.local[IDX_SUPP(nunits)]);
+    for (std::size_t unit = 0; unit < nunits; ++unit) {
+      l_dist[unit] = g_nlt_nle[unit * NLT_NLE_BLOCK];
+      l_supp[unit] = g_nlt_nle[unit * NLT_NLE_BLOCK + 1];
     }
-    // complete outstanding requests...
-    g_partition_data.async.flush();
   }
   trace.exit_state("6:transpose_local_histograms (all-to-all)");
 
-  trace.enter_state("7:barrier");
-  team.barrier();
-  trace.exit_state("7:barrier");
-
   DASH_LOG_TRACE_RANGE(
       "initial partition distribution:",
       std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
@@ -1034,51 +1193,23 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       std::next(g_partition_data.lbegin(), IDX_DIST(nunits)),
       std::next(g_partition_data.lbegin(), IDX_DIST(nunits) + nunits));
 
-  // Reset local elements to 0 since the following matrix transpose
-  // communicates only non-zero values and writes to exactly these offsets.
-  std::fill(
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits)]),
-      &(g_partition_data.local[IDX_TARGET_COUNT(nunits) + nunits]),
-      0);
-
   trace.exit_state("8:calc_final_partition_dist");
 
-  trace.enter_state("9:barrier");
-  team.barrier();
-  trace.exit_state("9:barrier");
-
   trace.enter_state("10:transpose_final_partition_dist (all-to-all)");
   /*
    * Transpose the final distribution again to obtain the end offsets
    */
-  dash::team_unit_t unit{0};
-  auto const        last = static_cast<dash::team_unit_t>(nunits);
-
-  for (; unit < last; ++unit) {
-    if (g_partition_data.local[IDX_DIST(nunits) + unit] == 0) {
-      continue;
-    }
-
-    if (unit != myid) {
-      // We communicate only non-zero values
-      auto const offset = unit * g_partition_data.lsize() + myid;
-      g_partition_data.async[offset + IDX_TARGET_COUNT(nunits)].set(
-          &(g_partition_data.local[IDX_DIST(nunits) + unit]));
-    }
-    else {
-      g_partition_data.local[IDX_TARGET_COUNT(nunits) + myid] =
-          g_partition_data.local[IDX_DIST(nunits) + unit];
-    }
-  }
-
-  g_partition_data.async.flush();
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          &(g_partition_data.local[IDX_DIST(nunits)]),
+          &(g_partition_data.local[IDX_TARGET_COUNT(nunits)]),
+          1,
+          dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
 
   trace.exit_state("10:transpose_final_partition_dist (all-to-all)");
 
-  trace.enter_state("11:barrier");
-  team.barrier();
-  trace.exit_state("11:barrier");
-
   DASH_LOG_TRACE_RANGE(
       "final target count",
       std::next(g_partition_data.lbegin(), IDX_TARGET_COUNT(nunits)),
@@ -1096,18 +1227,11 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     // Obtain the final send displs which is just an exclusive scan based on
     // the send count
     auto l_send_count = &(g_partition_data.local[IDX_SEND_COUNT(nunits)]);
-    std::copy(l_send_count, l_send_count + nunits, std::begin(l_send_displs));
-
     std::partial_sum(
-        std::begin(l_send_displs),
-        std::end(l_send_displs),
-        std::begin(l_send_displs),
+        l_send_count,
+        l_send_count + nunits - 1,
+        std::next(std::begin(l_send_displs)),
         std::plus<size_t>());
-
-    // Shift by 1 and fill leading element with 0 to obtain the exclusive scan
-    // character
-    l_send_displs.insert(std::begin(l_send_displs), 0);
-    l_send_displs.pop_back();
   }
   else {
     std::fill(
@@ -1153,16 +1277,31 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("14:calc_final_target_displs");
 
-  if (n_l_elem > 0) {
-    detail::psort__calc_target_displs(
-        p_borders, valid_partitions, g_partition_data);
-  }
+  detail::psort__calc_target_displs(g_partition_data);
 
   trace.exit_state("14:calc_final_target_displs");
 
-  trace.enter_state("15:barrier");
-  team.barrier();
-  trace.exit_state("15:barrier");
+  trace.enter_state("15:transpose_send_count (all-to-all)");
+
+  // The elements received from each unit form a sorted run in the local
+  // range, ordered by unit. Obtain the run offsets for the final merge.
+  std::vector<size_t> l_recv_displs(nunits + 1, 0);
+
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          &(g_partition_data.local[IDX_SEND_COUNT(nunits)]),
+          std::next(l_recv_displs.data()),
+          1,
+          dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  std::partial_sum(
+      std::next(std::begin(l_recv_displs)),
+      std::end(l_recv_displs),
+      std::next(std::begin(l_recv_displs)));
+
+  trace.exit_state("15:transpose_send_count (all-to-all)");
 
   DASH_LOG_TRACE_RANGE(
       "target displs",
@@ -1231,9 +1370,27 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   team.barrier();
   trace.exit_state("17:barrier");
 
-  trace.enter_state("18:final_local_sort");
-  std::sort(lbegin, lend, sort_comp);
-  trace.exit_state("18:final_local_sort");
+  trace.enter_state("18:final_local_merge");
+
+  DASH_ASSERT_EQ(
+      l_recv_displs.back(),
+      static_cast<size_t>(n_l_elem),
+      "received elements must match the capacity of the unit");
+
+#ifdef DASH_ENABLE_OPENMP
+  if (n_threads > 1 && n_l_elem >= n_threads * PSORT_MIN_ELEM_PER_THREAD) {
+    detail::psort__parallel_merge_runs(
+        lbegin, l_recv_displs, sort_comp, n_threads);
+  }
+  else
+#endif
+  {
+    detail::psort__merge_local_runs(
+        lbegin, l_recv_displs, std::begin(lcopy), sort_comp);
+    std::move(std::begin(lcopy), std::end(lcopy), lbegin);
+  }
+
+  trace.exit_state("18:final_local_merge");
   DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
 
   trace.enter_state("19:final_barrier");
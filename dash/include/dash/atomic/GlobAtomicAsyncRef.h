@@ -206,6 +206,9 @@ public:
             "Cannot modify value referenced by GlobAsyncRef<Atomic<const T>>!");
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.set()", value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.set",   _gptr);
+    if (aggregate(&value, DART_OP_REPLACE)) {
+      return;
+    }
     dart_ret_t ret = dart_accumulate_blocking_local(
                        _gptr,
                        &value,
@@ -227,6 +230,9 @@ public:
             "Cannot modify value referenced by GlobAsyncRef<Atomic<const T>>!");
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.set()", *ptr);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.set",   _gptr);
+    if (aggregate(ptr, DART_OP_REPLACE)) {
+      return;
+    }
     dart_ret_t ret = dart_accumulate(
                        _gptr,
                        ptr,
@@ -267,6 +273,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.get", _gptr);
     nonconst_value_type nothing;
     nonconst_value_type result;
+    flush_aggregated();
     dart_ret_t ret = dart_fetch_and_op(
                        _gptr,
                        &nothing,
@@ -291,6 +298,7 @@ public:
     DASH_LOG_DEBUG("GlobAsyncRef<Atomic>.get()");
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.get", _gptr);
     nonconst_value_type nothing;
+    flush_aggregated();
     dart_ret_t ret = dart_fetch_and_op(
                        _gptr,
                        &nothing,
@@ -324,6 +332,9 @@ public:
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.op()", value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.op",   _gptr);
     DASH_LOG_TRACE("GlobAsyncRef<Atomic>.op", "dart_accumulate");
+    if (aggregate(&value, binary_op.dart_operation())) {
+      return;
+    }
     dart_ret_t ret = dart_accumulate_blocking_local(
                        _gptr,
                        &value,
@@ -351,6 +362,7 @@ public:
     DASH_LOG_DEBUG_VAR("GlobAsyncRef<Atomic>.fetch_op()", value);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.fetch_op",   _gptr);
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.fetch_op",   typeid(value).name());
+    flush_aggregated();
     dart_ret_t ret = dart_fetch_and_op(
                        _gptr,
                        &value,
@@ -391,6 +403,7 @@ public:
     DASH_LOG_TRACE_VAR("GlobAsyncRef<Atomic>.compare_exchange",   expected);
     DASH_LOG_TRACE_VAR(
       "GlobAsyncRef<Atomic>.compare_exchange", typeid(desired).name());
+    flush_aggregated();
     dart_ret_t ret = dart_compare_and_swap(
                        _gptr,
                        &desired,
@@ -478,11 +491,42 @@ public:
     fetch_op(dash::multiply<nonconst_value_type>(), value, result);
   }
 
+private:
+
+  /**
+   * Buffers the atomic update if aggregation is enabled.
+   *
+   * \return  \c true if the update has been buffered.
+   */
+  bool aggregate(const T * value, dart_operation_t op) const
+  {
+    auto & aggregator = dash::internal::AsyncAggregator::instance();
+    if (!aggregator.enabled()) {
+      return false;
+    }
+    aggregator.accumulate(
+      _gptr, value, 1, sizeof(nonconst_value_type),
+      dash::dart_punned_datatype<nonconst_value_type>::value, op);
+    return true;
+  }
+
+  /**
+   * Issues buffered updates before an operation that is not aggregated,
+   * so that it observes them in program order.
+   */
+  void flush_aggregated() const
+  {
+    dash::internal::AsyncAggregator::instance().flush(_gptr);
+  }
+
+public:
+
   /**
    * Flush all pending asynchronous operations on this asynchronous reference.
    */
   void flush() const
   {
+    dash::internal::AsyncAggregator::instance().flush(_gptr);
     DASH_ASSERT_RETURNS(
       dart_flush(_gptr),
       DART_OK
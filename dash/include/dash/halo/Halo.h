@@ -4,10 +4,13 @@
 #include <dash/iterator/GlobIter.h>
 #include <dash/memory/GlobStaticMem.h>
 
+#include <dash/Exception.h>
 #include <dash/internal/Logging.h>
 #include <dash/util/FunctionalExpr.h>
 
 #include <functional>
+#include <map>
+#include <vector>
 
 namespace dash {
 
@@ -616,7 +619,12 @@ public:
   using region_extent_t = typename RegionSpec_t::region_extent_t;
 
 public:
-  constexpr HaloSpec(const Specs_t& specs) : _specs(specs) {}
+  HaloSpec(const Specs_t& specs) : _specs(specs) {
+    for(const auto& spec : _specs) {
+      if(spec.extent() > 0)
+        ++_num_regions;
+    }
+  }
 
   template <typename StencilSpecT>
   HaloSpec(const StencilSpecT& stencil_spec) {
@@ -638,7 +646,8 @@ public:
     }
   }
 
-  HaloSpec(const Self_t& other) { _specs = other._specs; }
+  HaloSpec(const Self_t& other)
+  : _specs(other._specs), _num_regions(other._num_regions) {}
 
   /**
    * Matching \ref RegionSpec for a given region index
@@ -664,6 +673,47 @@ public:
    */
   const Specs_t& specs() const { return _specs; }
 
+  /**
+   * Returns a HaloSpec with halos wide enough for the given number of
+   * stencil sweeps without halo update in between
+   * (see \ref StencilOperator::apply_steps).
+   * All halo extents are multiplied by the number of steps. Regions only
+   * reached after multiple sweeps, e.g. the corners for star shaped
+   * stencils, are added.
+   */
+  Self_t multi_step(region_extent_t num_steps) const {
+    // maximal extent for both sides of every dimension
+    std::array<std::array<region_extent_t, 2>, NumDimensions> side_ext{};
+    for(const auto& spec : _specs) {
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        if(spec[d] == 1)
+          continue;
+        auto& ext = side_ext[d][spec[d] / 2];
+        ext       = std::max(ext, spec.extent());
+      }
+    }
+
+    Specs_t specs{};
+    for(region_index_t index = 0; index < RegionCoords_t::MaxIndex; ++index) {
+      RegionCoords_t  coords(index);
+      region_extent_t extent = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        if(coords[d] == 1)
+          continue;
+        auto ext = side_ext[d][coords[d] / 2];
+        if(ext == 0) {
+          extent = 0;
+          break;
+        }
+        extent = std::max(extent, ext);
+      }
+      if(extent > 0)
+        specs[index] = RegionSpec_t(index, extent * num_steps);
+    }
+
+    return Self_t(specs);
+  }
+
 private:
   /*
    * Reads all stencil points of the given stencil spec and sets the region
@@ -1172,7 +1222,8 @@ public:
             const HaloSpec_t&      halo_reg_spec,
             const GlobBoundSpec_t& bound_spec = GlobBoundSpec_t{})
   : _globmem(globmem), _pattern(pattern), _view(view),
-    _halo_reg_spec(halo_reg_spec), _view_local(_view.extents()) {
+    _halo_reg_spec(halo_reg_spec), _bound_spec(bound_spec),
+    _view_local(_view.extents()) {
     // setup local views
     _view_inner                 = _view_local;
     _view_inner_with_boundaries = _view_local;
@@ -1354,6 +1405,12 @@ public:
    * Returns used \ref HaloSpec
    */
   const HaloSpec_t& halo_spec() const { return _halo_reg_spec; }
+
+  /**
+   * Returns used \ref GlobalBoundarySpec
+   */
+  const GlobBoundSpec_t& global_boundary_spec() const { return _bound_spec; }
+
   /**
    * Returns a specific halo region and nullptr if no region exists
    */
@@ -1494,6 +1551,8 @@ private:
 
   const HaloSpec_t& _halo_reg_spec;
 
+  const GlobBoundSpec_t _bound_spec;
+
   const ViewSpec_t _view_local;
 
   ViewSpec_t _view_inner_with_boundaries;
@@ -1629,6 +1688,11 @@ public:
    */
   iterator begin() { return _halobuffer.begin(); }
 
+  /**
+   * Returns a pointer to the first halo element
+   */
+  Element_t* data() { return _halobuffer.data(); }
+
   /**
    * Returns a const iterator to the first halo element
    */
@@ -1721,6 +1785,637 @@ private:
   std::array<iterator, MaxIndex> _halo_offsets{};
 };  // class HaloMemory
 
+/**
+ * Direction of the data transfer of a halo update
+ */
+enum class HaloUpdateMode : uint8_t {
+  /// Every unit gets its halo elements from the neighbours. The neighbours
+  /// have to be synchronized, e.g. by a barrier, before every update.
+  PULL,
+  /// Every unit puts its boundary elements into the \ref HaloMemory of the
+  /// neighbours and notifies them. Synchronization is point-to-point only.
+  PUSH
+};
+
+inline std::ostream& operator<<(std::ostream& os, const HaloUpdateMode& mode) {
+  if(mode == HaloUpdateMode::PULL)
+    os << "PULL";
+  else
+    os << "PUSH";
+
+  return os;
+}
+
+/**
+ * Manages the halo updates for all halo regions provided by the given
+ * \ref HaloBlock. Every halo region is transferred into the \ref HaloMemory
+ * by its own DART operation, which allows to update and wait for the regions
+ * independently.
+ *
+ * With \ref HaloUpdateMode::PUSH the halo memory is registered in global
+ * memory and the neighbours put their boundary elements into it with
+ * \c dart_put_notify. Every unit owns a notification counter per halo region
+ * that counts the arrived updates, and a counter per halo region of its
+ * neighbours that counts how often the neighbour released its halo memory
+ * for the next update. All units have to call the same number of updates.
+ */
+template <typename HaloBlockT>
+class HaloUpdateEnv {
+private:
+  static constexpr auto NumDimensions = HaloBlockT::ndim();
+
+  using Self_t          = HaloUpdateEnv<HaloBlockT>;
+  using Element_t       = typename HaloBlockT::Element_t;
+  using Pattern_t       = typename HaloBlockT::Pattern_t;
+  using Region_t        = Region<Element_t, Pattern_t>;
+  using RegionCoords_t  = RegionCoords<NumDimensions>;
+  using pattern_size_t  = typename Pattern_t::size_type;
+  using pattern_index_t = typename Pattern_t::index_type;
+  using ElementCoords_t = std::array<pattern_index_t, NumDimensions>;
+  using Extents_t       = std::array<pattern_size_t, NumDimensions>;
+
+  static constexpr auto MemoryArrange = Pattern_t::memory_order();
+  static constexpr auto MaxIndex      = RegionCoords_t::MaxIndex;
+
+  /// offsets of the counters and halo memory offsets in the signal segment
+  static constexpr auto ArrivedSignals = 0;
+  static constexpr auto ReadySignals   = MaxIndex;
+  static constexpr auto HaloOffsets    = 2 * MaxIndex;
+  static constexpr auto NumSignals     = 3 * MaxIndex;
+
+public:
+  using HaloMemory_t   = HaloMemory<HaloBlockT>;
+  using region_index_t = typename RegionCoords_t::region_index_t;
+
+public:
+  /**
+   * Constructor
+   *
+   * Collective operation on the team of the pattern if the \ref
+   * HaloUpdateMode::PUSH is used.
+   */
+  HaloUpdateEnv(const HaloBlockT& haloblock, HaloMemory_t& halomemory,
+                HaloUpdateMode mode = HaloUpdateMode::PULL)
+  : _mode(mode) {
+    if(_mode == HaloUpdateMode::PUSH) {
+      init_push(haloblock, halomemory);
+      return;
+    }
+
+    for(const auto& region : haloblock.halo_regions()) {
+      if(region.size() == 0)
+        continue;
+      // number of contiguous elements
+      pattern_size_t num_blocks      = 1;
+      pattern_size_t num_elems_block = 1;
+      auto           rel_dim         = region.spec().relevant_dim();
+      auto           level           = region.spec().level();
+      auto*          off = &*(halomemory.first_element_at(region.index()));
+      auto           it  = region.begin();
+
+      if(MemoryArrange == ROW_MAJOR) {
+        if(level == 1) {  //|| (level == 2 && region.regionSpec()[0] != 1)) {
+          for(auto i = rel_dim - 1; i < NumDimensions; ++i)
+            num_elems_block *= region.view().extent(i);
+
+          size_t region_size        = region.size();
+          auto   ds_num_elems_block = dart_storage<Element_t>(num_elems_block);
+          num_blocks                = region_size / num_elems_block;
+          auto           it_dist    = it + num_elems_block;
+          pattern_size_t stride =
+            (num_blocks > 1) ? std::abs(it_dist.lpos().index - it.lpos().index)
+                             : 1;
+          auto            ds_stride = dart_storage<Element_t>(stride);
+          dart_datatype_t stride_type;
+          dart_type_create_strided(ds_num_elems_block.dtype, ds_stride.nelem,
+                                   ds_num_elems_block.nelem, &stride_type);
+          _dart_types.push_back(stride_type);
+
+          _region_data.insert(std::make_pair(
+            region.index(), Data{ region,
+                                  [off, it, region_size, ds_num_elems_block,
+                                   stride_type](dart_handle_t& handle) {
+                                    dart_get_handle(off, it.dart_gptr(),
+                                                    region_size, stride_type,
+                                                    ds_num_elems_block.dtype,
+                                                    &handle);
+                                  },
+                                  DART_HANDLE_NULL }));
+
+        }
+        // TODO more optimizations
+        else {
+          num_elems_block *= region.view().extent(NumDimensions - 1);
+          size_t region_size         = region.size();
+          auto   ds_num_elems_block  = dart_storage<Element_t>(num_elems_block);
+          num_blocks                 = region_size / num_elems_block;
+          auto                it_tmp = it;
+          auto                start_index = it.lpos().index;
+          std::vector<size_t> block_sizes(num_blocks);
+          std::vector<size_t> block_offsets(num_blocks);
+          std::fill(block_sizes.begin(), block_sizes.end(),
+                    ds_num_elems_block.nelem);
+          for(auto& index : block_offsets) {
+            index =
+              dart_storage<Element_t>(it_tmp.lpos().index - start_index).nelem;
+            it_tmp += num_elems_block;
+          }
+          dart_datatype_t index_type;
+          dart_type_create_indexed(
+            ds_num_elems_block.dtype,
+            num_blocks,            // number of blocks
+            block_sizes.data(),    // size of each block
+            block_offsets.data(),  // offset of first element of each block
+            &index_type);
+          _dart_types.push_back(index_type);
+          _region_data.insert(std::make_pair(
+            region.index(), Data{ region,
+                                  [off, it, ds_num_elems_block, region_size,
+                                   index_type](dart_handle_t& handle) {
+                                    dart_get_handle(off, it.dart_gptr(),
+                                                    region_size, index_type,
+                                                    ds_num_elems_block.dtype,
+                                                    &handle);
+                                  },
+                                  DART_HANDLE_NULL }));
+        }
+      } else {
+        if(level == 1) {  //|| (level == 2 &&
+                          // region.regionSpec()[NumDimensions - 1] != 1)) {
+          for(auto i = 0; i < rel_dim; ++i)
+            num_elems_block *= region.view().extent(i);
+
+          size_t region_size        = region.size();
+          auto   ds_num_elems_block = dart_storage<Element_t>(num_elems_block);
+          num_blocks                = region_size / num_elems_block;
+          auto           it_dist    = it + num_elems_block;
+          pattern_size_t stride =
+            (num_blocks > 1) ? std::abs(it_dist.lpos().index - it.lpos().index)
+                             : 1;
+          auto ds_stride = dart_storage<Element_t>(stride);
+
+          dart_datatype_t stride_type;
+          dart_type_create_strided(ds_num_elems_block.dtype, ds_stride.nelem,
+                                   ds_num_elems_block.nelem, &stride_type);
+          _dart_types.push_back(stride_type);
+
+          _region_data.insert(std::make_pair(
+            region.index(), Data{ region,
+                                  [off, it, region_size, ds_num_elems_block,
+                                   stride_type](dart_handle_t& handle) {
+                                    dart_get_handle(off, it.dart_gptr(),
+                                                    region_size, stride_type,
+                                                    ds_num_elems_block.dtype,
+                                                    &handle);
+                                  },
+                                  DART_HANDLE_NULL }));
+        }
+        // TODO more optimizations
+        else {
+          num_elems_block *= region.view().extent(0);
+          size_t region_size         = region.size();
+          auto   ds_num_elems_block  = dart_storage<Element_t>(num_elems_block);
+          num_blocks                 = region_size / num_elems_block;
+          auto                it_tmp = it;
+          std::vector<size_t> block_sizes(num_blocks);
+          std::vector<size_t> block_offsets(num_blocks);
+          std::fill(block_sizes.begin(), block_sizes.end(),
+                    ds_num_elems_block.nelem);
+          auto start_index = it.lpos().index;
+          for(auto& index : block_offsets) {
+            index =
+              dart_storage<Element_t>(it_tmp.lpos().index - start_index).nelem;
+            it_tmp += num_elems_block;
+          }
+
+          dart_datatype_t index_type;
+          dart_type_create_indexed(
+            ds_num_elems_block.dtype,
+            num_blocks,            // number of blocks
+            block_sizes.data(),    // size of each block
+            block_offsets.data(),  // offset of first element of each block
+            &index_type);
+          _dart_types.push_back(index_type);
+
+          _region_data.insert(std::make_pair(
+            region.index(), Data{ region,
+                                  [off, it, index_type, region_size,
+                                   ds_num_elems_block](dart_handle_t& handle) {
+                                    dart_get_handle(off, it.dart_gptr(),
+                                                    region_size, index_type,
+                                                    ds_num_elems_block.dtype,
+                                                    &handle);
+                                  },
+                                  DART_HANDLE_NULL }));
+        }
+
+        num_elems_block = region.view().extent(0);
+      }
+    }
+  }
+
+  HaloUpdateEnv(const Self_t& other) = delete;
+
+  Self_t& operator=(const Self_t& other) = delete;
+
+  ~HaloUpdateEnv() {
+    for(auto& dart_type : _dart_types) {
+      dart_type_destroy(&dart_type);
+    }
+    _dart_types.clear();
+
+    if(_mode == HaloUpdateMode::PUSH) {
+      dart_team_memderegister(_halo_gptr);
+      dart_team_memfree(_signal_gptr);
+    }
+  }
+
+  /**
+   * Returns the used \ref HaloUpdateMode
+   */
+  HaloUpdateMode mode() const { return _mode; }
+
+  /**
+   * Initiates a blocking halo region update for all halo elements.
+   */
+  void update() {
+    update_async();
+    wait();
+  }
+
+  /**
+   * Initiates a blocking halo region update for all halo elements within the
+   * the given region.
+   *
+   * Not supported with \ref HaloUpdateMode::PUSH.
+   */
+  void update_at(region_index_t index) {
+    check_pull_mode();
+    auto it_find = _region_data.find(index);
+    if(it_find != _region_data.end()) {
+      update_halo_intern(it_find->second);
+      dart_wait_local(&it_find->second.handle);
+    }
+  }
+
+  /**
+   * Initiates an asychronous halo region update for all halo elements.
+   *
+   * With \ref HaloUpdateMode::PUSH the call returns after the own boundary
+   * elements have been put to the neighbours, which requires the neighbours
+   * to have initiated the same update.
+   */
+  void update_async() {
+    if(_mode == HaloUpdateMode::PUSH) {
+      push_halos();
+      return;
+    }
+
+    for(auto& region : _region_data) {
+      update_halo_intern(region.second);
+    }
+  }
+
+  /**
+   * Initiates an asychronous halo region update for all halo elements within
+   * the given region.
+   *
+   * Not supported with \ref HaloUpdateMode::PUSH.
+   */
+  void update_async_at(region_index_t index) {
+    check_pull_mode();
+    auto it_find = _region_data.find(index);
+    if(it_find != _region_data.end()) {
+      update_halo_intern(it_find->second);
+    }
+  }
+
+  /**
+   * Waits until all halo updates are finished. Only useful for asynchronous
+   * halo updates.
+   */
+  void wait() {
+    if(_mode == HaloUpdateMode::PUSH) {
+      for(const auto& ready : _ready_signals) {
+        dart_notify_wait(signal_gptr(_myid, ArrivedSignals + ready.first),
+                         _epoch);
+      }
+      return;
+    }
+
+    for(auto& region : _region_data) {
+      dart_wait_local(&region.second.handle);
+    }
+  }
+
+  /**
+   * Waits until the halo updates for the given halo region is finished.
+   * Only useful for asynchronous halo updates.
+   */
+  void wait(region_index_t index) {
+    if(_mode == HaloUpdateMode::PUSH) {
+      if(_ready_signals.find(index) != _ready_signals.end())
+        dart_notify_wait(signal_gptr(_myid, ArrivedSignals + index), _epoch);
+      return;
+    }
+
+    auto it_find = _region_data.find(index);
+    if(it_find != _region_data.end())
+      dart_wait_local(&it_find->second.handle);
+  }
+
+  /**
+   * Returns true if the halo update for the given halo region is finished
+   * or no update is pending. Doesn't block.
+   */
+  bool test(region_index_t index) {
+    int32_t flag;
+    if(_mode == HaloUpdateMode::PUSH) {
+      if(_ready_signals.find(index) == _ready_signals.end())
+        return true;
+
+      dart_notify_test(signal_gptr(_myid, ArrivedSignals + index), _epoch,
+                       &flag);
+
+      return flag;
+    }
+
+    auto it_find = _region_data.find(index);
+    if(it_find == _region_data.end())
+      return true;
+
+    dart_test_local(&it_find->second.handle, &flag);
+
+    return flag;
+  }
+
+private:
+  struct Data {
+    const Region_t&                     region;
+    std::function<void(dart_handle_t&)> get_halos;
+    dart_handle_t                       handle;
+  };
+
+  struct PushData {
+    /// halo region index at the receiving unit
+    region_index_t   index;
+    /// halo memory of the region at the receiving unit
+    dart_gptr_t      dst;
+    /// arrival counter of the region at the receiving unit
+    dart_gptr_t      notify;
+    const Element_t* src;
+    size_t           nelem;
+    dart_datatype_t  src_type;
+    dart_datatype_t  dst_type;
+  };
+
+  void update_halo_intern(Data& data) {
+    if(data.region.is_custom_region())
+      return;
+
+    data.get_halos(data.handle);
+  }
+
+  void check_pull_mode() const {
+    if(_mode != HaloUpdateMode::PULL) {
+      DASH_THROW(dash::exception::InvalidArgument,
+                 "Updates of single halo regions require HaloUpdateMode::PULL");
+    }
+  }
+
+  /**
+   * Global pointer to the signal segment entry with the given offset at
+   * the given unit.
+   */
+  dart_gptr_t signal_gptr(team_unit_t unit, region_index_t offset) const {
+    auto gptr = _signal_gptr;
+    dart_gptr_setunit(&gptr, unit);
+    dart_gptr_incaddr(&gptr, offset * sizeof(int64_t));
+
+    return gptr;
+  }
+
+  /**
+   * Registers the halo memory, allocates the notification counters and sets
+   * up a put for every neighbouring halo region that is filled with local
+   * boundary elements.
+   */
+  void init_push(const HaloBlockT& haloblock, HaloMemory_t& halomemory) {
+    const auto& pattern    = haloblock.pattern();
+    const auto& view       = haloblock.view();
+    const auto& halo_spec  = haloblock.halo_spec();
+    const auto& bound_spec = haloblock.global_boundary_spec();
+    auto        team       = pattern.team().dart_id();
+    _myid                  = pattern.team().myid();
+
+    auto ds_halo = dart_storage<Element_t>(haloblock.halo_size());
+    dart_team_memregister(team, ds_halo.nelem, ds_halo.dtype,
+                          halomemory.data(), &_halo_gptr);
+    dart_team_memalloc_aligned(team, NumSignals, DART_TYPE_LONGLONG,
+                               &_signal_gptr);
+
+    int64_t* signals = nullptr;
+    dart_gptr_getaddr(signal_gptr(_myid, 0),
+                      reinterpret_cast<void**>(&signals));
+    std::fill(signals, signals + NumSignals, 0);
+    for(const auto& region : haloblock.halo_regions()) {
+      signals[HaloOffsets + region.index()] =
+        (halomemory.first_element_at(region.index()) - halomemory.begin())
+        * sizeof(Element_t);
+      if(region.size() == 0 || region.is_custom_region())
+        continue;
+
+      _ready_signals.insert(std::make_pair(
+        region.index(),
+        signal_gptr(region.begin().lpos().unit, ReadySignals + region.index())));
+    }
+    // counters and halo memory offsets have to be set at all units
+    dart_barrier(team);
+
+    for(region_index_t index = 0; index < MaxIndex; ++index) {
+      const auto& spec   = halo_spec.spec(index);
+      auto        extent = spec.extent();
+      if(extent == 0)
+        continue;
+
+      // local boundary elements for the halo region 'index' of the receiver
+      ElementCoords_t box_offsets{};
+      Extents_t       box_extents{};
+      ElementCoords_t coords{};
+      bool            has_receiver = true;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        auto view_offset = static_cast<pattern_index_t>(view.offset(d));
+        auto view_extent = static_cast<pattern_index_t>(view.extent(d));
+        auto pat_extent  = static_cast<pattern_index_t>(pattern.extent(d));
+        if(spec[d] == 1) {
+          box_extents[d] = view_extent;
+          coords[d]      = view_offset;
+          continue;
+        }
+
+        DASH_ASSERT_MSG(extent <= view_extent,
+                        "Halo region extent exceeds local block extent");
+        box_extents[d] = extent;
+        if(spec[d] == 0) {
+          box_offsets[d] = view_extent - extent;
+          coords[d]      = view_offset + view_extent;
+        } else {
+          coords[d] = view_offset - 1;
+        }
+
+        if(coords[d] < 0 || coords[d] >= pat_extent) {
+          if(bound_spec[d] != BoundaryProp::CYCLIC) {
+            has_receiver = false;
+            break;
+          }
+          coords[d] = (coords[d] + pat_extent) % pat_extent;
+        }
+      }
+
+      pattern_size_t box_size = 1;
+      for(const auto& box_extent : box_extents)
+        box_size *= box_extent;
+      if(!has_receiver || box_size == 0)
+        continue;
+
+      auto    receiver   = pattern.unit_at(coords);
+      int64_t dst_offset = 0;
+      dart_get_blocking(&dst_offset, signal_gptr(receiver, HaloOffsets + index),
+                        1, DART_TYPE_LONGLONG, DART_TYPE_LONGLONG);
+
+      auto dst = _halo_gptr;
+      dart_gptr_setunit(&dst, receiver);
+      dart_gptr_incaddr(&dst, dst_offset);
+
+      PushData data{ index,   dst,     signal_gptr(receiver, index),
+                     nullptr, 0,       DART_TYPE_UNDEFINED,
+                     DART_TYPE_UNDEFINED };
+      set_push_types(haloblock, box_offsets, box_extents, data);
+      _push_data.push_back(data);
+    }
+  }
+
+  /**
+   * Sets the source pointer and the DART types of a put transferring the
+   * given box of the local block.
+   */
+  void set_push_types(const HaloBlockT& haloblock,
+                      const ElementCoords_t& box_offsets,
+                      const Extents_t& box_extents, PushData& data) {
+    const auto& view = haloblock.view();
+    // dimension with contiguous elements in local memory
+    const dim_t fast_dim = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+    std::vector<size_t> block_offsets;
+    std::vector<size_t> block_sizes;
+    pattern_size_t      box_size = 1;
+    for(const auto& box_extent : box_extents)
+      box_size *= box_extent;
+
+    ElementCoords_t coords = box_offsets;
+    for(pattern_size_t i = 0; i < box_size; i += box_extents[fast_dim]) {
+      pattern_size_t offset = 0;
+      if(MemoryArrange == ROW_MAJOR) {
+        for(dim_t d = 0; d < NumDimensions; ++d)
+          offset = offset * view.extent(d) + coords[d];
+      } else {
+        for(dim_t d = NumDimensions; d > 0;) {
+          --d;
+          offset = offset * view.extent(d) + coords[d];
+        }
+      }
+      // merge blocks that are adjacent in local memory
+      if(!block_offsets.empty()
+         && block_offsets.back() + block_sizes.back() == offset) {
+        block_sizes.back() += box_extents[fast_dim];
+      } else {
+        block_offsets.push_back(offset);
+        block_sizes.push_back(box_extents[fast_dim]);
+      }
+
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        dim_t dim = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - d : d;
+        if(dim == fast_dim)
+          continue;
+        if(++coords[dim] < static_cast<pattern_index_t>(box_offsets[dim]
+                                                        + box_extents[dim]))
+          break;
+        coords[dim] = box_offsets[dim];
+      }
+    }
+
+    auto ds_box  = dart_storage<Element_t>(box_size);
+    data.src     = haloblock.globmem().lbegin() + block_offsets.front();
+    data.nelem   = ds_box.nelem;
+    data.dst_type = ds_box.dtype;
+
+    auto first_offset = block_offsets.front();
+    for(auto& block_offset : block_offsets)
+      block_offset = dart_storage<Element_t>(block_offset - first_offset).nelem;
+    for(auto& block_size : block_sizes)
+      block_size = dart_storage<Element_t>(block_size).nelem;
+
+    if(block_offsets.size() == 1) {
+      data.src_type = ds_box.dtype;
+      return;
+    }
+
+    bool strided = true;
+    for(size_t i = 1; i < block_offsets.size(); ++i) {
+      if(block_sizes[i] != block_sizes[0]
+         || block_offsets[i] - block_offsets[i - 1] != block_offsets[1]) {
+        strided = false;
+        break;
+      }
+    }
+
+    if(strided) {
+      dart_type_create_strided(ds_box.dtype, block_offsets[1], block_sizes[0],
+                               &data.src_type);
+    } else {
+      dart_type_create_indexed(ds_box.dtype, block_offsets.size(),
+                               block_sizes.data(), block_offsets.data(),
+                               &data.src_type);
+    }
+    _dart_types.push_back(data.src_type);
+  }
+
+  /**
+   * Releases the own halo memory for the next update and puts the local
+   * boundary elements to the neighbours as soon as they released their
+   * halo memory.
+   */
+  void push_halos() {
+    ++_epoch;
+
+    const int64_t one = 1;
+    for(const auto& ready : _ready_signals) {
+      dart_accumulate(ready.second, &one, 1, DART_TYPE_LONGLONG, DART_OP_SUM);
+    }
+    if(!_ready_signals.empty())
+      dart_flush_all(_signal_gptr);
+
+    for(const auto& data : _push_data) {
+      dart_notify_wait(signal_gptr(_myid, ReadySignals + data.index), _epoch);
+      dart_put_notify(data.dst, data.src, data.nelem, data.src_type,
+                      data.dst_type, data.notify, 1, DART_OP_SUM);
+    }
+  }
+
+private:
+  HaloUpdateMode                      _mode;
+  std::map<region_index_t, Data>      _region_data;
+  std::vector<dart_datatype_t>        _dart_types;
+  team_unit_t                         _myid{ 0 };
+  dart_gptr_t                         _halo_gptr   = DART_GPTR_NULL;
+  dart_gptr_t                         _signal_gptr = DART_GPTR_NULL;
+  /// number of initiated updates
+  int64_t                             _epoch = 0;
+  std::vector<PushData>               _push_data;
+  /// ready counters at the neighbours for all halo regions filled by them
+  std::map<region_index_t, dart_gptr_t> _ready_signals;
+};  // class HaloUpdateEnv
+
 }  // namespace halo
 
 }  // namespace dash
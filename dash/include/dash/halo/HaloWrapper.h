@@ -0,0 +1,347 @@
+#ifndef DASH__HALO_HALOWRAPPER_H
+#define DASH__HALO_HALOWRAPPER_H
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Pattern.h>
+#include <dash/halo/StencilOperator.h>
+#include <dash/memory/GlobStaticMem.h>
+
+#include <type_traits>
+#include <vector>
+
+namespace dash {
+
+namespace halo {
+
+/**
+ * As known from classic stencil algorithms, *boundaries* are the outermost
+ * elements within a block that are requested by neighoring units.
+ * *Halos* represent additional outer regions of a block that contain ghost
+ * cells with values copied from adjacent units' boundary regions.
+ *
+ * The \c HaloWrapper acts as a wrapper of the local block of a container and
+ * extends it by boundary and halo regions. The HaloWrapper also provides a
+ * function to create a \ref StencilOperator.
+ *
+ * Any container with a blocked pattern, i.e. one block per unit in every
+ * dimension, can be wrapped, e.g. \c dash::Array with a \c BlockPattern<1>
+ * or \c dash::NArray (\ref HaloMatrixWrapper).
+ *
+ * Example for an outer block boundary iteration space (halo regions):
+ *
+ *            .--halo region 0   .-- halo region 1
+ *           /                  /
+ *       .-------..-------------------------. -.
+ *       |  0  1 ||  0  1  2  3  4  5  6  7 |  |
+ *       |  2  3 ||  8  9 10 11 12 13 14 15 |  |-- halo width in dimension 0
+ *       '-------''-------------------------' -'
+ *       .-------..-------------------------..-------.
+ *       |  0  1 ||                         ||  0  1 |
+ *       :  ...  ::       local block       ::  ...  : --- halo region 5
+ *       |  6  7 ||                         ||  6  7 |
+ *       '-------''-------------------------''-------'
+ *           :    .-------------------------.:       :
+ *           |    |  0  1  2  3  4  5  6  7 |'---.---'
+ *           |    |  8  9 10 11 12 13 14 15 |    :
+ *           |    `-------------------------'    '- halo width in dimension 1
+ *           '                  \
+ *     halo region 3             '- halo region 7
+ */
+
+template <typename ContainerT>
+class HaloWrapper {
+private:
+  using Pattern_t       = typename ContainerT::pattern_type;
+  using pattern_index_t = typename Pattern_t::index_type;
+
+  static constexpr auto NumDimensions = Pattern_t::ndim();
+
+public:
+  using Element_t = typename ContainerT::value_type;
+
+  using ViewSpec_t      = ViewSpec<NumDimensions, pattern_index_t>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<NumDimensions>;
+  using HaloBlock_t     = HaloBlock<Element_t, Pattern_t>;
+  using HaloMemory_t    = HaloMemory<HaloBlock_t>;
+  using HaloUpdateEnv_t = HaloUpdateEnv<HaloBlock_t>;
+  using HaloSpec_t      = HaloSpec<NumDimensions>;
+  using ElementCoords_t = std::array<pattern_index_t, NumDimensions>;
+  using region_index_t  = typename RegionCoords<NumDimensions>::region_index_t;
+
+private:
+  static constexpr auto MemoryArrange = Pattern_t::memory_order();
+
+  using pattern_size_t        = typename Pattern_t::size_type;
+  using signed_pattern_size_t = typename std::make_signed<pattern_size_t>::type;
+  using Region_t              = Region<Element_t, Pattern_t>;
+
+public:
+  /**
+   * Constructor that takes a container, a \ref GlobalBoundarySpec and a user
+   * defined number of stencil specifications (\ref StencilSpec)
+   * or a single \ref HaloSpec, e.g. one created by
+   * \ref HaloSpec::multi_step for \ref StencilOperator::apply_steps.
+   */
+  template <typename... StencilSpecT>
+  HaloWrapper(ContainerT& container, const GlobBoundSpec_t& cycle_spec,
+              const StencilSpecT&... stencil_spec)
+  : HaloWrapper(container, HaloUpdateMode::PULL, cycle_spec,
+                stencil_spec...) {}
+
+  /**
+   * Constructor that additionally takes the \ref HaloUpdateMode.
+   *
+   * With \ref HaloUpdateMode::PUSH every unit puts its boundary elements to
+   * the neighbours and the updates are synchronized point-to-point, so no
+   * barrier is needed between modifying the container and updating the
+   * halos.
+   */
+  template <typename... StencilSpecT>
+  HaloWrapper(ContainerT& container, HaloUpdateMode mode,
+              const GlobBoundSpec_t& cycle_spec,
+              const StencilSpecT&... stencil_spec)
+  : _container(container), _cycle_spec(cycle_spec),
+    _halo_spec(stencil_spec...), _view_global(local_view(container.pattern())),
+    _haloblock(container.begin().globmem(), container.pattern(), _view_global,
+               _halo_spec, cycle_spec),
+    _view_local(_haloblock.view_local()), _halomemory(_haloblock),
+    _update_env(_haloblock, _halomemory, mode) {}
+
+  /**
+   * Constructor that takes a container and a user
+   * defined number of stencil specifications (\ref StencilSpec).
+   * The \ref GlobalBoundarySpec is set to default.
+   */
+  template <typename... StencilSpecT>
+  HaloWrapper(ContainerT& container, const StencilSpecT&... stencil_spec)
+  : HaloWrapper(container, GlobBoundSpec_t(), stencil_spec...) {}
+
+  HaloWrapper() = delete;
+
+  /**
+   * Returns the used \ref HaloSpec
+   */
+  const HaloSpec_t& halo_spec() const { return _halo_spec; }
+
+  /**
+   * Returns the underlying \ref HaloBlock
+   */
+  const HaloBlock_t& halo_block() { return _haloblock; }
+
+  /**
+   * Initiates a blocking halo region update for all halo elements.
+   */
+  void update() { _update_env.update(); }
+
+  /**
+   * Initiates a blocking halo region update for all halo elements within the
+   * the given region.
+   */
+  void update_at(region_index_t index) { _update_env.update_at(index); }
+
+  /**
+   * Initiates an asychronous halo region update for all halo elements.
+   */
+  void update_async() { _update_env.update_async(); }
+
+  /**
+   * Initiates an asychronous halo region update for all halo elements within
+   * the given region.
+   */
+  void update_async_at(region_index_t index) {
+    _update_env.update_async_at(index);
+  }
+
+  /**
+   * Waits until all halo updates are finished. Only useful for asynchronous
+   * halo updates.
+   */
+  void wait() { _update_env.wait(); }
+
+  /**
+   * Waits until the halo updates for the given halo region is finished.
+   * Only useful for asynchronous halo updates.
+   */
+  void wait(region_index_t index) { _update_env.wait(index); }
+
+  /**
+   * Returns the halo update management object \ref HaloUpdateEnv
+   */
+  HaloUpdateEnv_t& update_env() { return _update_env; }
+
+  /**
+   * Returns the local \ref ViewSpec
+   *
+   */
+  const ViewSpec_t& view_local() const { return _view_local; }
+
+  /**
+   * Returns the halo memory management object \ref HaloMemory
+   */
+  HaloMemory_t& halo_memory() { return _halomemory; }
+
+  /**
+   * Returns the halo memory management object \ref HaloMemory
+   */
+  const HaloMemory_t& halo_memory() const { return _halomemory; }
+
+  /**
+   * Returns the underlying container
+   */
+  ContainerT& container() { return _container; }
+
+  /**
+   * Returns the underlying container
+   */
+  const ContainerT& container() const { return _container; }
+
+  /**
+   * Returns the underlying NArray, same as \ref container
+   */
+  ContainerT& matrix() { return _container; }
+
+  /**
+   * Returns the underlying NArray, same as \ref container
+   */
+  const ContainerT& matrix() const { return _container; }
+
+  /**
+   * Sets all global border halo elements. set_custom_halos calls FuntionT with
+   * all global coordinates of type:
+   * std::array<dash::default_index_t,Number Dimensions>.
+   *
+   * Every unit is called only with the related global coordinates.
+   * E.g.:
+   *
+   *     .............
+   *     : Border    | <- coordinates for example:
+   *     : Unit 0    |    (-1,-1),(0,-1), (-2,5)
+   *     :  .--------..--------.
+   *     :  |        ||        |
+   *     :  | Unit 0 || Unit 1 |
+   *     :  |        ||        |
+   *     '- :--------::--------:
+   *        |        ||        |
+   *        | Unit 2 || Unit 3 |
+   *        |        ||        |
+   *        '--------''--------'
+   *
+   */
+  template <typename FunctionT>
+  void set_custom_halos(FunctionT f) {
+    using signed_extent_t = typename std::make_signed<pattern_size_t>::type;
+    for(const auto& region : _haloblock.boundary_regions()) {
+      if(region.is_custom_region()) {
+        const auto& spec    = region.spec();
+        std::array<signed_extent_t, NumDimensions> coords_offset{};
+        const auto& reg_ext = region.view().extents();
+        for(auto d = 0; d < NumDimensions; ++d) {
+          if(spec[d] == 0) {
+            coords_offset[d] -= reg_ext[d];
+            continue;
+          }
+          if(spec[d] == 2)
+            coords_offset[d] = reg_ext[d];
+        }
+
+        auto range_mem = _halomemory.range_at(region.index());
+        auto it_mem = range_mem.first;
+        auto it_reg_end  = region.end();
+        DASH_ASSERT_MSG(
+            std::distance(range_mem.first, range_mem.second) == region.size(),
+            "Range distance of the HaloMemory is unequal region size");
+
+        for(auto it = region.begin(); it != it_reg_end; ++it, ++it_mem) {
+          auto coords = it.gcoords();
+          for(auto d = 0; d < NumDimensions; ++d) {
+            coords[d] += coords_offset[d];
+          }
+
+          *it_mem = f(coords);
+        }
+      }
+    }
+  }
+
+  /**
+   * Returns the halo value for a given global coordinate or nullptr if no halo
+   * element exists. This also means that only a unit connected to the given
+   * coordinate will return a halo value. All others will return nullptr.
+   */
+  Element_t* halo_element_at_global(ElementCoords_t coords) {
+    const auto& offsets = _view_global.offsets();
+    for(auto d = 0; d < NumDimensions; ++d) {
+      coords[d] -= offsets[d];
+    }
+
+    return halo_element_at(coords);
+  }
+
+  /**
+   * Returns the halo value for a given local coordinate or nullptr if no halo
+   * element exists.
+   */
+  Element_t* halo_element_at_local(ElementCoords_t coords) {
+    return halo_element_at(coords);
+  }
+
+  /**
+   * Crates \ref StencilOperator for a given \ref StencilSpec.
+   * Asserts whether the StencilSpec fits in the provided halo regions.
+   */
+  template <typename StencilSpecT>
+  StencilOperator<Element_t, Pattern_t, StencilSpecT> stencil_operator(
+    const StencilSpecT& stencil_spec) {
+    for(const auto& stencil : stencil_spec.specs()) {
+      DASH_ASSERT_MSG(
+        stencil.max()
+          <= _halo_spec.extent(RegionSpec<NumDimensions>::index(stencil)),
+        "Stencil point extent higher than halo region extent.");
+    }
+
+    return StencilOperator<Element_t, Pattern_t, StencilSpecT>(
+      &_haloblock, &_halomemory, &_update_env, stencil_spec, &_view_local);
+  }
+
+private:
+  /**
+   * Global view of the local block, the pattern has to assign a single
+   * block per dimension to every unit.
+   */
+  static ViewSpec_t local_view(const Pattern_t& pattern) {
+    ElementCoords_t local_begin_coords{};
+
+    return ViewSpec_t(pattern.global(local_begin_coords),
+                      pattern.local_extents());
+  }
+
+  Element_t* halo_element_at(ElementCoords_t& coords) {
+    auto        index     = _haloblock.index_at(_view_local, coords);
+    const auto& spec      = _halo_spec.spec(index);
+    auto        range_mem = _halomemory.range_at(index);
+    if(spec.level() == 0 || range_mem.first == range_mem.second)
+      return nullptr;
+
+    if(!_halomemory.to_halo_mem_coords_check(index, coords))
+      return nullptr;
+
+    return &*(range_mem.first + _halomemory.offset(index, coords));
+  }
+
+private:
+  ContainerT&                    _container;
+  const GlobBoundSpec_t          _cycle_spec;
+  const HaloSpec_t               _halo_spec;
+  const ViewSpec_t               _view_global;
+  const HaloBlock_t              _haloblock;
+  const ViewSpec_t&              _view_local;
+  HaloMemory_t                   _halomemory;
+  HaloUpdateEnv_t                _update_env;
+};
+
+}  // namespace halo
+
+}  // namespace dash
+
+#endif  // DASH__HALO_HALOWRAPPER_H
@@ -139,14 +139,14 @@ public:
    * views.
    */
   const BoundaryViews_t& view() const {
-    return _stencil_op->spec_views.boundary_views();
+    return _stencil_op->_spec_views.boundary_views();
   }
 
   /**
    * Returns the number of all boundary elements (no dublicates)
    */
   pattern_size_t boundary_size() const {
-    return _stencil_op->spec_views.boundary_size();
+    return _stencil_op->_spec_views.boundary_size();
   }
 
   /**
@@ -202,22 +202,68 @@ public:
     DASH_ASSERT_LT(dim, NumDimensions, "Given dimension to great");
     const auto&    bnd_views = _stencil_op->_spec_views.boundary_views();
     pattern_size_t offset    = 0;
-    auto           it_views  = std::begin(bnd_views);
-    for(dim_t d = 0; d < dim; ++d, ++it_views)
-      offset += it_views->size() + (++it_views)->size();
+    auto           view_idx  = dim * 2;
+    if(pos == RegionPos::POST)
+      ++view_idx;
+    for(auto i = 0; i < view_idx; ++i)
+      offset += bnd_views[i].size();
+
+    return std::make_pair(
+      _stencil_op->bnd_iterator_at(offset),
+      _stencil_op->bnd_iterator_at(offset + bnd_views[view_idx].size()));
+  }
 
-    if(pos == RegionPos::POST) {
-      offset += it_views->size();
-      ++it_views;
-    }
+private:
+  const StencilOperator_t* _stencil_op;
+};
+
+/**
+ * Element access via stencil points within the local buffers used by
+ * \ref StencilOperator::apply_steps. Offers the same element access as
+ * \ref StencilIterator, so a kernel can be used for both.
+ */
+template <typename ElementT, typename StencilSpecT, typename StencilOffsetsT>
+class StencilBufferAccess {
+public:
+  using StencilP_t      = typename StencilSpecT::StencilPoint_t;
+  using stencil_index_t = typename StencilSpecT::stencil_index_t;
+
+public:
+  StencilBufferAccess(const ElementT* center, const StencilSpecT* stencil_spec,
+                      const StencilOffsetsT* stencil_offsets)
+  : _center(center), _stencil_spec(stencil_spec),
+    _stencil_offsets(stencil_offsets) {}
+
+  /**
+   * Returns the center value
+   */
+  const ElementT& operator*() const { return *_center; }
+
+  /**
+   * Returns the value for a given stencil point index (index postion in
+   * \ref StencilSpec)
+   */
+  ElementT value_at(const stencil_index_t index_stencil) const {
+    return _center[(*_stencil_offsets)[index_stencil]];
+  }
+
+  /**
+   * Returns the value of a given stencil point (not as efficient as
+   * stencil point index)
+   */
+  ElementT value_at(const StencilP_t& stencil) const {
+    auto index_stencil = _stencil_spec->index(stencil);
 
-    auto it_begin = _stencil_op->_bbegin + offset;
+    DASH_ASSERT_MSG(index_stencil.second,
+                    "No valid region index for given stencil point found");
 
-    return std::make_pair(it_begin, it_begin + it_views->size());
+    return value_at(index_stencil.first);
   }
 
 private:
-  const StencilOperator_t* _stencil_op;
+  const ElementT*        _center;
+  const StencilSpecT*    _stencil_spec;
+  const StencilOffsetsT* _stencil_offsets;
 };
 
 /**
@@ -262,6 +308,9 @@ private:
   using pattern_size_t        = typename PatternT::size_type;
   using signed_pattern_size_t = typename std::make_signed<pattern_size_t>::type;
   using pattern_index_t       = typename PatternT::index_type;
+  using RegionCoords_t        = RegionCoords<NumDimensions>;
+
+  static constexpr auto NumBoundaryViews = NumDimensions * 2;
 
   template <typename _T, typename _P, typename _S>
   friend class StencilOperatorInner;
@@ -284,8 +333,14 @@ public:
   using const_iterator_bnd   = const iterator;
 
   using StencilOffsets_t = typename iterator::StencilOffsets_t;
+  using line_inner = StencilLine<ElementT, StencilSpecT, StencilOffsets_t,
+                                 StencilViewScope::INNER>;
+  using line_bnd   = StencilLine<ElementT, StencilSpecT, StencilOffsets_t,
+                               StencilViewScope::BOUNDARY>;
+
   using HaloBlock_t      = HaloBlock<ElementT, PatternT>;
   using HaloMemory_t     = HaloMemory<HaloBlock_t>;
+  using HaloUpdateEnv_t  = HaloUpdateEnv<HaloBlock_t>;
   using ViewSpec_t       = ViewSpec<NumDimensions, pattern_index_t>;
   using ElementCoords_t  = std::array<pattern_index_t, NumDimensions>;
 
@@ -293,19 +348,29 @@ public:
 
   using region_index_t = typename RegionSpec<NumDimensions>::region_index_t;
 
+private:
+  using BoundaryDeps_t =
+    std::array<std::vector<region_index_t>, NumBoundaryViews>;
+  using Extents_t       = std::array<pattern_size_t, NumDimensions>;
+  using SignedCoords_t  = std::array<signed_pattern_size_t, NumDimensions>;
+  using BufferAccess_t =
+    StencilBufferAccess<ElementT, StencilSpecT, StencilOffsets_t>;
+
 public:
   /**
    * Constructor that takes a \ref HaloBlock, a \ref HaloMemory,
-   * a \ref StencilSpec and a local \ref ViewSpec
+   * a \ref HaloUpdateEnv, a \ref StencilSpec and a local \ref ViewSpec
    */
   StencilOperator(const HaloBlock_t* haloblock, HaloMemory_t* halomemory,
-                  const StencilSpecT& stencil_spec,
-                  const ViewSpec_t*   view_local)
+                  HaloUpdateEnv_t* update_env, const StencilSpecT& stencil_spec,
+                  const ViewSpec_t* view_local)
   : inner(this), boundary(this), _halo_block(haloblock),
-    _halo_memory(halomemory), _stencil_spec(stencil_spec),
-    _view_local(view_local), _stencil_offsets(set_stencil_offsets()),
+    _halo_memory(halomemory), _update_env(update_env),
+    _stencil_spec(stencil_spec), _view_local(view_local),
+    _stencil_offsets(set_stencil_offsets(_view_local->extents())),
     _local_memory(const_cast<ElementT*>(_halo_block->globmem().lbegin())),
     _spec_views(*_halo_block, _stencil_spec, _view_local),
+    _bnd_deps(set_boundary_dependencies()),
     _begin(_local_memory, _halo_memory, &_stencil_spec, &_stencil_offsets,
            *_view_local, _spec_views.inner_with_boundaries(), 0),
     _end(_local_memory, _halo_memory, &_stencil_spec, &_stencil_offsets,
@@ -368,6 +433,195 @@ public:
    */
   const ViewSpec_t& view() const { return _spec_views.inner_with_boundaries(); }
 
+  /**
+   * Applies the given kernel to all inner and boundary elements and overlaps
+   * the halo exchange with the computation.
+   *
+   * An asynchronous halo update is started first and the inner elements are
+   * computed while the halo regions are in flight. Afterwards every boundary
+   * slice (see \ref StencilOperatorBoundary::iterator_at) is computed as
+   * soon as all halo regions its stencil points reach into have arrived.
+   * Slices whose halos are still pending are skipped until no other slice
+   * is ready.
+   *
+   * \param kernel callable taking a stencil iterator (e.g. a generic lambda
+   *               \c [](auto& it) ) and returning the new center value
+   * \param out    local memory with the same layout as the local block,
+   *               \c out[it.lpos()] is set to the result of the kernel
+   */
+  template <typename KernelT>
+  void apply(KernelT kernel, ElementT* out) {
+    _update_env->update_async();
+
+    for(auto it = _ibegin; it != _iend; ++it)
+      out[it.lpos()] = kernel(it);
+
+    for_each_ready_boundary_view(
+      [&](const ViewSpec_t& view, pattern_size_t offset) {
+        auto it_end = bnd_iterator_at(offset + view.size());
+        for(auto it = bnd_iterator_at(offset); it != it_end; ++it)
+          out[it.lpos()] = kernel(it);
+      });
+  }
+
+  /**
+   * Applies the given line kernel to all inner and boundary elements and
+   * overlaps the halo exchange with the computation like \ref apply.
+   *
+   * Instead of single elements the kernel gets a \ref StencilLine of
+   * contiguous center elements along the fastest dimension with a
+   * contiguous span for every stencil point, so the loop over the line can
+   * be vectorized. Lines of inner elements (\c line_inner) access the local
+   * memory with fixed stencil offsets only. For lines of boundary elements
+   * (\c line_bnd) spans reaching into halo regions are gathered into a
+   * buffer first.
+   *
+   * \param kernel callable taking a line (e.g. a generic lambda
+   *               \c [](const auto& line, ElementT* out) ) and a pointer to
+   *               the output of the first center element, has to set
+   *               \c out[0] to \c out[line.size() - 1]
+   * \param out    local memory with the same layout as the local block
+   */
+  template <typename KernelT>
+  void apply_lines(KernelT kernel, ElementT* out) {
+    _update_env->update_async();
+
+    for_each_line_in_view(
+      _spec_views.inner(),
+      [&](pattern_size_t offset, const SignedCoords_t&, pattern_size_t size) {
+        line_inner line(_local_memory + offset, &_stencil_offsets, size,
+                        offset);
+        kernel(line, out + offset);
+      });
+
+    for_each_ready_boundary_view(
+      [&](const ViewSpec_t& view, pattern_size_t) {
+        for_each_line_in_view(
+          view, [&](pattern_size_t offset, const SignedCoords_t& coords,
+                    pattern_size_t size) {
+            line_bnd line(_local_memory + offset, gather_line(offset, coords, size),
+                          size, offset);
+            kernel(line, out + offset);
+          });
+      });
+  }
+
+  /**
+   * Applies the given kernel \c num_steps times with a single halo update
+   * (temporal blocking). The halos have to be wide enough for all steps,
+   * e.g. by creating the \ref HaloMatrixWrapper with a \ref HaloSpec
+   * returned by \ref HaloSpec::multi_step.
+   *
+   * After the halo update the local block and its halos are copied into
+   * local buffers. Every step computes the elements whose stencil points
+   * were valid in the previous step, so the computed region shrinks by the
+   * stencil extent per step until only the local block is left. Elements
+   * in exchanged halos are computed redundantly in exchange for fewer halo
+   * updates. Global boundary halos with \ref BoundaryProp::CUSTOM stay
+   * constant and elements next to a \ref BoundaryProp::NONE boundary keep
+   * their value, as for \c num_steps calls of \ref apply.
+   *
+   * \param kernel    callable taking an element accessor with the interface
+   *                  of a stencil iterator (\c operator* and \c value_at),
+   *                  e.g. a generic lambda \c [](const auto& it)
+   * \param num_steps number of stencil sweeps
+   * \param out       local memory with the same layout as the local block,
+   *                  receives the results of the last step
+   */
+  template <typename KernelT>
+  void apply_steps(KernelT kernel, pattern_size_t num_steps, ElementT* out) {
+    const signed_pattern_size_t steps = num_steps;
+    const auto minmax_dist            = _stencil_spec.minmax_distances();
+
+    // halo width, stencil reach and computed range for the last step per
+    // dimension and side; a reach of 0 marks sides which never shrink
+    SignedCoords_t width_pre{}, width_post{}, reach_pre{}, reach_post{};
+    SignedCoords_t first{}, last{};
+    Extents_t      buf_ext{};
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      signed_pattern_size_t ext = _view_local->extent(d);
+      const auto* region_pre =
+        _halo_block->halo_region(RegionCoords_t::index(d, RegionPos::PRE));
+      const auto* region_post =
+        _halo_block->halo_region(RegionCoords_t::index(d, RegionPos::POST));
+      width_pre[d]  = region_pre != nullptr ? region_pre->view().extent(d) : 0;
+      width_post[d] = region_post != nullptr ? region_post->view().extent(d) : 0;
+      buf_ext[d]    = width_pre[d] + ext + width_post[d];
+      first[d]      = 0;
+      last[d]       = ext;
+
+      auto dist_pre  = -minmax_dist[d].first;
+      auto dist_post = minmax_dist[d].second;
+      if(width_pre[d] == 0)
+        first[d] = dist_pre;
+      else if(!region_pre->is_custom_region())
+        reach_pre[d] = dist_pre;
+      if(width_post[d] == 0)
+        last[d] = ext - dist_post;
+      else if(!region_post->is_custom_region())
+        reach_post[d] = dist_post;
+
+      DASH_ASSERT_MSG(width_pre[d] >= steps * reach_pre[d]
+                        && width_post[d] >= steps * reach_post[d],
+                      "Halo extent too small for the given number of steps");
+    }
+
+    _update_env->update();
+
+    auto& buf_src = _step_buffers[0];
+    auto& buf_dst = _step_buffers[1];
+    buf_src.resize(extents_size(buf_ext));
+
+    // copy local block and halo elements into the buffer
+    SignedCoords_t buf_first{};
+    SignedCoords_t buf_last;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      buf_last[d] = buf_ext[d];
+    for_each_in_box(buf_first, buf_last, buf_ext,
+                    [&](pattern_size_t offset, const SignedCoords_t& coords) {
+      ElementCoords_t coords_local;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        coords_local[d] = coords[d] - width_pre[d];
+
+      const auto* element = element_at(coords_local);
+      if(element != nullptr)
+        buf_src[offset] = *element;
+    });
+    buf_dst = buf_src;
+
+    const auto buf_stencil_offsets = set_stencil_offsets(buf_ext);
+    for(signed_pattern_size_t step = 1; step <= steps; ++step) {
+      SignedCoords_t step_first, step_last;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        step_first[d] = width_pre[d] + first[d] - (steps - step) * reach_pre[d];
+        step_last[d]  = width_pre[d] + last[d] + (steps - step) * reach_post[d];
+      }
+      const auto* src = buf_src.data();
+      auto*       dst = buf_dst.data();
+      for_each_in_box(step_first, step_last, buf_ext,
+                      [&](pattern_size_t offset, const SignedCoords_t&) {
+        BufferAccess_t access(src + offset, &_stencil_spec,
+                              &buf_stencil_offsets);
+        dst[offset] = kernel(access);
+      });
+      std::swap(buf_src, buf_dst);
+    }
+
+    // the buffers were swapped after the last step
+    SignedCoords_t out_first, out_last;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      out_first[d] = width_pre[d] + first[d];
+      out_last[d]  = width_pre[d] + last[d];
+    }
+    for_each_in_box(out_first, out_last, buf_ext,
+                    [&](pattern_size_t offset, const SignedCoords_t& coords) {
+      ElementCoords_t coords_local;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        coords_local[d] = coords[d] - width_pre[d];
+      out[get_offset(coords_local)] = buf_src[offset];
+    });
+  }
+
   /*
   ElementT get_value_at_inner_local(
     const ElementCoords_t& coords, ElementT coefficient_center,
@@ -418,19 +672,19 @@ public:
   */
 
 private:
-  StencilOffsets_t set_stencil_offsets() {
+  StencilOffsets_t set_stencil_offsets(const Extents_t& extents) const {
     StencilOffsets_t stencil_offs;
     for(auto i = 0; i < NumStencilPoints; ++i) {
       signed_pattern_size_t offset = 0;
       if(MemoryArrange == ROW_MAJOR) {
         offset = _stencil_spec[i][0];
         for(auto d = 1; d < NumDimensions; ++d)
-          offset = _stencil_spec[i][d] + offset * _view_local->extent(d);
+          offset = _stencil_spec[i][d] + offset * extents[d];
       } else {
         offset = _stencil_spec[i][NumDimensions - 1];
         for(auto d = NumDimensions - 1; d > 0;) {
           --d;
-          offset = _stencil_spec[i][d] + offset * _view_local->extent(d);
+          offset = _stencil_spec[i][d] + offset * extents[d];
         }
       }
       stencil_offs[i] = offset;
@@ -439,6 +693,264 @@ private:
     return stencil_offs;
   }
 
+  /*
+   * Returns for every boundary view the indices of all halo regions the
+   * stencil points of its elements access.
+   */
+  BoundaryDeps_t set_boundary_dependencies() const {
+    BoundaryDeps_t deps;
+    const auto&    bnd_views = _spec_views.boundary_views();
+    for(auto i = 0; i < bnd_views.size(); ++i) {
+      const auto& view = bnd_views[i];
+      if(view.size() == 0)
+        continue;
+
+      std::array<bool, RegionCoords_t::MaxIndex> used{};
+      for(auto p = 0; p < NumStencilPoints; ++p) {
+        // possible region coordinates per dimension: 0, 1 and 2
+        std::array<std::array<bool, 3>, NumDimensions> coords_dim{};
+        for(auto d = 0; d < NumDimensions; ++d) {
+          signed_pattern_size_t first = view.offset(d) + _stencil_spec[p][d];
+          signed_pattern_size_t last  = first + view.extent(d) - 1;
+          signed_pattern_size_t ext   = _view_local->extent(d);
+          coords_dim[d][0] = first < 0;
+          coords_dim[d][1] = last >= 0 && first < ext;
+          coords_dim[d][2] = last >= ext;
+        }
+        for(region_index_t index = 0; index < RegionCoords_t::MaxIndex;
+            ++index) {
+          auto coords = RegionCoords_t::coords(index);
+          bool hit    = true;
+          for(auto d = 0; d < NumDimensions; ++d)
+            hit = hit && coords_dim[d][coords[d]];
+          if(hit)
+            used[index] = true;
+        }
+      }
+      // the center is the local block itself
+      used[RegionCoords_t().index()] = false;
+      for(region_index_t index = 0; index < RegionCoords_t::MaxIndex; ++index)
+        if(used[index])
+          deps[i].push_back(index);
+    }
+
+    return deps;
+  }
+
+  /*
+   * Calls f with every boundary view and the offset of its first element
+   * within the boundary iteration space, as soon as all halo regions the
+   * view depends on have arrived. Views whose halos are still pending are
+   * skipped until no other view is ready.
+   */
+  template <typename FunctionT>
+  void for_each_ready_boundary_view(FunctionT f) {
+    const auto& bnd_views = _spec_views.boundary_views();
+    std::array<bool, NumBoundaryViews> done{};
+    auto                               num_open = bnd_views.size();
+    while(num_open > 0) {
+      bool           progress    = false;
+      bool           pending_set = false;
+      region_index_t pending     = 0;
+      pattern_size_t offset      = 0;
+      for(auto i = 0; i < bnd_views.size(); ++i) {
+        auto view_size = bnd_views[i].size();
+        if(!done[i]) {
+          bool ready = true;
+          for(auto index : _bnd_deps[i]) {
+            if(!_update_env->test(index)) {
+              ready = false;
+              if(!pending_set) {
+                pending     = index;
+                pending_set = true;
+              }
+              break;
+            }
+          }
+          if(ready) {
+            f(bnd_views[i], offset);
+
+            done[i]  = true;
+            progress = true;
+            --num_open;
+          }
+        }
+        offset += view_size;
+      }
+
+      if(!progress && pending_set)
+        _update_env->wait(pending);
+    }
+  }
+
+  /*
+   * Returns the spans of all stencil points for a line of boundary elements
+   * starting at the given local offset and coordinates. Spans within the local block
+   * point into the local memory, all others are gathered into the line
+   * buffer.
+   */
+  typename line_bnd::PointSpans_t gather_line(pattern_size_t        offset,
+                                              const SignedCoords_t& coords,
+                                              pattern_size_t        size) {
+    constexpr dim_t fastest =
+      MemoryArrange == ROW_MAJOR ? NumDimensions - 1 : 0;
+
+    _line_buffer.resize(NumStencilPoints * size);
+    typename line_bnd::PointSpans_t spans;
+    for(auto i = 0; i < NumStencilPoints; ++i) {
+      bool local = true;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        signed_pattern_size_t first = coords[d] + _stencil_spec[i][d];
+        signed_pattern_size_t last  = (d == fastest) ? first + size : first + 1;
+        if(first < 0
+           || last > static_cast<signed_pattern_size_t>(_view_local->extent(d)))
+          local = false;
+      }
+      if(local) {
+        spans[i] = _local_memory + offset + _stencil_offsets[i];
+        continue;
+      }
+
+      auto* span = _line_buffer.data() + i * size;
+      for(pattern_size_t pos = 0; pos < size; ++pos) {
+        ElementCoords_t coords_point;
+        for(dim_t d = 0; d < NumDimensions; ++d)
+          coords_point[d] = coords[d] + _stencil_spec[i][d];
+        coords_point[fastest] += pos;
+
+        const auto* element = element_at(coords_point);
+        DASH_ASSERT_MSG(element != nullptr,
+                        "No element for a stencil point of a boundary line");
+        span[pos] = *element;
+      }
+      spans[i] = span;
+    }
+
+    return spans;
+  }
+
+  /*
+   * Returns a pointer to the element at the given local coordinates, which
+   * may lie within a halo region, or nullptr if no such element exists.
+   */
+  const ElementT* element_at(ElementCoords_t coords) const {
+    bool local = true;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(coords[d] < 0
+         || coords[d] >= static_cast<signed_pattern_size_t>(
+                           _view_local->extent(d)))
+        local = false;
+    }
+    if(local)
+      return _local_memory + get_offset(coords);
+
+    auto  index  = _halo_block->index_at(*_view_local, coords);
+    auto* region = _halo_block->halo_region(index);
+    if(region == nullptr || region->size() == 0
+       || !_halo_memory->to_halo_mem_coords_check(index, coords))
+      return nullptr;
+
+    return &*(_halo_memory->first_element_at(index)
+              + _halo_memory->offset(index, coords));
+  }
+
+  /*
+   * Calls f with the local memory offset, the local coordinates and the
+   * length of every line of the given local view.
+   */
+  template <typename FunctionT>
+  void for_each_line_in_view(const ViewSpec_t& view, FunctionT f) const {
+    SignedCoords_t first, last;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      first[d] = view.offset(d);
+      last[d]  = view.offset(d) + view.extent(d);
+    }
+    for_each_line_in_box(first, last, _view_local->extents(), f);
+  }
+
+  /*
+   * Calls f with the buffer offset, the coordinates of the first element
+   * and the length of every line along the fastest dimension within
+   * [first, last) of a buffer with the given extents.
+   */
+  template <typename FunctionT>
+  static void for_each_line_in_box(const SignedCoords_t& first,
+                                   const SignedCoords_t& last,
+                                   const Extents_t& extents, FunctionT f) {
+    constexpr dim_t fastest =
+      MemoryArrange == ROW_MAJOR ? NumDimensions - 1 : 0;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(last[d] <= first[d])
+        return;
+    }
+
+    const pattern_size_t size = last[fastest] - first[fastest];
+    auto                 coords = first;
+    while(true) {
+      pattern_size_t offset = 0;
+      if(MemoryArrange == ROW_MAJOR) {
+        offset = coords[0];
+        for(dim_t d = 1; d < NumDimensions; ++d)
+          offset = offset * extents[d] + coords[d];
+      } else {
+        offset = coords[NumDimensions - 1];
+        for(dim_t d = NumDimensions - 1; d > 0;) {
+          --d;
+          offset = offset * extents[d] + coords[d];
+        }
+      }
+      f(offset, static_cast<const SignedCoords_t&>(coords), size);
+
+      bool finished = true;
+      for(dim_t i = 1; i < NumDimensions; ++i) {
+        dim_t d = MemoryArrange == ROW_MAJOR ? NumDimensions - 1 - i : i;
+        if(++coords[d] < last[d]) {
+          finished = false;
+          break;
+        }
+        coords[d] = first[d];
+      }
+      if(finished)
+        return;
+    }
+  }
+
+  /*
+   * Calls f with the buffer offset and the coordinates of every element
+   * within [first, last) of a buffer with the given extents. The fastest
+   * dimension is iterated in the innermost loop.
+   */
+  template <typename FunctionT>
+  static void for_each_in_box(const SignedCoords_t& first,
+                              const SignedCoords_t& last,
+                              const Extents_t& extents, FunctionT f) {
+    constexpr dim_t fastest =
+      MemoryArrange == ROW_MAJOR ? NumDimensions - 1 : 0;
+    for_each_line_in_box(
+      first, last, extents,
+      [&](pattern_size_t offset, const SignedCoords_t& line_coords,
+          pattern_size_t size) {
+        auto coords = line_coords;
+        for(pattern_size_t pos = 0; pos < size;
+            ++pos, ++coords[fastest], ++offset)
+          f(offset, static_cast<const SignedCoords_t&>(coords));
+      });
+  }
+
+  static pattern_size_t extents_size(const Extents_t& extents) {
+    pattern_size_t size = 1;
+    for(auto ext : extents)
+      size *= ext;
+
+    return size;
+  }
+
+  iterator_bnd bnd_iterator_at(pattern_index_t idx) const {
+    return iterator_bnd(_local_memory, _halo_memory, &_stencil_spec,
+                        &_stencil_offsets, *_view_local,
+                        _spec_views.boundary_views(), idx);
+  }
+
   pattern_index_t get_offset(const ElementCoords_t& coords) const {
     pattern_index_t offset = 0;
 
@@ -464,11 +976,16 @@ public:
 private:
   const HaloBlock_t* _halo_block;
   HaloMemory_t*      _halo_memory;
+  HaloUpdateEnv_t*   _update_env;
   const StencilSpecT _stencil_spec;
   const ViewSpec_t*  _view_local;
   StencilOffsets_t   _stencil_offsets;
   ElementT*          _local_memory;
   StencilSpecViews_t _spec_views;
+  BoundaryDeps_t     _bnd_deps;
+
+  std::array<std::vector<ElementT>, 2> _step_buffers;
+  std::vector<ElementT>                _line_buffer;
 
   iterator       _begin;
   iterator       _end;
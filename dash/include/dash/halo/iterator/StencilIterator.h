@@ -365,14 +365,14 @@ public:
    * Returns the value for a given stencil point index (index postion in
    * \ref StencilSpec)
    */
-  ElementT value_at(const region_index_t index_stencil) {
+  ElementT value_at(const region_index_t index_stencil) const {
     return *(_stencil_mem_ptr[index_stencil]);
   }
 
   /* returns the value of a given stencil point (not as efficient as
    * stencil point index )
    */
-  ElementT value_at(const StencilP_t& stencil) {
+  ElementT value_at(const StencilP_t& stencil) const {
     auto index_stencil = _stencil_spec->index(stencil);
 
     DASH_ASSERT_MSG(index_stencil.second,
@@ -738,6 +738,154 @@ private:
   ElementT*                                   _current_lmemory_addr;
 };  // class StencilIterator
 
+/**
+ * Contiguous line of center elements along the fastest dimension for
+ * row-wise stencil kernels, see \ref StencilOperator::apply_lines.
+ *
+ * For every stencil point the line provides a contiguous span of values:
+ * element \c j of \c data(i) is the value of stencil point \c i for the
+ * center element \c data()[j]. Kernels looping over these spans can be
+ * vectorized by the compiler.
+ *
+ * Lines of boundary elements hold a span per stencil point, which points
+ * either into the local memory or into a buffer with gathered halo values.
+ * Lines of inner elements are specialized for \ref StencilViewScope::INNER.
+ */
+template <typename ElementT, typename StencilSpecT, typename StencilOffsetsT,
+          StencilViewScope Scope>
+class StencilLine {
+private:
+  static constexpr auto NumStencilPoints = StencilSpecT::num_stencil_points();
+
+public:
+  using stencil_index_t = typename StencilSpecT::stencil_index_t;
+  using size_type       = std::size_t;
+  using PointSpans_t    = std::array<const ElementT*, NumStencilPoints>;
+
+public:
+  /**
+   * Constructor
+   *
+   * \param center pointer to the first center element in local memory
+   * \param points span of every stencil point
+   * \param size   number of center elements
+   * \param lpos   local offset of the first center element
+   */
+  StencilLine(const ElementT* center, const PointSpans_t& points,
+              size_type size, size_type lpos)
+  : _center(center), _points(points), _size(size), _lpos(lpos) {}
+
+  /**
+   * Number of center elements
+   */
+  size_type size() const { return _size; }
+
+  /**
+   * Local offset of the first center element
+   */
+  size_type lpos() const { return _lpos; }
+
+  /**
+   * Returns the span of the center elements
+   */
+  const ElementT* data() const { return _center; }
+
+  /**
+   * Returns the span of the given stencil point index (index position in
+   * \ref StencilSpec)
+   */
+  const ElementT* data(const stencil_index_t index_stencil) const {
+    return _points[index_stencil];
+  }
+
+  /**
+   * Returns the value of the given stencil point index for the center
+   * element at the given position
+   */
+  ElementT value_at(const stencil_index_t index_stencil, size_type pos) const {
+    return _points[index_stencil][pos];
+  }
+
+private:
+  const ElementT* _center;
+  PointSpans_t    _points;
+  size_type       _size;
+  size_type       _lpos;
+};  // class StencilLine
+
+/**
+ * Line of inner elements. All stencil points lie within the local memory,
+ * so every span is the center span shifted by a fixed offset.
+ */
+template <typename ElementT, typename StencilSpecT, typename StencilOffsetsT>
+class StencilLine<ElementT, StencilSpecT, StencilOffsetsT,
+                  StencilViewScope::INNER> {
+public:
+  using stencil_index_t = typename StencilSpecT::stencil_index_t;
+  using size_type       = std::size_t;
+
+public:
+  /**
+   * Constructor
+   *
+   * \param center          pointer to the first center element in local
+   *                        memory
+   * \param stencil_offsets stencil offsets for every stencil point
+   * \param size            number of center elements
+   * \param lpos            local offset of the first center element
+   */
+  StencilLine(const ElementT* center, const StencilOffsetsT* stencil_offsets,
+              size_type size, size_type lpos)
+  : _center(center), _stencil_offsets(stencil_offsets), _size(size),
+    _lpos(lpos) {}
+
+  /**
+   * Number of center elements
+   */
+  size_type size() const { return _size; }
+
+  /**
+   * Local offset of the first center element
+   */
+  size_type lpos() const { return _lpos; }
+
+  /**
+   * Returns the span of the center elements
+   */
+  const ElementT* data() const { return _center; }
+
+  /**
+   * Returns the span of the given stencil point index (index position in
+   * \ref StencilSpec)
+   */
+  const ElementT* data(const stencil_index_t index_stencil) const {
+    return _center + (*_stencil_offsets)[index_stencil];
+  }
+
+  /**
+   * Returns the value of the given stencil point index for the center
+   * element at the given position
+   */
+  ElementT value_at(const stencil_index_t index_stencil, size_type pos) const {
+    return data(index_stencil)[pos];
+  }
+
+  /**
+   * Returns the fixed offset of the given stencil point index relative to
+   * the center element
+   */
+  typename StencilOffsetsT::value_type offset(
+    const stencil_index_t index_stencil) const {
+    return (*_stencil_offsets)[index_stencil];
+  }
+
+private:
+  const ElementT*        _center;
+  const StencilOffsetsT* _stencil_offsets;
+  size_type              _size;
+  size_type              _lpos;
+};  // class StencilLine
+
 }  // namespace halo
 
 }  // namespace dash
@@ -0,0 +1,548 @@
+#ifndef DASH__INTERNAL__ASYNC_AGGREGATOR_H_
+#define DASH__INTERNAL__ASYNC_AGGREGATOR_H_
+
+#include <dash/Exception.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Buffers small asynchronous puts, gets and accumulates per target unit and
+ * segment and issues them in batches.
+ *
+ * Puts and gets to adjacent or overlapping addresses are coalesced into
+ * blocks that are transferred in a single operation using an indexed
+ * data type at the target. Accumulates of the same data type and operation
+ * on adjacent elements are combined into a single \c dart_accumulate.
+ *
+ * Buffered operations are issued and completed on \c flush or once the
+ * buffered data of a target exceeds the configured size. Overlapping puts
+ * are applied in program order, the data of gets is only available after
+ * the flush. Before an operation is buffered that overlaps a pending
+ * operation of a different kind (put, get or accumulate) on the same
+ * target, the target is flushed so that both are applied in program order.
+ *
+ * Aggregation is enabled through \c dash::AsyncAggregation. The aggregator
+ * is not thread-safe.
+ */
+class AsyncAggregator
+{
+public:
+  /// Default maximum number of bytes buffered for a single target
+  static constexpr size_t default_max_bytes = 64 * 1024;
+
+private:
+  typedef AsyncAggregator self_t;
+
+  struct transfer_op {
+    /// Byte offset of the operation in the target segment
+    uint64_t   offset;
+    /// Number of bytes transferred
+    size_t     nbytes;
+    /// Position of the data in the put buffer
+    size_t     pos;
+    /// Local destination of gets
+    char     * dest;
+    /// Index of the coalesced block containing the operation
+    size_t     block;
+  };
+
+  struct accumulate_op {
+    uint64_t          offset;
+    size_t            nelem;
+    size_t            nbytes;
+    size_t            pos;
+    dart_datatype_t   dtype;
+    dart_operation_t  op;
+  };
+
+  /**
+   * Disjoint byte ranges <tt>[begin, end)</tt> in a target segment, keyed
+   * by their begin.
+   */
+  struct range_set {
+    std::map<uint64_t, uint64_t> ranges;
+
+    bool overlaps(uint64_t begin, uint64_t end) const {
+      auto it = ranges.lower_bound(end);
+      if (it == ranges.begin()) {
+        return false;
+      }
+      return std::prev(it)->second > begin;
+    }
+
+    void insert(uint64_t begin, uint64_t end) {
+      auto it = ranges.upper_bound(begin);
+      if (it != ranges.begin() && std::prev(it)->second >= begin) {
+        --it;
+        begin = it->first;
+        end   = std::max(end, it->second);
+        it    = ranges.erase(it);
+      }
+      while (it != ranges.end() && it->first <= end) {
+        end = std::max(end, it->second);
+        it  = ranges.erase(it);
+      }
+      ranges.emplace(begin, end);
+    }
+
+    void clear() noexcept {
+      ranges.clear();
+    }
+  };
+
+  struct target_buffer {
+    /// Global pointer to the target segment at offset 0
+    dart_gptr_t                 gptr;
+    std::vector<char>           put_data;
+    std::vector<transfer_op>    puts;
+    std::vector<transfer_op>    gets;
+    std::vector<char>           acc_data;
+    std::vector<accumulate_op>  accs;
+    /// Memory accessed by the pending operations of every kind
+    range_set                   put_ranges;
+    range_set                   get_ranges;
+    range_set                   acc_ranges;
+    /// Number of bytes buffered for this target
+    size_t                      nbytes = 0;
+
+    bool empty() const noexcept {
+      return puts.empty() && gets.empty() && accs.empty();
+    }
+  };
+
+  struct block_list {
+    std::vector<size_t>   offsets;
+    std::vector<size_t>   lengths;
+    /// Position of every block in the packed buffer
+    std::vector<size_t>   pos;
+    size_t                nbytes = 0;
+
+    void clear() noexcept {
+      offsets.clear();
+      lengths.clear();
+      pos.clear();
+      nbytes = 0;
+    }
+  };
+
+public:
+  /**
+   * The aggregator instance of this unit.
+   */
+  static self_t & instance() {
+    static self_t aggregator;
+    return aggregator;
+  }
+
+  AsyncAggregator(const self_t & other) = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * Whether operations are currently aggregated.
+   */
+  inline bool enabled() const noexcept {
+    return _depth > 0;
+  }
+
+  /**
+   * Whether operations are buffered and have not been issued yet.
+   */
+  inline bool has_pending() const noexcept {
+    return _npending > 0;
+  }
+
+  /**
+   * Enable aggregation, calls can be nested.
+   */
+  void enable(size_t max_bytes = default_max_bytes) {
+    if (_depth++ == 0) {
+      _max_bytes = std::max<size_t>(max_bytes, 1);
+    }
+  }
+
+  /**
+   * Disable aggregation once all nested calls to \c enable have been
+   * matched. Completes all buffered operations.
+   */
+  void disable() {
+    DASH_ASSERT_GT(_depth, 0, "unbalanced AsyncAggregator::disable");
+    if (--_depth == 0) {
+      flush_all();
+    }
+  }
+
+  /**
+   * Buffer a write of \c nbytes bytes from \c src to \c gptr.
+   * The data is copied, \c src can be re-used immediately.
+   */
+  void put(const dart_gptr_t & gptr, const void * src, size_t nbytes) {
+    auto & target = target_of(gptr);
+    uint64_t begin = gptr.addr_or_offs.offset;
+    if (target.get_ranges.overlaps(begin, begin + nbytes) ||
+        target.acc_ranges.overlaps(begin, begin + nbytes)) {
+      flush_target(target);
+    }
+    target.put_ranges.insert(begin, begin + nbytes);
+    transfer_op op;
+    op.offset = gptr.addr_or_offs.offset;
+    op.nbytes = nbytes;
+    op.pos    = target.put_data.size();
+    op.dest   = nullptr;
+    op.block  = 0;
+    target.put_data.insert(
+      target.put_data.end(),
+      static_cast<const char *>(src),
+      static_cast<const char *>(src) + nbytes);
+    target.puts.push_back(op);
+    added(target, nbytes);
+  }
+
+  /**
+   * Buffer a read of \c nbytes bytes from \c gptr into \c dest.
+   * The data is available in \c dest after the next flush of the target.
+   */
+  void get(const dart_gptr_t & gptr, void * dest, size_t nbytes) {
+    auto & target = target_of(gptr);
+    uint64_t begin = gptr.addr_or_offs.offset;
+    if (target.put_ranges.overlaps(begin, begin + nbytes) ||
+        target.acc_ranges.overlaps(begin, begin + nbytes)) {
+      flush_target(target);
+    }
+    target.get_ranges.insert(begin, begin + nbytes);
+    transfer_op op;
+    op.offset = gptr.addr_or_offs.offset;
+    op.nbytes = nbytes;
+    op.pos    = 0;
+    op.dest   = static_cast<char *>(dest);
+    op.block  = 0;
+    target.gets.push_back(op);
+    added(target, nbytes);
+  }
+
+  /**
+   * Buffer an element-wise atomic update of \c nelem values of type
+   * \c dtype at \c gptr. The values are copied, \c values can be re-used
+   * immediately.
+   */
+  void accumulate(
+    const dart_gptr_t & gptr,
+    const void        * values,
+    size_t              nelem,
+    size_t              nbytes,
+    dart_datatype_t     dtype,
+    dart_operation_t    op) {
+    auto & target = target_of(gptr);
+    uint64_t begin = gptr.addr_or_offs.offset;
+    if (target.put_ranges.overlaps(begin, begin + nbytes) ||
+        target.get_ranges.overlaps(begin, begin + nbytes)) {
+      flush_target(target);
+    }
+    target.acc_ranges.insert(begin, begin + nbytes);
+    accumulate_op acc;
+    acc.offset = gptr.addr_or_offs.offset;
+    acc.nelem  = nelem;
+    acc.nbytes = nbytes;
+    acc.pos    = target.acc_data.size();
+    acc.dtype  = dtype;
+    acc.op     = op;
+    target.acc_data.insert(
+      target.acc_data.end(),
+      static_cast<const char *>(values),
+      static_cast<const char *>(values) + nbytes);
+    target.accs.push_back(acc);
+    added(target, nbytes);
+  }
+
+  /**
+   * Issue and complete all buffered operations on the segment and unit
+   * referenced by \c gptr.
+   */
+  void flush(const dart_gptr_t & gptr) {
+    if (!has_pending()) {
+      return;
+    }
+    auto it = _targets.find(key_of(gptr));
+    if (it != _targets.end()) {
+      flush_target(it->second);
+    }
+  }
+
+  /**
+   * Issue and complete all buffered operations on the segment referenced
+   * by \c gptr at all units.
+   */
+  void flush_segment(const dart_gptr_t & gptr) {
+    if (!has_pending()) {
+      return;
+    }
+    for (auto & target : _targets) {
+      if (target.second.gptr.teamid == gptr.teamid &&
+          target.second.gptr.segid  == gptr.segid) {
+        flush_target(target.second);
+      }
+    }
+  }
+
+  /**
+   * Issue and complete all buffered operations.
+   */
+  void flush_all() {
+    if (!has_pending()) {
+      return;
+    }
+    for (auto & target : _targets) {
+      flush_target(target.second);
+    }
+  }
+
+private:
+  AsyncAggregator() = default;
+
+  static inline uint64_t key_of(const dart_gptr_t & gptr) noexcept {
+    return (static_cast<uint64_t>(static_cast<uint16_t>(gptr.teamid)) << 48)
+         | (static_cast<uint64_t>(static_cast<uint16_t>(gptr.segid))  << 32)
+         |  static_cast<uint64_t>(static_cast<uint32_t>(gptr.unitid));
+  }
+
+  target_buffer & target_of(const dart_gptr_t & gptr) {
+    auto key = key_of(gptr);
+    if (_last != nullptr && _last_key == key) {
+      return *_last;
+    }
+    auto it = _targets.find(key);
+    if (it == _targets.end()) {
+      it = _targets.emplace(key, target_buffer()).first;
+      it->second.gptr = gptr;
+      it->second.gptr.addr_or_offs.offset = 0;
+    }
+    _last_key = key;
+    _last     = &(it->second);
+    return it->second;
+  }
+
+  void added(target_buffer & target, size_t nbytes) {
+    ++_npending;
+    target.nbytes += nbytes;
+    if (target.nbytes >= _max_bytes) {
+      flush_target(target);
+    }
+  }
+
+  /**
+   * Sorts the operations by offset and merges operations on adjacent or
+   * overlapping memory into blocks.
+   */
+  void coalesce(std::vector<transfer_op> & ops, block_list & blocks) {
+    _order.resize(ops.size());
+    std::iota(_order.begin(), _order.end(), 0);
+    std::stable_sort(
+      _order.begin(), _order.end(),
+      [&ops](size_t a, size_t b) { return ops[a].offset < ops[b].offset; });
+
+    blocks.clear();
+    uint64_t block_end = 0;
+    for (auto idx : _order) {
+      auto & op = ops[idx];
+      if (blocks.offsets.empty() || op.offset > block_end) {
+        blocks.offsets.push_back(op.offset);
+        blocks.lengths.push_back(0);
+        block_end = op.offset;
+      }
+      block_end = std::max<uint64_t>(block_end, op.offset + op.nbytes);
+      blocks.lengths.back() = block_end - blocks.offsets.back();
+      op.block = blocks.offsets.size() - 1;
+    }
+    blocks.pos.resize(blocks.offsets.size());
+    for (size_t b = 0; b < blocks.offsets.size(); ++b) {
+      blocks.pos[b]  = blocks.nbytes;
+      blocks.nbytes += blocks.lengths[b];
+    }
+  }
+
+  /**
+   * Transfers the packed blocks from or to the target segment, using an
+   * indexed data type for the target if there are multiple blocks.
+   */
+  void transfer_blocks(
+    const dart_gptr_t & seg_gptr,
+    block_list        & blocks,
+    char              * buffer,
+    bool                is_put) {
+    size_t first = 0;
+    size_t nblocks = blocks.offsets.size();
+    while (first < nblocks) {
+      // offsets of the indexed type are limited to INT_MAX
+      size_t base = blocks.offsets[first];
+      size_t last = first + 1;
+      while (last < nblocks &&
+             blocks.offsets[last] + blocks.lengths[last] - base <= INT_MAX) {
+        ++last;
+      }
+      dart_gptr_t gptr = seg_gptr;
+      gptr.addr_or_offs.offset = base;
+      char  * buf    = buffer + blocks.pos[first];
+      size_t  nbytes = blocks.pos[last - 1] + blocks.lengths[last - 1]
+                       - blocks.pos[first];
+      dart_datatype_t remote_type = DART_TYPE_BYTE;
+      if (last - first > 1) {
+        _rel_offsets.resize(last - first);
+        for (size_t b = first; b < last; ++b) {
+          _rel_offsets[b - first] = blocks.offsets[b] - base;
+        }
+        DASH_ASSERT_RETURNS(
+          dart_type_create_indexed(
+            DART_TYPE_BYTE, last - first,
+            blocks.lengths.data() + first, _rel_offsets.data(),
+            &remote_type),
+          DART_OK);
+      }
+      if (is_put) {
+        DASH_ASSERT_RETURNS(
+          dart_put(gptr, buf, nbytes, DART_TYPE_BYTE, remote_type),
+          DART_OK);
+      } else {
+        DASH_ASSERT_RETURNS(
+          dart_get(buf, gptr, nbytes, remote_type, DART_TYPE_BYTE),
+          DART_OK);
+      }
+      if (remote_type != DART_TYPE_BYTE) {
+        // pending operations are not affected
+        dart_type_destroy(&remote_type);
+      }
+      first = last;
+    }
+  }
+
+  void flush_target(target_buffer & target) {
+    if (target.empty()) {
+      return;
+    }
+    DASH_LOG_TRACE("AsyncAggregator.flush_target",
+                   "unit:", target.gptr.unitid,
+                   "segid:", target.gptr.segid,
+                   "puts:", target.puts.size(),
+                   "gets:", target.gets.size(),
+                   "accs:", target.accs.size());
+
+    // accumulates of the same type and operation on adjacent elements
+    if (!target.accs.empty()) {
+      auto & accs = target.accs;
+      _order.resize(accs.size());
+      std::iota(_order.begin(), _order.end(), 0);
+      std::stable_sort(
+        _order.begin(), _order.end(),
+        [&accs](size_t a, size_t b) {
+          return accs[a].offset < accs[b].offset;
+        });
+      _acc_buf.resize(target.acc_data.size());
+      size_t pos = 0;
+      size_t i   = 0;
+      while (i < _order.size()) {
+        auto   & first = accs[_order[i]];
+        size_t   start = pos;
+        size_t   nelem = 0;
+        uint64_t end   = first.offset;
+        while (i < _order.size()) {
+          auto & acc = accs[_order[i]];
+          if (acc.offset != end || acc.dtype != first.dtype ||
+              acc.op != first.op) {
+            break;
+          }
+          std::memcpy(_acc_buf.data() + pos,
+                      target.acc_data.data() + acc.pos, acc.nbytes);
+          pos   += acc.nbytes;
+          nelem += acc.nelem;
+          end   += acc.nbytes;
+          ++i;
+        }
+        dart_gptr_t gptr = target.gptr;
+        gptr.addr_or_offs.offset = first.offset;
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(gptr, _acc_buf.data() + start, nelem,
+                          first.dtype, first.op),
+          DART_OK);
+      }
+    }
+
+    // puts, later puts overwrite earlier puts in the packed buffer
+    if (!target.puts.empty()) {
+      coalesce(target.puts, _put_blocks);
+      _put_buf.resize(_put_blocks.nbytes);
+      for (auto & op : target.puts) {
+        std::memcpy(
+          _put_buf.data() + _put_blocks.pos[op.block]
+                          + (op.offset - _put_blocks.offsets[op.block]),
+          target.put_data.data() + op.pos,
+          op.nbytes);
+      }
+      transfer_blocks(target.gptr, _put_blocks, _put_buf.data(), true);
+    }
+
+    if (!target.gets.empty()) {
+      coalesce(target.gets, _get_blocks);
+      _get_buf.resize(_get_blocks.nbytes);
+      transfer_blocks(target.gptr, _get_blocks, _get_buf.data(), false);
+    }
+
+    DASH_ASSERT_RETURNS(
+      dart_flush(target.gptr),
+      DART_OK);
+
+    for (auto & op : target.gets) {
+      std::memcpy(
+        op.dest,
+        _get_buf.data() + _get_blocks.pos[op.block]
+                        + (op.offset - _get_blocks.offsets[op.block]),
+        op.nbytes);
+    }
+
+    _npending -= target.puts.size() + target.gets.size()
+                 + target.accs.size();
+    target.put_data.clear();
+    target.puts.clear();
+    target.gets.clear();
+    target.acc_data.clear();
+    target.accs.clear();
+    target.put_ranges.clear();
+    target.get_ranges.clear();
+    target.acc_ranges.clear();
+    target.nbytes = 0;
+  }
+
+private:
+  std::unordered_map<uint64_t, target_buffer> _targets;
+  /// Most recently used target
+  target_buffer              * _last      = nullptr;
+  uint64_t                     _last_key  = 0;
+  size_t                       _max_bytes = default_max_bytes;
+  size_t                       _npending  = 0;
+  int                          _depth     = 0;
+
+  // scratch space re-used by all flushes
+  std::vector<size_t>          _order;
+  std::vector<size_t>          _rel_offsets;
+  block_list                   _put_blocks;
+  block_list                   _get_blocks;
+  std::vector<char>            _put_buf;
+  std::vector<char>            _get_buf;
+  std::vector<char>            _acc_buf;
+};
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__INTERNAL__ASYNC_AGGREGATOR_H_
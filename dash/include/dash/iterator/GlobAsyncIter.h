@@ -50,6 +50,7 @@ public:
    */
   void wait()
   {
+    dash::internal::AsyncAggregator::instance().flush_segment(this->dart_gptr());
     dart_flush_all(this->dart_gptr());
   }
 
@@ -59,6 +60,7 @@ public:
    */
   void get()
   {
+    dash::internal::AsyncAggregator::instance().flush_segment(this->dart_gptr());
     dart_flush_all(this->dart_gptr());
   }
 
@@ -70,6 +72,7 @@ public:
    */
   void push()
   {
+    dash::internal::AsyncAggregator::instance().flush_segment(this->dart_gptr());
     dart_flush_local_all(this->dart_gptr());
   }
 
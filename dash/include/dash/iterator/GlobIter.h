@@ -446,6 +446,23 @@ public:
     return (_lbegin + local_pos.index + offset);
   }
 
+  /**
+   * Convert global iterator to a native pointer if the referenced element
+   * is stored at the calling unit or at a unit on the same shared memory
+   * node.
+   *
+   * \return  A native pointer to the element at the iterator's position,
+   *          or \c nullptr if the element is not directly accessible.
+   */
+  local_pointer shared_local() const
+  {
+    void * addr = nullptr;
+    if (dart_gptr_getaddr_shared(dart_gptr(), &addr) != DART_OK) {
+      return nullptr;
+    }
+    return static_cast<local_pointer>(addr);
+  }
+
   /**
    * Unit and local offset at the iterator's position.
    */
@@ -8,6 +8,7 @@
 #include <dash/Array.h>
 #include <dash/Allocator.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
 
 #include <dash/memory/GlobHeapMem.h>
 
@@ -23,6 +24,7 @@
 #include <vector>
 #include <functional>
 #include <algorithm>
+#include <type_traits>
 #include <cstddef>
 
 
@@ -168,6 +170,29 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+private:
+  /**
+   * Slot in the open addressing hash index of a unit's local elements.
+   */
+  struct index_slot {
+    /// Hash value of the element's key, allows to skip slots without
+    /// dereferencing the element.
+    size_type  hash;
+    /// Offset of the element in the unit's local memory space, negative
+    /// for unused slots and slots of erased elements.
+    index_type lidx;
+  };
+
+  typedef dash::Array<index_slot>                            glob_index_map;
+
+  /// Local offset of an unused slot in the local element index.
+  static constexpr index_type _index_slot_empty  = -1;
+  /// Local offset of a slot of an erased element (tombstone) in the local
+  /// element index.
+  static constexpr index_type _index_slot_erased = -2;
+  /// Number of slots fetched in a single probe of a remote element index.
+  static constexpr size_type  _index_probe_size = 8;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -203,6 +228,32 @@ private:
   /// Default is 4 KB.
   size_type              _local_buffer_size
                            = 4096 / sizeof(value_type);
+  /// Hash type for mapping of key to slot in local element index.
+  std::hash<key_type>     _index_hash;
+  /// Open addressing hash index of elements in local memory space,
+  /// updated on every local insertion.
+  std::vector<index_slot> _local_index;
+  /// Number of used slots in the local element index.
+  size_type               _local_index_size = 0;
+  /// Number of slots of erased elements in the local element index.
+  size_type               _local_index_erased = 0;
+  /// Local element indices of all units, published on commit for key
+  /// lookups at remote units.
+  glob_index_map          _glob_index;
+  /// Number of slots per unit in the published element indices.
+  size_type               _glob_index_lsize = 0;
+  /// Number of elements in local memory space that are mapped to a
+  /// different unit by the hash function, indexed by the mapped unit.
+  std::vector<size_type>  _local_misplaced;
+  /// Non-zero if elements mapped to a unit by the hash function are stored
+  /// at different units, indexed by the mapped unit, as of the last commit.
+  std::vector<size_type>  _owner_misplaced;
+  /// Number of elements stored at a unit that are mapped to different
+  /// units by the hash function, indexed by unit, as of the last commit.
+  std::vector<size_type>  _holder_misplaced;
+  /// Keys of elements at remote units that are marked for removal in
+  /// next commit, indexed by unit.
+  std::vector<std::vector<key_type>> _erase_keys;
 
 public:
   /// Local proxy object, allows use in range-based for loops.
@@ -274,6 +325,8 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
+    // Remove elements erased by remote units:
+    _erase_commit();
     // Apply changes in local memory spaces to global memory space:
     if (_globmem != nullptr) {
       _globmem->commit();
@@ -303,6 +356,8 @@ public:
                    "invalid size after global commit");
     _begin = iterator(this, 0);
     _end   = iterator(this, new_size);
+    // Publish local element indices for remote key lookups:
+    _index_commit();
     DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
   }
 
@@ -357,6 +412,15 @@ public:
     _lend        = _lbegin;
     DASH_LOG_TRACE_VAR("UnorderedMap.allocate", _lbegin);
     DASH_LOG_TRACE_VAR("UnorderedMap.allocate", _lend);
+    // Local element index:
+    _local_index      = std::vector<index_slot>(
+                          _index_capacity(lcap),
+                          index_slot { 0, _index_slot_empty });
+    _local_index_size   = 0;
+    _local_index_erased = 0;
+    _local_misplaced    = std::vector<size_type>(_team->size(), 0);
+    _erase_keys         = std::vector<std::vector<key_type>>(_team->size());
+    _index_commit();
     // Register deallocator of this map instance at the team
     // instance that has been used to initialized it:
     _team->register_deallocator(
@@ -391,6 +455,17 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    if (_glob_index_lsize > 0) {
+      _glob_index.deallocate();
+    }
+    _glob_index_lsize     = 0;
+    _local_index.clear();
+    _local_index_size     = 0;
+    _local_index_erased   = 0;
+    _local_misplaced.clear();
+    _owner_misplaced.clear();
+    _holder_misplaced.clear();
+    _erase_keys.clear();
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _local_sizes.local[0] = 0;
     _remote_size          = 0;
@@ -582,14 +657,31 @@ public:
     return nelem;
   }
 
+  /**
+   * Find the element with the given key.
+   *
+   * Looks up the key in the local element index first, then probes the
+   * element index of the unit mapped to the key by the hash function.
+   * Element indices of other units are only probed if elements mapped to
+   * the same unit have been inserted at different units, and only at
+   * units storing such elements.
+   * A remote probe fetches a window of index slots followed by the
+   * candidate element, so a lookup at the hash unit usually requires two
+   * one-sided transfers.
+   * With the default hash function \c HashLocal, keys are not mapped to a
+   * unique unit and the lookup of a key that is not in local memory space
+   * probes the element indices of all units.
+   *
+   * Elements inserted at remote units are found after the next commit.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found = _end;
+    auto     lpos  = _find_lpos(key);
+    if (lpos.second >= 0) {
+      found = iterator(this, lpos.first, lpos.second);
+    }
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -597,15 +689,85 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    auto           self  = const_cast<self_t *>(this);
+    const_iterator found = _end;
+    auto           lpos  = self->_find_lpos(key);
+    if (lpos.second >= 0) {
+      found = const_iterator(self, lpos.first, lpos.second);
+    }
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
 
+  /**
+   * Find elements with the keys in the given range.
+   *
+   * Keys are bucketed by the unit mapped to them by the hash function and
+   * exchanged in a single all-to-all round. Every unit looks up the keys
+   * it received in its local element index and returns the local offsets
+   * of the elements in a second all-to-all round.
+   * Only elements committed before the call are found at remote units.
+   *
+   * Collective operation.
+   *
+   * \return  Iterators to the elements in order of the given keys,
+   *          \c end() for keys that are not contained in the map.
+   */
+  template<class InputIterator>
+  std::vector<iterator> find_batch(
+    // Iterator at first key to look up.
+    InputIterator first,
+    // Iterator past the last key to look up.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.find_batch()");
+    auto nunits = _team->size();
+    // Bucket keys by target unit, remember their position in the range:
+    std::vector<std::vector<key_type>>  send_keys(nunits);
+    std::vector<std::vector<size_type>> send_pos(nunits);
+    size_type nkeys = 0;
+    for (auto it = first; it != last; ++it, ++nkeys) {
+      team_unit_t unit = _key_hash(*it);
+      send_keys[unit.id].push_back(*it);
+      send_pos[unit.id].push_back(nkeys);
+    }
+    std::vector<iterator>  found(nkeys, _end);
+    std::vector<size_type> recv_counts(nunits, 0);
+    auto keys = _exchange(send_keys, recv_counts);
+    // Look up received keys in local element index, reply to every unit
+    // in order of its requests:
+    std::vector<std::vector<index_type>> send_lidx(nunits);
+    auto key_it = keys.cbegin();
+    for (size_type u = 0; u < nunits; ++u) {
+      send_lidx[u].reserve(recv_counts[u]);
+      for (size_type k = 0; k < recv_counts[u]; ++k, ++key_it) {
+        send_lidx[u].push_back(
+          _index_find_local(*key_it, _index_hash(*key_it)));
+      }
+    }
+    auto lidcs   = _exchange(send_lidx, recv_counts);
+    auto lidx_it = lidcs.cbegin();
+    for (size_type u = 0; u < nunits; ++u) {
+      team_unit_t unit(u);
+      // Elements inserted at remote units after the last commit are not
+      // accessible yet:
+      size_type   lsize = _local_cumul_sizes[u] -
+                          (u > 0 ? _local_cumul_sizes[u-1] : 0);
+      for (size_type k = 0; k < recv_counts[u]; ++k, ++lidx_it) {
+        auto pos = send_pos[u][k];
+        if (*lidx_it >= 0 &&
+            (unit == _myid || static_cast<size_type>(*lidx_it) < lsize)) {
+          found[pos] = iterator(this, unit, *lidx_it);
+        } else if (!_is_owner_placed(unit)) {
+          // Element might be stored at a unit different from its hash unit:
+          found[pos] = find(send_keys[u][k]);
+        }
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap.find_batch >", "keys:", nkeys);
+    return found;
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
@@ -655,37 +817,179 @@ public:
     //       multiple calls of globmem.grow(_local_buffer_size).
     //       Could be optimized to allocate additional memory in a single call
     //       of globmem.grow(std::distance(first,last)).
+    //       See insert_batch for a collective variant.
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Insert elements in the given range at the units mapped to their keys
+   * by the hash function.
+   *
+   * Elements are bucketed by target unit and exchanged in a single
+   * all-to-all round. Every unit then inserts the elements it received
+   * in local memory space, allocating additional capacity at most once.
+   * Elements with a key that is already contained in the map are not
+   * inserted.
+   *
+   * Collective operation, changes are committed on return.
+   */
+  template<class InputIterator>
+  void insert_batch(
+    // Iterator at first value in the range to insert.
+    InputIterator first,
+    // Iterator past the last value in the range to insert.
+    InputIterator last)
+  {
+    DASH_LOG_TRACE("UnorderedMap.insert_batch()");
+    DASH_ASSERT(_globmem != nullptr);
+    // Bucket values by target unit:
+    std::vector<std::vector<value_type>> send_values(_team->size());
+    for (auto it = first; it != last; ++it) {
+      team_unit_t unit = _key_hash((*it).first);
+      send_values[unit.id].push_back(*it);
+    }
+    std::vector<size_type> recv_counts(_team->size(), 0);
+    auto values = _exchange(send_values, recv_counts);
+    DASH_LOG_TRACE("UnorderedMap.insert_batch",
+                   "received values:", values.size());
+    _insert_local_batch(values);
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.insert_batch >",
+                   "size:", size(), "local size:", lsize());
+  }
+
+  /**
+   * Remove the element at the given iterator position.
+   *
+   * Elements in local memory space are removed immediately, the last
+   * local element is moved to the position of the removed element.
+   * Iterators to the last local element are invalidated.
+   * Elements at remote units are removed in the next commit and stay
+   * visible until then.
+   *
+   * \return  Iterator at the element following the removed element,
+   *          that is the position of the removed element if it has been
+   *          removed from local memory space.
+   */
   iterator erase(
     const_iterator position)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_TRACE("UnorderedMap.erase()", "iterator:", position);
+    auto lpos = position.lpos();
+    auto pos  = position.pos();
+    if (lpos.unit == _myid) {
+      _erase_local(lpos.index);
+    } else {
+      value_type value = *position;
+      _erase_keys[lpos.unit.id].push_back(value.first);
+      // Element remains in the map until the next commit:
+      ++pos;
+    }
+    pos = std::min<index_type>(pos, size());
+    DASH_LOG_TRACE("UnorderedMap.erase >");
+    return iterator(this, pos);
   }
 
+  /**
+   * Remove the element with the given key.
+   *
+   * Elements in local memory space are removed immediately, the last
+   * local element is moved to the position of the removed element.
+   * Iterators to the last local element are invalidated.
+   * Elements at remote units are removed in the next commit and stay
+   * visible until then.
+   *
+   * \return  Number of elements removed, 0 or 1.
+   */
   size_type erase(
     /// Key of the container element to remove.
     const key_type & key)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_TRACE_VAR("UnorderedMap.erase()", key);
+    auto        lpos = _find_lpos(key);
+    team_unit_t unit = lpos.first;
+    index_type  lidx = lpos.second;
+    if (lidx < 0) {
+      DASH_LOG_TRACE("UnorderedMap.erase >", "key not found");
+      return 0;
+    }
+    if (unit == _myid) {
+      _erase_local(lidx);
+    } else {
+      _erase_keys[unit.id].push_back(key);
+    }
+    DASH_LOG_TRACE("UnorderedMap.erase >", "unit:", unit);
+    return 1;
   }
 
+  /**
+   * Remove elements in the given iterator range.
+   *
+   * \return  Iterator at the position of the first removed element.
+   */
   iterator erase(
     /// Iterator at first element to remove.
     const_iterator first,
     /// Iterator past the last element to remove.
     const_iterator last)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_TRACE("UnorderedMap.erase()", "first:", first, "last:", last);
+    // Resolve keys before removing any element as removal of local
+    // elements changes the order of local memory space:
+    std::vector<key_type> keys;
+    for (auto it = first; it != last; ++it) {
+      value_type value = *it;
+      keys.push_back(value.first);
+    }
+    for (const auto & key : keys) {
+      erase(key);
+    }
+    auto pos = std::min<index_type>(first.pos(), size());
+    DASH_LOG_TRACE("UnorderedMap.erase >");
+    return iterator(this, pos);
+  }
+
+  /**
+   * Release unused capacity in global memory and remove slots of erased
+   * elements from the element index.
+   *
+   * Removal of local elements fills the gap with the last local element,
+   * so elements are stored contiguously and compaction itself does not
+   * move any element. Removals requested by remote units are applied
+   * first and invalidate iterators like \c erase.
+   * Buckets in global memory that do not contain any element are
+   * deallocated, except for the first local bucket.
+   *
+   * Collective operation, changes are committed on return.
+   */
+  void compact()
+  {
+    DASH_LOG_TRACE("UnorderedMap.compact()");
+    // Apply removals requested by remote units first to obtain final local
+    // size:
+    _erase_commit();
+    // Release trailing buckets that do not contain elements:
+    size_type nunused  = lcapacity() - lsize();
+    size_type nrelease = 0;
+    auto    & buckets  = _globmem->local_buckets();
+    for (auto b_it = buckets.rbegin();
+         b_it != buckets.rend() && std::next(b_it) != buckets.rend();
+         ++b_it) {
+      if (nrelease + b_it->size > nunused) {
+        break;
+      }
+      nrelease += b_it->size;
+    }
+    DASH_LOG_TRACE("UnorderedMap.compact", "releasing", nrelease,
+                   "of", nunused, "unused elements");
+    _globmem->shrink(nrelease);
+    // Rebuild element index without slots of erased elements:
+    _index_rehash(_index_capacity(_local_index_size));
+    barrier();
+    DASH_LOG_TRACE("UnorderedMap.compact >",
+                   "local capacity:", lcapacity());
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -801,7 +1105,7 @@ private:
                                  ).fetch_add(1);
     size_type new_local_size   = old_local_size + 1;
     size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
+    _local_cumul_sizes[_myid] += 1;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
@@ -827,16 +1131,20 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
-    // Convert local iterator to global iterator:
+    // Register new element in local element index:
+    _index_insert(_index_hash(value.first), old_local_size);
+    // Convert local iterator to global iterator, the new element is stored
+    // in local memory space:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
+                   "unit:", _myid, "lidx:", old_local_size);
+    result.first  = iterator(this, _myid, old_local_size);
     result.second = true;
 
     if (unit != _myid) {
       DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
       // Mark inserted element for move to remote unit in next commit:
       _move_elements.push_back(result.first);
+      ++_local_misplaced[unit.id];
     }
 
     // Update iterators as global memory space has been changed for the
@@ -855,6 +1163,447 @@ private:
     return result;
   }
 
+  /**
+   * Remove element at given offset in local memory space.
+   * The last local element is moved to the position of the removed
+   * element, iterators referencing it are invalidated.
+   */
+  void _erase_local(index_type lidx)
+  {
+    DASH_LOG_TRACE("UnorderedMap._erase_local()", "lidx:", lidx);
+    index_type   lidx_last  = lsize() - 1;
+    DASH_ASSERT_RANGE(0, lidx, lidx_last, "local offset out of range");
+    auto         l_first    = _globmem->lbegin();
+    value_type * lptr_erase = static_cast<value_type *>(l_first + lidx);
+    // Replace slot of removed element by tombstone:
+    auto hash = _index_hash(lptr_erase->first);
+    _local_index[_index_slot_of(hash, lidx)].lidx = _index_slot_erased;
+    --_local_index_size;
+    ++_local_index_erased;
+    team_unit_t owner = _key_hash(lptr_erase->first);
+    if (owner != _myid) {
+      --_local_misplaced[owner.id];
+    }
+    lptr_erase->~value_type();
+    if (lidx != lidx_last) {
+      // Move last element to position of removed element:
+      value_type * lptr_last = static_cast<value_type *>(
+                                 l_first + lidx_last);
+      new (lptr_erase) value_type(*lptr_last);
+      lptr_last->~value_type();
+      hash = _index_hash(lptr_erase->first);
+      _local_index[_index_slot_of(hash, lidx_last)].lidx = lidx;
+    }
+    // Use atomic decrement to prevent hazard when other units perform
+    // remote insertion at the local unit:
+    GlobRef<Atomic<size_type>>(_local_size_gptr).fetch_sub(1);
+    _local_cumul_sizes[_myid] -= 1;
+    _lend = _lbegin + lsize();
+    _end  = iterator(this, size());
+    DASH_LOG_TRACE("UnorderedMap._erase_local >", "local size:", lsize());
+  }
+
+  /**
+   * Remove elements in local memory space that have been erased by remote
+   * units since the last commit.
+   *
+   * Collective operation.
+   */
+  void _erase_commit()
+  {
+    size_type l_nerase = 0;
+    size_type g_nerase = 0;
+    for (const auto & keys : _erase_keys) {
+      l_nerase += keys.size();
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        &l_nerase, &g_nerase, 1,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    if (g_nerase == 0) {
+      return;
+    }
+    DASH_LOG_TRACE("UnorderedMap._erase_commit()", "keys:", l_nerase);
+    std::vector<size_type> recv_counts(_team->size(), 0);
+    auto keys = _exchange(_erase_keys, recv_counts);
+    for (const auto & key : keys) {
+      auto lidx = _index_find_local(key, _index_hash(key));
+      if (lidx >= 0) {
+        _erase_local(lidx);
+      }
+    }
+    for (auto & keys_u : _erase_keys) {
+      keys_u.clear();
+    }
+    DASH_LOG_TRACE("UnorderedMap._erase_commit >", "local size:", lsize());
+  }
+
+  /**
+   * Insert values received in a batch exchange in local memory space.
+   * Elements with a key that is already contained in the map are skipped.
+   */
+  void _insert_local_batch(const std::vector<value_type> & values)
+  {
+    DASH_LOG_TRACE("UnorderedMap._insert_local_batch()",
+                   "values:", values.size());
+    size_type old_local_size = _local_sizes.local[0];
+    size_type local_capacity = _globmem->local_size();
+    // Allocate capacity for all values in a single bucket:
+    if (old_local_size + values.size() > local_capacity) {
+      size_type grow_size = old_local_size + values.size() - local_capacity;
+      if (grow_size < _local_buffer_size) {
+        grow_size = _local_buffer_size;
+      }
+      DASH_LOG_TRACE("UnorderedMap._insert_local_batch",
+                     "globmem.grow(", grow_size, ")");
+      _globmem->grow(grow_size);
+    }
+    size_type ninserted = 0;
+    for (const auto & value : values) {
+      auto hash = _index_hash(value.first);
+      auto lidx = _is_owner_placed(_myid)
+                  ? _index_find_local(value.first, hash)
+                  : _find_lpos(value.first).second;
+      if (lidx >= 0) {
+        continue;
+      }
+      index_type   lidx_insert = old_local_size + ninserted;
+      value_type * lptr_insert = static_cast<value_type *>(
+                                   _globmem->lbegin() + lidx_insert);
+      new (lptr_insert) value_type(value);
+      _index_insert(hash, lidx_insert);
+      ++ninserted;
+    }
+    // Use atomic increment to prevent hazard when other units perform
+    // remote insertion at the local unit:
+    GlobRef<Atomic<size_type>>(_local_size_gptr).fetch_add(ninserted);
+    _local_cumul_sizes[_myid] += ninserted;
+    _lend = _lbegin + lsize();
+    DASH_LOG_TRACE("UnorderedMap._insert_local_batch >",
+                   "inserted:", ninserted);
+  }
+
+  /**
+   * Exchange values bucketed by target unit with all units in a single
+   * all-to-all round.
+   *
+   * Collective operation.
+   *
+   * \return  Values received from all units, ordered by source unit.
+   */
+  template<typename ValueT>
+  std::vector<ValueT> _exchange(
+    /// Values to send, indexed by target unit.
+    const std::vector<std::vector<ValueT>> & send_values,
+    /// [OUT] Number of values received, indexed by source unit.
+    std::vector<size_type>                 & recv_counts)
+  {
+    auto nunits = _team->size();
+    std::vector<size_type> send_counts(nunits);
+    for (size_type u = 0; u < nunits; ++u) {
+      send_counts[u] = send_values[u].size();
+    }
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        send_counts.data(), recv_counts.data(), 1,
+        dash::dart_datatype<size_type>::value,
+        _team->dart_id()),
+      DART_OK);
+    // Values are transferred as bytes, displacements follow from the
+    // counts of units with lower id:
+    std::vector<size_t> send_nbytes(nunits);
+    std::vector<size_t> send_displs(nunits);
+    std::vector<size_t> recv_nbytes(nunits);
+    std::vector<size_t> recv_displs(nunits);
+    size_type nsend = 0;
+    size_type nrecv = 0;
+    for (size_type u = 0; u < nunits; ++u) {
+      send_nbytes[u] = send_counts[u] * sizeof(ValueT);
+      send_displs[u] = nsend * sizeof(ValueT);
+      recv_nbytes[u] = recv_counts[u] * sizeof(ValueT);
+      recv_displs[u] = nrecv * sizeof(ValueT);
+      nsend += send_counts[u];
+      nrecv += recv_counts[u];
+    }
+    // The send buffer must be valid and differ from the receive buffer
+    // also if no values are sent by this unit:
+    std::vector<ValueT> send_buf;
+    send_buf.reserve(std::max<size_type>(nsend, 1));
+    for (const auto & values_u : send_values) {
+      std::copy(values_u.begin(), values_u.end(),
+                std::back_inserter(send_buf));
+    }
+    std::vector<char> recv_buf(nrecv * sizeof(ValueT));
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+        send_buf.data(), send_nbytes.data(), send_displs.data(),
+        DART_TYPE_BYTE,
+        recv_buf.data(), recv_nbytes.data(), recv_displs.data(),
+        _team->dart_id()),
+      DART_OK);
+    const ValueT * recv_values = reinterpret_cast<const ValueT *>(
+                                   recv_buf.data());
+    return std::vector<ValueT>(recv_values, recv_values + nrecv);
+  }
+
+  /**
+   * Unit and local offset of the element with the given key, local offset
+   * is negative if no element with the given key exists.
+   */
+  std::pair<team_unit_t, index_type> _find_lpos(const key_type & key)
+  {
+    auto hash = _index_hash(key);
+    auto lidx = _index_find_local(key, hash);
+    if (lidx >= 0 || _glob_index_lsize == 0) {
+      return std::make_pair(_myid, lidx);
+    }
+    // Probe element index at the unit mapped to the key:
+    team_unit_t owner = _key_hash(key);
+    if (owner != _myid) {
+      lidx = _index_find_remote(owner, key, hash);
+      if (lidx >= 0 || _is_owner_placed(owner)) {
+        return std::make_pair(owner, lidx);
+      }
+    } else if (_is_owner_placed(owner)) {
+      return std::make_pair(owner, lidx);
+    }
+    // Elements mapped to the key's unit are not placed according to the
+    // hash function, probe element indices of units storing such elements:
+    bool hash_local = std::is_same<hasher, HashLocal<key_type>>::value;
+    for (team_unit_t u{0}; u < static_cast<int>(_team->size()); ++u) {
+      if (u == _myid || u == owner ||
+          (!hash_local && _holder_misplaced[u.id] == 0)) {
+        continue;
+      }
+      lidx = _index_find_remote(u, key, hash);
+      if (lidx >= 0) {
+        return std::make_pair(u, lidx);
+      }
+    }
+    return std::make_pair(_myid, lidx);
+  }
+
+  /**
+   * Whether all elements mapped to the given unit by the hash function
+   * are stored at this unit, as of the last commit.
+   */
+  bool _is_owner_placed(team_unit_t unit) const
+  {
+    return !std::is_same<hasher, HashLocal<key_type>>::value &&
+           _owner_misplaced[unit.id] == 0;
+  }
+
+  /**
+   * Number of index slots required for the given number of elements at
+   * a maximum load factor of 1/2.
+   */
+  static size_type _index_capacity(size_type nelem)
+  {
+    size_type nslots = _index_probe_size;
+    while (nslots < 2 * nelem) {
+      nslots *= 2;
+    }
+    return nslots;
+  }
+
+  /**
+   * Add element at given local offset to the local element index.
+   */
+  void _index_insert(size_type hash, index_type lidx)
+  {
+    if (2 * (_local_index_size + _local_index_erased + 1) >
+        _local_index.size()) {
+      _index_rehash(_index_capacity(_local_index_size + 1));
+    }
+    size_type mask = _local_index.size() - 1;
+    size_type slot = hash & mask;
+    while (_local_index[slot].lidx >= 0) {
+      slot = (slot + 1) & mask;
+    }
+    if (_local_index[slot].lidx == _index_slot_erased) {
+      --_local_index_erased;
+    }
+    _local_index[slot].hash = hash;
+    _local_index[slot].lidx = lidx;
+    ++_local_index_size;
+  }
+
+  /**
+   * Position of the slot referencing the element at given local offset
+   * in the local element index.
+   */
+  size_type _index_slot_of(size_type hash, index_type lidx) const
+  {
+    size_type mask = _local_index.size() - 1;
+    size_type slot = hash & mask;
+    while (_local_index[slot].lidx != lidx) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  /**
+   * Rebuild the local element index with the given number of slots.
+   */
+  void _index_rehash(size_type nslots)
+  {
+    DASH_LOG_TRACE("UnorderedMap._index_rehash()",
+                   "slots:", _local_index.size(), "->", nslots);
+    std::vector<index_slot> slots(nslots,
+                                  index_slot { 0, _index_slot_empty });
+    size_type mask = nslots - 1;
+    for (const auto & entry : _local_index) {
+      if (entry.lidx < 0) {
+        continue;
+      }
+      size_type slot = entry.hash & mask;
+      while (slots[slot].lidx >= 0) {
+        slot = (slot + 1) & mask;
+      }
+      slots[slot] = entry;
+    }
+    _local_index.swap(slots);
+    _local_index_erased = 0;
+  }
+
+  /**
+   * Local offset of the element with the given key in the local element
+   * index, or a negative value if the key is not in local memory space.
+   */
+  index_type _index_find_local(
+    const key_type & key,
+    size_type        hash) const
+  {
+    if (_local_index.empty()) {
+      return _index_slot_empty;
+    }
+    auto      l_first = _globmem->lbegin();
+    size_type mask    = _local_index.size() - 1;
+    for (size_type slot = hash & mask;
+         _local_index[slot].lidx != _index_slot_empty;
+         slot = (slot + 1) & mask) {
+      const index_slot & entry = _local_index[slot];
+      if (entry.lidx >= 0 && entry.hash == hash &&
+          _key_equal((*(l_first + entry.lidx)).first, key)) {
+        return entry.lidx;
+      }
+    }
+    return _index_slot_empty;
+  }
+
+  /**
+   * Local offset of the element with the given key in the element index
+   * published by the given unit, or a negative value if the key is not
+   * in the unit's local memory space.
+   */
+  index_type _index_find_remote(
+    team_unit_t      unit,
+    const key_type & key,
+    size_type        hash) const
+  {
+    typedef typename std::aligned_storage<
+                       sizeof(value_type), alignof(value_type)>::type
+      value_buf;
+
+    index_slot slots[_index_probe_size];
+    value_buf  elem_buf;
+    auto       elem  = reinterpret_cast<value_type *>(&elem_buf);
+    auto       g_idx = static_cast<index_type>(unit) * _glob_index_lsize;
+    size_type  mask  = _glob_index_lsize - 1;
+    size_type  slot  = hash & mask;
+    for (size_type nprobed = 0; nprobed < _glob_index_lsize; ) {
+      // Fetch window of consecutive slots, bounded by the end of the
+      // unit's index:
+      size_type nslots = _glob_index_lsize - slot;
+      if (nslots > _index_probe_size) {
+        nslots = _index_probe_size;
+      }
+      DASH_LOG_TRACE("UnorderedMap._index_find_remote",
+                     "unit:", unit, "slot:", slot, "nslots:", nslots);
+      dash::internal::get_blocking(
+        (_glob_index.begin() + (g_idx + slot)).dart_gptr(),
+        slots, nslots);
+      for (size_type s = 0; s < nslots; ++s) {
+        if (slots[s].lidx == _index_slot_empty) {
+          return _index_slot_empty;
+        }
+        if (slots[s].lidx < 0 || slots[s].hash != hash) {
+          continue;
+        }
+        // Fetch candidate element to compare keys:
+        dash::internal::get_blocking(
+          _globmem->at(unit, slots[s].lidx).dart_gptr(),
+          elem, 1);
+        if (_key_equal(elem->first, key)) {
+          return slots[s].lidx;
+        }
+      }
+      nprobed += nslots;
+      slot     = (slot + nslots) & mask;
+    }
+    return _index_slot_empty;
+  }
+
+  /**
+   * Publish local element indices of all units in global memory.
+   *
+   * Collective operation.
+   */
+  void _index_commit()
+  {
+    DASH_LOG_TRACE("UnorderedMap._index_commit()");
+    auto nunits = _team->size();
+    // Number of index slots and misplaced elements of all units:
+    size_type l_misplaced = 0;
+    for (auto nmisplaced : _local_misplaced) {
+      l_misplaced += nmisplaced;
+    }
+    size_type l_state[2] = { _local_index.size(), l_misplaced };
+    std::vector<size_type> g_state(2 * nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        l_state, g_state.data(), 2,
+        dash::dart_datatype<size_type>::value,
+        _team->dart_id()),
+      DART_OK);
+    // Units with elements mapped to them stored at other units:
+    _owner_misplaced = std::vector<size_type>(nunits, 0);
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(
+        _local_misplaced.data(), _owner_misplaced.data(), nunits,
+        dash::dart_datatype<size_type>::value,
+        DART_OP_MAX,
+        _team->dart_id()),
+      DART_OK);
+    // Published indices must have identical size at all units to allow
+    // symmetric allocation:
+    size_type nslots = 0;
+    _holder_misplaced = std::vector<size_type>(nunits);
+    for (size_type u = 0; u < nunits; ++u) {
+      nslots               = std::max(nslots, g_state[2 * u]);
+      _holder_misplaced[u] = g_state[2 * u + 1];
+    }
+    if (nslots != _local_index.size()) {
+      _index_rehash(nslots);
+    }
+    if (nslots != _glob_index_lsize) {
+      if (_glob_index_lsize > 0) {
+        _glob_index.deallocate();
+      }
+      _glob_index.allocate(nslots * _team->size(), dash::BLOCKED, *_team);
+      _glob_index_lsize = nslots;
+    }
+    std::copy(_local_index.begin(), _local_index.end(),
+              _glob_index.lbegin());
+    _glob_index.barrier();
+    DASH_LOG_TRACE("UnorderedMap._index_commit >",
+                   "slots per unit:", nslots,
+                   "misplaced:", l_misplaced);
+  }
+
 }; // class UnorderedMap
 
 #endif // ifndef DOXYGEN
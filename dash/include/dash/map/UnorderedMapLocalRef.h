@@ -269,18 +269,11 @@ public:
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    iterator found = std::find_if(
-                       first, last,
-                       [&](const value_type & v) {
-                         DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                        v.first, "==?", key);
-                         return pred(v.first, key);
-                       });
+    iterator found = end();
+    auto     lidx  = _map->_index_find_local(key, _map->_index_hash(key));
+    if (lidx >= 0) {
+      found = begin() + lidx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalRef.find >", found);
     return found;
   }
@@ -288,18 +281,12 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find() const", key);
-    auto   & first = begin();
-    auto   & last  = end();
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.find()", last);
-    auto     pred  = key_eq();
-    const_iterator found = std::find_if(
-                             first, last,
-                             [&](const value_type & v) {
-                               DASH_LOG_TRACE("UnorderedMapLocalRef.find.eq",
-                                              v.first, "==?", key);
-                               return pred(v.first, key);
-                             });
+    const_iterator found = end();
+    auto           lidx  = _map->_index_find_local(
+                             key, _map->_index_hash(key));
+    if (lidx >= 0) {
+      found = begin() + lidx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalRef.find const >", found);
     return found;
   }
@@ -372,44 +359,62 @@ public:
     }
   }
 
+  /**
+   * Remove the element at the given iterator position.
+   * The last local element is moved to the position of the removed
+   * element.
+   *
+   * \return  Iterator at the position of the removed element.
+   */
   iterator erase(
-    const_iterator it)
+    const_iterator position)
   {
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "iterator:", it);
-    erase(*it.first);
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    DASH_LOG_TRACE("UnorderedMapLocalRef.erase()", "iterator:", position);
+    _map->_erase_local(position.pos());
+    return iterator(_map, position.pos());
   }
 
+  /**
+   * Remove the element with the given key.
+   * The last local element is moved to the position of the removed
+   * element.
+   *
+   * \return  Number of elements removed, 0 or 1.
+   */
   size_type erase(
     /// Key of the container element to remove.
     const key_type & key)
   {
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase()", "key:", key);
-    auto b_idx  = bucket(key);
-    auto b_size = bucket_size(b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_idx);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase", b_size);
-
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMapLocalRef.erase is not implemented.");
-
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase >");
+    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", key);
+    auto lidx = _map->_index_find_local(key, _map->_index_hash(key));
+    if (lidx < 0) {
+      return 0;
+    }
+    _map->_erase_local(lidx);
+    return 1;
   }
 
+  /**
+   * Remove elements in the given iterator range.
+   *
+   * \return  Iterator at the position of the first removed element.
+   */
   iterator erase(
     /// Iterator at first element to remove.
     const_iterator first,
     /// Iterator past the last element to remove.
     const_iterator last)
   {
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last)");
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", first);
-    DASH_LOG_TRACE_VAR("UnorderedMapLocalRef.erase()", last);
+    // Resolve keys before removing any element as removal changes the
+    // order of local memory space:
+    std::vector<key_type> keys;
     for (auto it = first; it != last; ++it) {
-      erase(*it.first);
+      keys.push_back((*it).first);
+    }
+    for (const auto & key : keys) {
+      erase(key);
     }
-    DASH_LOG_DEBUG("UnorderedMapLocalRef.erase(first,last) >");
+    return iterator(_map, first.pos());
   }
 
   //////////////////////////////////////////////////////////////////////////
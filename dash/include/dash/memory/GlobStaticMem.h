@@ -463,6 +463,7 @@ public:
    */
   void flush() noexcept
   {
+    dash::internal::AsyncAggregator::instance().flush_segment(_begptr);
     dart_flush_all(_begptr);
   }
 
@@ -473,6 +474,7 @@ public:
   {
     dart_gptr_t gptr = _begptr;
     gptr.unitid = target.id;
+    dash::internal::AsyncAggregator::instance().flush(gptr);
     dart_flush(gptr);
   }
 
@@ -481,6 +483,7 @@ public:
    */
   void flush_local() noexcept
   {
+    dash::internal::AsyncAggregator::instance().flush_segment(_begptr);
     dart_flush_local_all(_begptr);
   }
 
@@ -492,6 +495,7 @@ public:
   {
     dart_gptr_t gptr = _begptr;
     gptr.unitid = target.id;
+    dash::internal::AsyncAggregator::instance().flush(gptr);
     dart_flush_local(gptr);
   }
 
@@ -353,6 +353,7 @@ public:
    */
   void flush() noexcept
   {
+    dash::internal::AsyncAggregator::instance().flush(_begptr);
     dart_flush(_begptr);
   }
 
@@ -362,16 +363,19 @@ public:
    */
   void flush_all() noexcept
   {
+    dash::internal::AsyncAggregator::instance().flush_segment(_begptr);
     dart_flush_all(_begptr);
   }
 
   void flush_local() noexcept
   {
+    dash::internal::AsyncAggregator::instance().flush(_begptr);
     dart_flush_local(_begptr);
   }
 
   void flush_local_all() noexcept
   {
+    dash::internal::AsyncAggregator::instance().flush_segment(_begptr);
     dart_flush_local_all(_begptr);
   }
 
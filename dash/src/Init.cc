@@ -7,6 +7,7 @@
 #include <dash/util/Locality.h>
 #include <dash/util/Config.h>
 #include <dash/internal/Logging.h>
+#include <dash/internal/AsyncAggregator.h>
 
 #include <dash/internal/Annotation.h>
 
@@ -81,6 +82,9 @@ void dash::finalize()
     return;
   }
 
+  // Complete operations still buffered for aggregation:
+  dash::internal::AsyncAggregator::instance().flush_all();
+
   // Wait for all units:
   dash::barrier();
 
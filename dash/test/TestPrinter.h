@@ -1,15 +1,6 @@
-#ifdef DASH_MPI_IMPL_ID
-
 #ifndef DASH__UTIL__TEST_PRINTER_H_
 #define DASH__UTIL__TEST_PRINTER_H_
 
-#include <gtest/gtest.h>
-
-#include <iostream>
-#include <list>
-
-#include <mpi.h>
-
 #define TEST_NEUTRAL "\033[0;32m[----------] \033[m"
 #define TEST_SUM     "\033[0;32m[==========] \033[m"
 #define TEST_SUCCESS "\033[0;32m[  PASSED  ] \033[m"
@@ -19,6 +10,15 @@
 #define TEST_OK      "\033[0;32m[      OK  ] \033[m"
 #define TEST_RUN     "\033[0;32m[  RUN     ] \033[m"
 
+#ifdef DASH_MPI_IMPL_ID
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <list>
+
+#include <mpi.h>
+
 using ::testing::EmptyTestEventListener;
 using ::testing::InitGoogleTest;
 using ::testing::Test;
@@ -154,6 +154,6 @@ class TestPrinter : public EmptyTestEventListener {
   }
 };
 
-#endif // DASH__UTIL__TEST_PRINTER_H_
-
 #endif // DASH_MPI_IMPL_ID
+
+#endif // DASH__UTIL__TEST_PRINTER_H_
@@ -148,3 +148,30 @@ TEST_F(AccumulateTest, LocalStdIterator) {
 
   ASSERT_EQ_U(((dash::size()-1)*(dash::size())/2) * (1 + 2 + 3)  + 1, result);
 }
+
+TEST_F(AccumulateTest, Async) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  auto value = 2, start = 10;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+
+  dash::fill(target.begin(), target.end(), value);
+
+  auto fut_barrier = dash::Team::All().barrier_async();
+  fut_barrier.wait();
+
+  auto fut_result = dash::accumulate_async(target.begin(),
+                                           target.end(),
+                                           start);
+  int  l_value    = dash::myid() + 1;
+  auto fut_max    = dash::accumulate_async(&l_value,
+                                           std::next(&l_value),
+                                           0,
+                                           dash::max<int>(),
+                                           true);
+
+  while (!fut_result.test()) { }
+  ASSERT_EQ_U(num_elem_total * value + start, fut_result.get());
+  ASSERT_EQ_U(dash::size(), fut_max.get());
+}
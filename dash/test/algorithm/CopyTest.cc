@@ -892,6 +892,124 @@ TEST_F(CopyTest, AsyncGlobalToLocalTest)
   }
 }
 
+TEST_F(CopyTest, BlockingGlobalToGlobalRedistribute)
+{
+  typedef int                                      value_t;
+  typedef typename dash::Array<value_t>::index_type index_t;
+
+  // Underfilled last block in both patterns:
+  size_t num_elem_total = (_dash_size * 11) + 3;
+
+  dash::Array<value_t> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<value_t> array_b(num_elem_total, dash::BLOCKCYCLIC(3));
+
+  const auto & pattern_a = array_a.pattern();
+  const auto & pattern_b = array_b.pattern();
+  for (index_t l = 0; l < static_cast<index_t>(array_a.lsize()); ++l) {
+    array_a.local[l] = pattern_a.global(l);
+  }
+  std::fill(array_b.lbegin(), array_b.lend(), -1);
+  array_a.barrier();
+
+  // Copy entire range:
+  auto out_last = dash::copy(array_a.begin(), array_a.end(),
+                             array_b.begin());
+  EXPECT_EQ_U(array_b.end(), out_last);
+  array_b.barrier();
+
+  for (index_t l = 0; l < static_cast<index_t>(array_b.lsize()); ++l) {
+    EXPECT_EQ_U(pattern_b.global(l), array_b.local[l]);
+  }
+  for (index_t g = 0; g < static_cast<index_t>(num_elem_total); ++g) {
+    EXPECT_EQ_U(g, static_cast<value_t>(array_b[g]));
+  }
+  array_b.barrier();
+
+  // Copy subrange to different offset in output range:
+  index_t in_offset  = 5;
+  index_t out_offset = 2;
+  index_t num_copy   = num_elem_total - 2 * in_offset;
+  std::fill(array_b.lbegin(), array_b.lend(), -1);
+  array_b.barrier();
+
+  out_last = dash::copy(array_a.begin() + in_offset,
+                        array_a.begin() + in_offset + num_copy,
+                        array_b.begin() + out_offset);
+  EXPECT_EQ_U(array_b.begin() + out_offset + num_copy, out_last);
+  array_b.barrier();
+
+  for (index_t l = 0; l < static_cast<index_t>(array_b.lsize()); ++l) {
+    index_t g        = pattern_b.global(l);
+    value_t expected = (g >= out_offset && g < out_offset + num_copy)
+                       ? g - out_offset + in_offset
+                       : -1;
+    EXPECT_EQ_U(expected, array_b.local[l]);
+  }
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalTiles)
+{
+  typedef int                                                   value_t;
+  typedef dash::TilePattern<2>                                  pattern_t;
+  typedef dash::Matrix<value_t, 2, dash::default_index_t, pattern_t>
+                                                                tile_matrix_t;
+  typedef dash::Matrix<value_t, 2>                              block_matrix_t;
+  typedef typename pattern_t::index_type                        index_t;
+
+  size_t tilesize_x = 2;
+  size_t tilesize_y = 3;
+  size_t extent_x   = tilesize_x * (_dash_size + 1);
+  size_t extent_y   = tilesize_y * (_dash_size + 2);
+
+  dash::SizeSpec<2> sizespec(extent_x, extent_y);
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+
+  block_matrix_t matrix_a(sizespec,
+                          dash::DistributionSpec<2>(dash::BLOCKED,
+                                                    dash::NONE));
+  tile_matrix_t  matrix_b(pattern_t(sizespec,
+                                    dash::DistributionSpec<2>(
+                                      dash::TILE(tilesize_x),
+                                      dash::TILE(tilesize_y)),
+                                    teamspec));
+
+  const auto & pattern_a = matrix_a.pattern();
+  const auto & pattern_b = matrix_b.pattern();
+  for (index_t l = 0; l < static_cast<index_t>(matrix_a.local_size());
+       ++l) {
+    matrix_a.lbegin()[l] = pattern_a.global(l);
+  }
+  std::fill(matrix_b.lbegin(), matrix_b.lend(), -1);
+  matrix_a.barrier();
+
+  // Redistribute row blocks to tiles:
+  dash::copy(matrix_a.begin(), matrix_a.end(), matrix_b.begin());
+  matrix_b.barrier();
+
+  for (index_t l = 0; l < static_cast<index_t>(matrix_b.local_size());
+       ++l) {
+    EXPECT_EQ_U(pattern_b.global(l), matrix_b.lbegin()[l]);
+  }
+  matrix_b.barrier();
+
+  // Redistribute tiles back to row blocks:
+  std::fill(matrix_a.lbegin(), matrix_a.lend(), -1);
+  matrix_a.barrier();
+
+  dash::copy(matrix_b.begin(), matrix_b.end(), matrix_a.begin());
+  matrix_a.barrier();
+
+  for (index_t l = 0; l < static_cast<index_t>(matrix_a.local_size());
+       ++l) {
+    index_t g = pattern_a.global(l);
+    // Skip elements in underfilled last block:
+    if (g < static_cast<index_t>(matrix_a.size())) {
+      EXPECT_EQ_U(g, matrix_a.lbegin()[l]);
+    }
+  }
+}
+
 #if 0
 // TODO
 TEST_F(CopyTest, AsyncAllToLocalVector)
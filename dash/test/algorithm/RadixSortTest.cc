@@ -0,0 +1,136 @@
+#include "RadixSortTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/RadixSort.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+/**
+ * Sorts the global range with dash::radix_sort and validates the result
+ * against std::stable_sort of the gathered input at unit 0.
+ */
+template <typename GlobIter, typename KeyFunc>
+static void perform_test(GlobIter begin, GlobIter end, KeyFunc key)
+{
+  using value_t = typename GlobIter::value_type;
+
+  auto const n = dash::distance(begin, end);
+
+  std::vector<value_t> expected(n);
+  if (dash::myid() == 0) {
+    dash::copy(begin, end, expected.data());
+    std::stable_sort(
+        expected.begin(),
+        expected.end(),
+        [&key](value_t const& a, value_t const& b) {
+          return key(a) < key(b);
+        });
+  }
+  begin.pattern().team().barrier();
+
+  dash::radix_sort(begin, end, key);
+
+  if (dash::myid() == 0) {
+    std::vector<value_t> result(n);
+    dash::copy(begin, end, result.data());
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ_U(key(expected[i]), key(result[i]));
+      ASSERT_EQ_U(0, std::memcmp(&expected[i], &result[i], sizeof(value_t)));
+    }
+  }
+  begin.pattern().team().barrier();
+}
+
+TEST_F(RadixSortTest, ArrayOfInts)
+{
+  dash::Array<int> arr(num_local_elem * dash::size());
+
+  std::mt19937                       generator(dash::myid());
+  std::uniform_int_distribution<int> distribution(-1E6, 1E6);
+  std::generate(arr.lbegin(), arr.lend(), [&]() {
+    return distribution(generator);
+  });
+  arr.barrier();
+
+  perform_test(arr.begin(), arr.end(), [](int v) { return v; });
+}
+
+TEST_F(RadixSortTest, ArrayOfDoubles)
+{
+  dash::Array<double> arr(num_local_elem * dash::size());
+
+  std::mt19937                           generator(dash::myid());
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::generate(arr.lbegin(), arr.lend(), [&]() {
+    return distribution(generator) * std::pow(10.0, distribution(generator));
+  });
+  if (dash::myid() == 0) {
+    arr.local[0] = std::numeric_limits<double>::max();
+    arr.local[1] = std::numeric_limits<double>::lowest();
+    arr.local[2] = -0.0;
+  }
+  arr.barrier();
+
+  perform_test(arr.begin(), arr.end(), [](double v) { return v; });
+
+  dash::radix_sort(arr.begin(), arr.end());
+}
+
+TEST_F(RadixSortTest, ArrayBlockedPartialRange)
+{
+  dash::Array<uint64_t> arr(num_local_elem * dash::size());
+
+  std::mt19937_64 generator(dash::myid());
+  std::generate(arr.lbegin(), arr.lend(), [&]() { return generator(); });
+  arr.barrier();
+
+  auto begin = arr.begin() + num_local_elem / 2;
+  auto end   = arr.end() - num_local_elem / 2;
+
+  perform_test(begin, end, [](uint64_t v) { return v; });
+}
+
+TEST_F(RadixSortTest, ArrayEmptyLocalRange)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+  // only the first unit holds elements of the sorted range
+  dash::Array<int16_t> arr(num_local_elem * dash::size());
+
+  std::mt19937 generator(dash::myid());
+  std::generate(arr.lbegin(), arr.lend(), [&]() {
+    return static_cast<int16_t>(generator());
+  });
+  arr.barrier();
+
+  perform_test(
+      arr.begin(), arr.begin() + num_local_elem, [](int16_t v) { return v; });
+}
+
+TEST_F(RadixSortTest, StableByKey)
+{
+  struct pair_t {
+    int32_t key;
+    int32_t pos;
+  };
+
+  dash::Array<pair_t> arr(num_local_elem * dash::size());
+
+  // few distinct keys, the position has to be preserved among equal keys
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    auto gidx    = arr.pattern().global(l);
+    arr.local[l] = pair_t{static_cast<int32_t>((gidx * 7919) % 13) - 6,
+                          static_cast<int32_t>(gidx)};
+  }
+  arr.barrier();
+
+  perform_test(
+      arr.begin(), arr.end(), [](pair_t const& p) { return p.key; });
+}
@@ -0,0 +1,118 @@
+
+#include <gtest/gtest.h>
+
+#include "../TestBase.h"
+#include "ScanTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Scan.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+
+TEST_F(ScanTest, InclusivePlus) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  dash::Array<int> in(num_elem_total, dash::BLOCKED);
+  dash::Array<int> out(num_elem_total, dash::BLOCKED);
+
+  for (size_t l = 0; l < in.lsize(); ++l) {
+    in.local[l] = in.pattern().global(l) + 1;
+  }
+  in.barrier();
+
+  auto out_end = dash::inclusive_scan(in.begin(), in.end(), out.begin());
+  EXPECT_EQ_U(out.end(), out_end);
+
+  out.barrier();
+
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    int n = out.pattern().global(l) + 1;
+    EXPECT_EQ_U(n * (n + 1) / 2, out.local[l]);
+  }
+}
+
+TEST_F(ScanTest, ExclusivePlusInPlace) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  int    init                 = 10;
+
+  dash::Array<int> arr(num_elem_total, dash::BLOCKED);
+
+  std::fill(arr.lbegin(), arr.lend(), 2);
+  arr.barrier();
+
+  dash::exclusive_scan(arr.begin(), arr.end(), arr.begin(), init);
+
+  arr.barrier();
+
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    int gidx = arr.pattern().global(l);
+    EXPECT_EQ_U(init + 2 * gidx, arr.local[l]);
+  }
+}
+
+TEST_F(ScanTest, EmptyUnits) {
+  if (_dash_size < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+  // only the first half of the units holds elements
+  size_t num_elem_total = _dash_size / 2 * 10;
+
+  dash::Array<int> arr(num_elem_total,
+                       dash::BLOCKCYCLIC(10));
+
+  std::fill(arr.lbegin(), arr.lend(), 1);
+  arr.barrier();
+
+  // non-predefined reduction in the presence of empty ranges
+  dash::exclusive_scan(arr.begin(), arr.end(), arr.begin(), 0,
+                       [](int a, int b) { return a + b; });
+  arr.barrier();
+
+  for (size_t l = 0; l < arr.lsize(); ++l) {
+    EXPECT_EQ_U(arr.pattern().global(l), arr.local[l]);
+  }
+}
+
+TEST_F(ScanTest, InclusiveNonCommutative) {
+  const size_t num_elem_local = 3;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+
+  using value_t = std::array<char, 16>;
+
+  dash::Array<value_t> in(num_elem_total, dash::BLOCKED);
+  dash::Array<value_t> out(num_elem_total, dash::BLOCKED);
+
+  // each element holds its global index as a one-digit string, the
+  // concatenation is associative but not commutative
+  for (size_t l = 0; l < in.lsize(); ++l) {
+    value_t v{};
+    v[0] = '0' + (in.pattern().global(l) % 10);
+    in.local[l] = v;
+  }
+  in.barrier();
+
+  auto concat = [](const value_t & a, const value_t & b) {
+    value_t res{};
+    std::string s = std::string(a.data()) + std::string(b.data());
+    std::copy_n(s.begin(), std::min<size_t>(s.size(), res.size() - 1),
+                res.begin());
+    return res;
+  };
+
+  dash::inclusive_scan(in.begin(), in.end(), out.begin(), concat);
+  out.barrier();
+
+  for (size_t l = 0; l < out.lsize(); ++l) {
+    size_t      gidx = out.pattern().global(l);
+    std::string exp;
+    for (size_t i = 0; i <= gidx && exp.size() < 15; ++i) {
+      exp += static_cast<char>('0' + (i % 10));
+    }
+    EXPECT_EQ_U(exp, std::string(out.local[l].data()));
+  }
+}
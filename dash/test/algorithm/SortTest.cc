@@ -429,5 +429,47 @@ TEST_F(SortTest, ExtremValues)
   perform_test(arr.begin(), arr.end());
 }
 
+TEST_F(SortTest, LocalMultiThreaded)
+{
+  // explicit thread count to cover the threaded node-local phases
+  // independent of the cores available to this unit
+  const int    n_threads = 4;
+  const size_t n_elem    = n_threads * PSORT_MIN_ELEM_PER_THREAD + 17;
+
+  std::mt19937                       generator(dash::myid());
+  std::uniform_int_distribution<int> distribution(-1E6, 1E6);
+
+  std::vector<int> vec(n_elem);
+  std::generate(
+      vec.begin(), vec.end(), [&]() { return distribution(generator); });
+  auto expected = vec;
+  std::sort(expected.begin(), expected.end());
+
+  dash::detail::psort__local_sort(
+      vec.begin(), vec.end(), std::less<int>(), n_threads);
+  EXPECT_TRUE_U(vec == expected);
+
+  // sorted runs of different length, including empty runs
+  std::vector<size_t> run_displs{0, 0, 100, 5000, 5000, n_elem / 2, n_elem};
+  std::generate(
+      vec.begin(), vec.end(), [&]() { return distribution(generator); });
+  for (size_t r = 0; r + 1 < run_displs.size(); ++r) {
+    std::sort(vec.begin() + run_displs[r], vec.begin() + run_displs[r + 1]);
+  }
+  expected = vec;
+  std::sort(expected.begin(), expected.end());
+
+  std::vector<int> merged(n_elem);
+  dash::detail::psort__merge_local_runs(
+      vec.begin(), run_displs, merged.begin(), std::less<int>());
+  EXPECT_TRUE_U(merged == expected);
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::detail::psort__parallel_merge_runs(
+      vec.begin(), run_displs, std::less<int>(), n_threads);
+  EXPECT_TRUE_U(vec == expected);
+#endif
+}
+
 // TODO: add additional unit tests with various pattern types and containers
 //
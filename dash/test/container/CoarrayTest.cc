@@ -9,6 +9,7 @@
 #include <dash/util/TeamLocality.h>
 
 // for std::lock_guard
+#include <array>
 #include <mutex>
 #include <thread>
 #include <random>
@@ -528,6 +529,33 @@ TEST_F(CoarrayTest, CoEvent)
   }
 }
 
+TEST_F(CoarrayTest, CoEventWaitAnyAll)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+  std::array<dash::Coevent, 2> events;
+  const int num_senders = num_images() - 1;
+
+  if(this_image() != 0){
+    events[1](0).post();
+  } else {
+    auto it = wait_any(events.begin(), events.end());
+    ASSERT_EQ_U(events.begin() + 1, it);
+    events[1].wait(num_senders - 1);
+  }
+  dash::barrier();
+
+  events[0](0).post();
+  events[1](0).post();
+  if(this_image() == 0){
+    wait_all(events.begin(), events.end(), num_images());
+    ASSERT_EQ_U(0, events[0].test());
+    ASSERT_EQ_U(0, events[1].test());
+  }
+  dash::barrier();
+}
+
 TEST_F(CoarrayTest, CoEventIter)
 {
   if(num_images() < 3){
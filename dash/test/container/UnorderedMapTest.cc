@@ -543,3 +543,342 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, RemoteLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type myid           = dash::myid().id;
+  size_type local_elements = 20;
+
+  // Small local buffer size to enforce reallocation and growth of the
+  // element index:
+  map_t map(0, 4);
+
+  // Insert elements at their hash unit:
+  for (size_type li = 0; li < local_elements; ++li) {
+    key_t     key    = (nunits * li) + myid;
+    mapped_t  mapped = 1000 * myid + li;
+    map_value value({ key, mapped });
+    EXPECT_TRUE_U(map.local.insert(value).second);
+    EXPECT_EQ_U(map.local.begin() + li, map.local.find(key));
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+
+  // Look up elements of all units, only requires probing the hash unit:
+  for (size_type li = 0; li < local_elements; ++li) {
+    for (size_type unit = 0; unit < nunits; ++unit) {
+      key_t     key    = (nunits * li) + unit;
+      mapped_t  mapped = 1000 * unit + li;
+      map_value expect({ key, mapped });
+
+      auto found = map.find(key);
+      ASSERT_NE_U(map.end(), found);
+      map_value actual = *found;
+      EXPECT_EQ_U(expect, actual);
+      EXPECT_EQ_U(unit, found.lpos().unit.id);
+      EXPECT_EQ_U(li,   found.lpos().index);
+      EXPECT_EQ_U(1,    map.count(key));
+    }
+  }
+  // Keys not contained in the map:
+  for (size_type li = local_elements; li < 2 * local_elements; ++li) {
+    key_t key = (nunits * li) + myid;
+    EXPECT_EQ_U(map.end(), map.find(key));
+    EXPECT_EQ_U(0,         map.count(key));
+  }
+
+  // Insert element at a unit different from its hash unit, lookups of
+  // keys mapped to the same unit must probe units storing such elements:
+  key_t     key_misplaced = (nunits * (local_elements + myid)) +
+                            ((myid + 1) % nunits);
+  map_value value_misplaced({ key_misplaced, 1.0 * myid });
+  EXPECT_TRUE_U(map.insert(value_misplaced).second);
+  map.barrier();
+
+  for (size_type unit = 0; unit < nunits; ++unit) {
+    key_t     key = (nunits * (local_elements + unit)) +
+                    ((unit + 1) % nunits);
+    map_value expect({ key, 1.0 * unit });
+    auto found = map.find(key);
+    ASSERT_NE_U(map.end(), found);
+    map_value actual = *found;
+    EXPECT_EQ_U(expect, actual);
+    EXPECT_EQ_U(unit, found.lpos().unit.id);
+  }
+}
+
+TEST_F(UnorderedMapTest, MisplacedLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type myid           = dash::myid().id;
+  size_type local_elements = 10;
+
+  if (nunits < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  map_t map(0, 4);
+
+  for (size_type li = 0; li < local_elements; ++li) {
+    key_t     key    = (nunits * li) + myid;
+    map_value value({ key, 1.0 * li });
+    EXPECT_TRUE_U(map.local.insert(value).second);
+  }
+  // Only unit 0 inserts an element mapped to unit 1:
+  key_t key_misplaced = (nunits * local_elements) + 1;
+  if (myid == 0) {
+    map_value value_misplaced({ key_misplaced, -1.0 });
+    EXPECT_TRUE_U(map.insert(value_misplaced).second);
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements + 1, map.size());
+  auto found = map.find(key_misplaced);
+  ASSERT_NE_U(map.end(), found);
+  EXPECT_EQ_U(0, found.lpos().unit.id);
+  for (size_type unit = 0; unit < nunits; ++unit) {
+    for (size_type li = 0; li < local_elements; ++li) {
+      key_t key = (nunits * li) + unit;
+      found = map.find(key);
+      ASSERT_NE_U(map.end(), found);
+      EXPECT_EQ_U(unit, found.lpos().unit.id);
+      EXPECT_EQ_U(li,   found.lpos().index);
+    }
+    // Missing keys mapped to units with and without misplaced elements:
+    key_t key_missing = (nunits * (local_elements + 1)) + unit;
+    EXPECT_EQ_U(map.end(), map.find(key_missing));
+  }
+  map.barrier();
+
+  // Removing the misplaced element restores placement by the hash
+  // function:
+  if (myid == 0) {
+    EXPECT_EQ_U(1, map.erase(key_misplaced));
+  }
+  map.barrier();
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  EXPECT_EQ_U(map.end(), map.find(key_misplaced));
+}
+
+TEST_F(UnorderedMapTest, BatchInsertFind)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type myid           = dash::myid().id;
+  size_type local_elements = 50;
+
+  map_t map(0, 4);
+
+  // Every unit inserts keys mapped to all units, half of the keys are
+  // also inserted by the next unit:
+  std::vector<map_value> values;
+  for (size_type li = 0; li < local_elements; ++li) {
+    key_t key = (li < local_elements / 2)
+                ? 1000 * myid + li
+                : 1000 * ((myid + 1) % nunits) + li - (local_elements / 2);
+    values.push_back(map_value(key, 1.0 * key));
+  }
+  map.insert_batch(values.begin(), values.end());
+
+  EXPECT_EQ_U(nunits * (local_elements / 2), map.size());
+
+  // Elements are stored at their hash unit:
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value elem = *lit;
+    EXPECT_EQ_U(myid, elem.first % nunits);
+  }
+
+  // Look up inserted keys and keys not contained in the map:
+  std::vector<key_t> keys;
+  for (size_type li = 0; li < local_elements; ++li) {
+    keys.push_back(1000 * ((myid + li) % nunits) + li);
+  }
+  auto found = map.find_batch(keys.begin(), keys.end());
+  ASSERT_EQ_U(keys.size(), found.size());
+  for (size_type li = 0; li < local_elements; ++li) {
+    auto key = keys[li];
+    if (li < local_elements / 2) {
+      ASSERT_NE_U(map.end(), found[li]);
+      map_value expect(key, 1.0 * key);
+      map_value actual = *found[li];
+      EXPECT_EQ_U(expect, actual);
+      EXPECT_EQ_U(key % nunits, found[li].lpos().unit.id);
+      EXPECT_EQ_U(map.find(key), found[li]);
+    } else {
+      EXPECT_EQ_U(map.end(), found[li]);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, BatchSingleUnit)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type myid           = dash::myid().id;
+  size_type local_elements = 10;
+
+  map_t map(0, 4);
+
+  // Only unit 0 inserts, looks up and erases elements, other units take
+  // part in the collective operations without sending any values:
+  std::vector<map_value> values;
+  std::vector<key_t>     keys;
+  if (myid == 0) {
+    for (size_type li = 0; li < local_elements; ++li) {
+      for (size_type unit = 0; unit < nunits; ++unit) {
+        key_t key = (nunits * li) + unit;
+        values.push_back(map_value(key, 1.0 * key));
+        keys.push_back(key);
+      }
+    }
+  }
+  map.insert_batch(values.begin(), values.end());
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  EXPECT_EQ_U(local_elements, map.lsize());
+
+  auto found = map.find_batch(keys.begin(), keys.end());
+  ASSERT_EQ_U(keys.size(), found.size());
+  for (size_type k = 0; k < keys.size(); ++k) {
+    ASSERT_NE_U(map.end(), found[k]);
+    map_value expect(keys[k], 1.0 * keys[k]);
+    map_value actual = *found[k];
+    EXPECT_EQ_U(expect, actual);
+    EXPECT_EQ_U(keys[k] % nunits, found[k].lpos().unit.id);
+  }
+
+  if (myid == 0) {
+    for (auto key : keys) {
+      EXPECT_EQ_U(1, map.erase(key));
+    }
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(0, map.size());
+  EXPECT_EQ_U(0, map.lsize());
+}
+
+TEST_F(UnorderedMapTest, EraseCompact)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type myid           = dash::myid().id;
+  size_type local_elements = 40;
+
+  // Small local buffer size to allocate multiple buckets:
+  map_t map(0, 4);
+
+  for (size_type li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + myid;
+    EXPECT_TRUE_U(map.local.insert(map_value(key, 1.0 * key)).second);
+  }
+  map.barrier();
+  size_type lcap_full = map.lcapacity();
+
+  // Erase local elements with even local index:
+  for (size_type li = 0; li < local_elements; li += 2) {
+    key_t key = (nunits * li) + myid;
+    EXPECT_EQ_U(1, map.local.erase(key));
+    EXPECT_EQ_U(0, map.local.erase(key));
+    EXPECT_EQ_U(map.local.end(), map.local.find(key));
+    EXPECT_EQ_U(0, map.local.count(key));
+  }
+  EXPECT_EQ_U(local_elements / 2, map.lsize());
+  // Removal of local elements is immediately visible to the local unit:
+  for (auto lit = map.local.begin(); lit != map.local.end(); ++lit) {
+    map_value elem = *lit;
+    EXPECT_EQ_U(myid, elem.first % nunits);
+    EXPECT_EQ_U(1,    ((elem.first - myid) / nunits) % 2);
+    EXPECT_EQ_U(lit,  map.local.find(elem.first));
+  }
+  map.barrier();
+  EXPECT_EQ_U(nunits * (local_elements / 2), map.size());
+
+  // Erase element with local index 1 at next unit:
+  size_type next_unit  = (myid + 1) % nunits;
+  key_t     key_remote = nunits + next_unit;
+  EXPECT_EQ_U(1, map.erase(key_remote));
+  map.barrier();
+  EXPECT_EQ_U(nunits * ((local_elements / 2) - 1), map.size());
+  EXPECT_EQ_U((local_elements / 2) - 1,            map.lsize());
+  EXPECT_EQ_U(map.end(), map.find(key_remote));
+  EXPECT_EQ_U(0,         map.erase(key_remote));
+
+  // Erase all but the last local element by iterator:
+  while (map.lsize() > 1) {
+    map.local.erase(map.local.begin());
+  }
+  map.compact();
+  EXPECT_EQ_U(nunits, map.size());
+  EXPECT_EQ_U(1,      map.lsize());
+  EXPECT_LT_U(map.lcapacity(), lcap_full);
+  EXPECT_LE_U(map.lsize(),     map.lcapacity());
+
+  // Remaining elements are found at all units:
+  for (size_type unit = 0; unit < nunits; ++unit) {
+    map_value expect = *(map.begin() + unit);
+    auto      found  = map.find(expect.first);
+    ASSERT_NE_U(map.end(), found);
+    map_value actual = *found;
+    EXPECT_EQ_U(expect, actual);
+    EXPECT_EQ_U(unit,   found.lpos().unit.id);
+  }
+
+  // Map remains usable after compaction:
+  key_t key_new = (nunits * 1000) + myid;
+  EXPECT_TRUE_U(map.local.insert(map_value(key_new, 1.0)).second);
+  map.barrier();
+  EXPECT_EQ_U(2 * nunits, map.size());
+  EXPECT_NE_U(map.end(), map.find((nunits * 1000) + next_unit));
+  map.barrier();
+
+  // Erase all elements at next unit by iterator, remote elements remain
+  // visible until the next commit:
+  size_type nerased = 0;
+  for (auto it = map.begin(); it != map.end();) {
+    if (it.lpos().unit.id == next_unit) {
+      it = map.erase(it);
+      ++nerased;
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ_U(2, nerased);
+  map.barrier();
+  EXPECT_EQ_U(0, map.size());
+  EXPECT_EQ_U(0, map.lsize());
+}
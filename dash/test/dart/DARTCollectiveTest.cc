@@ -3,6 +3,8 @@
 
 #include <dash/dart/if/dart.h>
 
+#include <array>
+
 
 TEST_F(DARTCollectiveTest, Send_Recv) {
   // we need an even amount of participating units
@@ -182,3 +184,245 @@ TEST_F(DARTCollectiveTest, MaxElementAt) {
   dart_op_destroy(&new_op);
 
 }
+
+TEST_F(DARTCollectiveTest, Alltoall) {
+
+  using elem_t = int;
+  const size_t nelem = 3;
+  const size_t nunits = dash::size();
+  const elem_t myid   = dash::myid();
+
+  // Block sent to unit u: [ (myid * 100) + (u * 10) + e ]
+  std::vector<elem_t> sendbuf(nunits * nelem);
+  std::vector<elem_t> recvbuf(nunits * nelem, -1);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      sendbuf[u * nelem + e] = (myid * 100) + (u * 10) + e;
+    }
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoall(
+      sendbuf.data(),                       // send buffer
+      recvbuf.data(),                       // receive buffer
+      nelem,                                // values per unit
+      dash::dart_datatype<elem_t>::value,   // data type
+      dash::Team::All().dart_id()           // team
+      ));
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      EXPECT_EQ_U((u * 100) + (myid * 10) + e, recvbuf[u * nelem + e]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, Alltoallv) {
+
+  using elem_t = int;
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+
+  // Unit i sends (i + u) % 3 values to unit u:
+  std::vector<size_t> nsend(nunits), senddispls(nunits);
+  std::vector<size_t> nrecv(nunits), recvdispls(nunits);
+  size_t nsend_total = 0;
+  size_t nrecv_total = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    nsend[u]       = (myid + u) % 3;
+    senddispls[u]  = nsend_total;
+    nsend_total   += nsend[u];
+    nrecv[u]       = (u + myid) % 3;
+    recvdispls[u]  = nrecv_total;
+    nrecv_total   += nrecv[u];
+  }
+  std::vector<elem_t> sendbuf(nsend_total);
+  std::vector<elem_t> recvbuf(nrecv_total, -1);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nsend[u]; ++e) {
+      sendbuf[senddispls[u] + e] = (myid * 100) + (u * 10) + e;
+    }
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoallv(
+      sendbuf.data(),                       // send buffer
+      nsend.data(),                         // values sent to each unit
+      senddispls.data(),                    // send displacements
+      dash::dart_datatype<elem_t>::value,   // data type
+      recvbuf.data(),                       // receive buffer
+      nrecv.data(),                         // values received from units
+      recvdispls.data(),                    // receive displacements
+      dash::Team::All().dart_id()           // team
+      ));
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nrecv[u]; ++e) {
+      EXPECT_EQ_U((u * 100) + (myid * 10) + e,
+                  recvbuf[recvdispls[u] + e]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, AlltoallInPlace) {
+
+  using elem_t = int;
+  const size_t nelem = 2;
+  const size_t nunits = dash::size();
+  const elem_t myid   = dash::myid();
+
+  std::vector<elem_t> buf(nunits * nelem);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      buf[u * nelem + e] = (myid * 100) + (u * 10) + e;
+    }
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoall(
+      buf.data(), buf.data(), nelem,
+      dash::dart_datatype<elem_t>::value,
+      dash::Team::All().dart_id()));
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < nelem; ++e) {
+      EXPECT_EQ_U((u * 100) + (myid * 10) + e, buf[u * nelem + e]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, AlltoallvInPlace) {
+
+  using elem_t = int;
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+
+  // Units i and u exchange (i + u) % 3 values in both directions:
+  std::vector<size_t> ncounts(nunits), displs(nunits);
+  size_t ntotal = 0;
+  for (size_t u = 0; u < nunits; ++u) {
+    ncounts[u]  = (myid + u) % 3;
+    displs[u]   = ntotal;
+    ntotal     += ncounts[u];
+  }
+  std::vector<elem_t> buf(ntotal);
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < ncounts[u]; ++e) {
+      buf[displs[u] + e] = (myid * 100) + (u * 10) + e;
+    }
+  }
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoallv(
+      buf.data(), nullptr, nullptr,
+      dash::dart_datatype<elem_t>::value,
+      buf.data(), ncounts.data(), displs.data(),
+      dash::Team::All().dart_id()));
+
+  for (size_t u = 0; u < nunits; ++u) {
+    for (size_t e = 0; e < ncounts[u]; ++e) {
+      EXPECT_EQ_U((u * 100) + (myid * 10) + e, buf[displs[u] + e]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, AlltoallvEmptySender) {
+
+  using elem_t = int;
+  const size_t nunits = dash::size();
+  const size_t myid   = dash::myid();
+
+  // Unit 0 does not send any values and passes no send buffer, all other
+  // units send one value to every unit:
+  std::vector<size_t> nsend(nunits, (myid == 0) ? 0 : 1);
+  std::vector<size_t> senddispls(nunits);
+  std::vector<size_t> nrecv(nunits, 1);
+  std::vector<size_t> recvdispls(nunits);
+  std::vector<elem_t> sendbuf;
+  for (size_t u = 0; u < nunits; ++u) {
+    senddispls[u] = (myid == 0) ? 0 : u;
+    recvdispls[u] = u;
+    if (myid != 0) {
+      sendbuf.push_back((myid * 100) + u);
+    }
+  }
+  nrecv[0] = 0;
+  std::vector<elem_t> recvbuf(nunits, -1);
+  ASSERT_EQ_U(DART_OK,
+    dart_alltoallv(
+      (myid == 0) ? nullptr : sendbuf.data(),
+      nsend.data(), senddispls.data(),
+      dash::dart_datatype<elem_t>::value,
+      recvbuf.data(), nrecv.data(), recvdispls.data(),
+      dash::Team::All().dart_id()));
+
+  EXPECT_EQ_U(-1, recvbuf[0]);
+  for (size_t u = 1; u < nunits; ++u) {
+    EXPECT_EQ_U((u * 100) + myid, recvbuf[u]);
+  }
+}
+
+TEST_F(DARTCollectiveTest, NonBlockingCollectives) {
+
+  using elem_t = int;
+  const size_t nunits = dash::size();
+  const elem_t myid   = dash::myid();
+  auto         team   = dash::Team::All().dart_id();
+  auto         dtype  = dash::dart_datatype<elem_t>::value;
+
+  dart_handle_t handles[4];
+
+  elem_t bcast_val = (myid == 0) ? 42 : -1;
+  ASSERT_EQ_U(DART_OK,
+    dart_ibcast(&bcast_val, 1, dtype, dart_team_unit_t{0}, team,
+                &handles[0]));
+
+  std::vector<elem_t> gathered(nunits, -1);
+  ASSERT_EQ_U(DART_OK,
+    dart_iallgather(&myid, gathered.data(), 1, dtype, team, &handles[1]));
+
+  elem_t sum = 0;
+  ASSERT_EQ_U(DART_OK,
+    dart_iallreduce(&myid, &sum, 1, dtype, DART_OP_SUM, team, &handles[2]));
+
+  ASSERT_EQ_U(DART_OK, dart_ibarrier(team, &handles[3]));
+
+  // test until the barrier completed
+  int32_t flag = 0;
+  while (!flag) {
+    ASSERT_EQ_U(DART_OK, dart_test(&handles[3], &flag));
+  }
+  EXPECT_EQ_U(DART_HANDLE_NULL, handles[3]);
+
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles, 3));
+
+  EXPECT_EQ_U(42, bcast_val);
+  for (size_t u = 0; u < nunits; ++u) {
+    EXPECT_EQ_U(u, gathered[u]);
+  }
+  EXPECT_EQ_U((nunits * (nunits - 1)) / 2, sum);
+}
+
+TEST_F(DARTCollectiveTest, Exscan) {
+
+  using elem_t = int;
+  const elem_t myid = dash::myid();
+
+  std::array<elem_t, 2> send{{myid, 1}};
+  std::array<elem_t, 2> recv{{-1, -1}};
+
+  ASSERT_EQ_U(DART_OK,
+    dart_exscan(send.data(), recv.data(), send.size(),
+                dash::dart_datatype<elem_t>::value, DART_OP_SUM,
+                dash::Team::All().dart_id()));
+
+  if (myid > 0) {
+    EXPECT_EQ_U((myid * (myid - 1)) / 2, recv[0]);
+    EXPECT_EQ_U(myid, recv[1]);
+  }
+
+  // in-place
+  elem_t val = myid + 1;
+  ASSERT_EQ_U(DART_OK,
+    dart_exscan(&val, &val, 1, dash::dart_datatype<elem_t>::value,
+                DART_OP_MAX, dash::Team::All().dart_id()));
+  if (myid > 0) {
+    EXPECT_EQ_U(myid, val);
+  }
+}
@@ -1,8 +1,14 @@
 #include "DARTLockTest.h"
 
 #include <dash/Shared.h>
+#include <dash/SharedMutex.h>
 #include <dash/dart/if/dart.h>
 
+#include <mutex>
+#if __cplusplus >= 201402L
+#include <shared_mutex>
+#endif
+
 
 TEST_F(DARTLockTest, LockUnlockDoNothing) {
   using value_t = int;
@@ -234,3 +240,130 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, RWLockShared) {
+  dart_rwlock_t lock;
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  // all units hold the lock in shared mode at the same time
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_acquire_shared(lock));
+  dash::barrier();
+
+  int32_t acquired;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_try_acquire_shared(lock, &acquired));
+  ASSERT_EQ_U(1, acquired);
+  if (dash::myid() == 0) {
+    // readers are active
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_try_acquire(lock, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_release_shared(lock));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_rwlock_release_shared(lock));
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_rwlock_release_shared(lock));
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, RWLockExclusive) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dart_rwlock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_init(DART_TEAM_ALL, &lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_acquire(lock));
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release(lock));
+
+    int32_t acquired;
+    do {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_rwlock_try_acquire(lock, &acquired));
+    } while (!acquired);
+    shared.set(shared.get() + 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_rwlock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(2 * num_iterations * dash::size(),
+              static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_rwlock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, SharedMutex) {
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  // two values that are only ever modified together by writers
+  dash::Shared<value_t> first;
+  dash::Shared<value_t> second;
+  dash::SharedMutex mx;
+
+  if (dash::myid() == 0) {
+    first.set(0);
+    second.set(0);
+  }
+  dash::barrier();
+
+  for (int i = 0; i < num_iterations; ++i) {
+    {
+      std::lock_guard<dash::SharedMutex> lg(mx);
+      first.set(first.get() + 1);
+      second.set(second.get() + 1);
+    }
+    {
+#if __cplusplus >= 201402L
+      std::shared_lock<dash::SharedMutex> sl(mx);
+#else
+      mx.lock_shared();
+#endif
+      // readers never observe a partial update
+      value_t a = first.get();
+      value_t b = second.get();
+      ASSERT_EQ_U(a, b);
+#if __cplusplus < 201402L
+      mx.unlock_shared();
+#endif
+    }
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(),
+              static_cast<value_t>(first.get()));
+}
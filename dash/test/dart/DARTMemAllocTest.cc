@@ -107,6 +107,95 @@ TEST_F(DARTMemAllocTest, LocalAlloc)
 }
 
 
+TEST_F(DARTMemAllocTest, SmallAllocReuse)
+{
+  const int num_allocs = 1000;
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  std::vector<int *>       addrs(num_allocs);
+  for (int i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(1 + i % 4, DART_TYPE_INT, &gptrs[i]));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[i], (void**)&addrs[i]));
+    for (int j = 0; j < 1 + i % 4; ++j) {
+      addrs[i][j] = i;
+    }
+  }
+  // no allocation may have been overwritten
+  for (int i = 0; i < num_allocs; ++i) {
+    for (int j = 0; j < 1 + i % 4; ++j) {
+      ASSERT_EQ_U(i, addrs[i][j]);
+    }
+  }
+  for (int i = 0; i < num_allocs; i += 2) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+  // freed blocks are reused
+  for (int i = 0; i < num_allocs; i += 2) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(1 + i % 4, DART_TYPE_INT, &gptrs[i]));
+  }
+  for (int i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+  }
+}
+
+TEST_F(DARTMemAllocTest, LocalAllocGrowth)
+{
+  typedef int value_t;
+  // exceeds the default size of the pre-allocated pool
+  const size_t num_allocs = 40;
+  const size_t block_size = (1024 * 1024) / sizeof(value_t);
+
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(block_size, DART_TYPE_INT, &gptrs[i]));
+    ASSERT_NE_U(DART_GPTR_NULL, gptrs[i]);
+    value_t *baseptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_gptr_getaddr(gptrs[i], (void**)&baseptr));
+    ASSERT_NE_U(nullptr, baseptr);
+    baseptr[0]              = dash::myid().id;
+    baseptr[block_size - 1] = i;
+  }
+
+  dash::Array<dart_gptr_t> arr(dash::size());
+  arr.local[0] = gptrs[num_allocs - 1];
+  arr.barrier();
+
+  size_t  neighbor_id = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t neighbor_gptr = arr[neighbor_id];
+  value_t neighbor_val;
+  dash::dart_storage<value_t> ds(1);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+        &neighbor_val, neighbor_gptr, ds.nelem, ds.dtype, ds.dtype));
+  ASSERT_EQ_U(neighbor_id, neighbor_val);
+
+  dart_gptr_incaddr(&neighbor_gptr, (block_size - 1) * sizeof(value_t));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+        &neighbor_val, neighbor_gptr, ds.nelem, ds.dtype, ds.dtype));
+  ASSERT_EQ_U(num_allocs - 1, neighbor_val);
+
+  arr.barrier();
+
+  for (size_t i = 0; i < num_allocs; ++i) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memfree(gptrs[i]));
+  }
+}
+
+
 TEST_F(DARTMemAllocTest, SegmentReuseTest)
 {
   const size_t block_size = 10;
@@ -169,3 +258,46 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
     DART_OK,
     dart_team_memfree(gptr2));
 }
+
+TEST_F(DARTMemAllocTest, SharedAddr)
+{
+  typedef int value_t;
+  const size_t block_size = 10;
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memalloc_aligned(DART_TEAM_ALL, block_size, DART_TYPE_INT, &gptr)
+  );
+  dart_gptr_t gptr_base = gptr;
+
+  dart_gptr_setunit(&gptr, dash::team_unit_t(dash::myid().id));
+  value_t *lptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_gptr_getaddr_shared(gptr, (void**)&lptr));
+  // the local address is always accessible
+  ASSERT_NE_U(nullptr, lptr);
+  for (size_t i = 0; i < block_size; ++i) {
+    lptr[i] = dash::myid().id * block_size + i;
+  }
+  dart_barrier(DART_TEAM_ALL);
+
+  dash::team_unit_t neighbor((dash::myid() + 1) % dash::size());
+  dart_gptr_setunit(&gptr, neighbor);
+  dart_gptr_incaddr(&gptr, sizeof(value_t));
+  value_t *nptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_gptr_getaddr_shared(gptr, (void**)&nptr));
+  if (nptr != nullptr) {
+    // neighbor is located on the same node
+    EXPECT_EQ_U(neighbor.id * block_size + 1, *nptr);
+  } else {
+    LOG_MESSAGE("Unit %d is not located on the same node", neighbor.id);
+  }
+  dart_barrier(DART_TEAM_ALL);
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_memfree(gptr_base));
+}
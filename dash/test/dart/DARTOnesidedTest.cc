@@ -280,6 +280,69 @@ TEST_F(DARTOnesidedTest, StridedPutSimple) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedLocalPutGet) {
+  constexpr size_t num_rows   = 16;
+  constexpr size_t num_cols   = 8;
+  constexpr size_t num_elem   = num_rows * num_cols;
+  constexpr size_t num_repeat = 3;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  memset(local_ptr, 0, sizeof(int)*num_elem);
+
+  // a column of a row-major matrix
+  dart_datatype_t col_type;
+  dart_type_create_strided(DART_TYPE_INT, num_cols, 1, &col_type);
+
+  int *buf = new int[num_rows];
+
+  dash::barrier();
+
+  // write column i at the calling unit, the type is reused across columns
+  for (size_t r = 0; r < num_repeat; ++r) {
+    for (size_t col = 0; col < num_cols; ++col) {
+      for (size_t row = 0; row < num_rows; ++row) {
+        buf[row] = r * num_elem + row * num_cols + col;
+      }
+      gptr.addr_or_offs.offset = col * sizeof(int);
+      dart_put_blocking(gptr, buf, num_rows, DART_TYPE_INT, col_type);
+    }
+    for (size_t i = 0; i < num_elem; ++i) {
+      ASSERT_EQ_U(r * num_elem + i, local_ptr[i]);
+    }
+  }
+
+  dash::barrier();
+
+  // read the columns of the neighbor
+  gptr.unitid = (dash::myid() + 1) % dash::size();
+  for (size_t col = 0; col < num_cols; ++col) {
+    memset(buf, 0, sizeof(int)*num_rows);
+    gptr.addr_or_offs.offset = col * sizeof(int);
+    dart_get_blocking(buf, gptr, num_rows, col_type, DART_TYPE_INT);
+    for (size_t row = 0; row < num_rows; ++row) {
+      ASSERT_EQ_U((num_repeat - 1) * num_elem + row * num_cols + col,
+                  buf[row]);
+    }
+  }
+
+  dart_type_destroy(&col_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  gptr.addr_or_offs.offset = 0;
+  dart_team_memfree(gptr);
+
+  delete[] buf;
+}
+
+
 TEST_F(DARTOnesidedTest, BlockedStridedToStrided) {
 
   constexpr size_t num_elem_per_unit = 120;
@@ -596,3 +659,87 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+TEST_F(DARTOnesidedTest, PutNotify) {
+  const size_t num_rounds = 5;
+  const size_t block_size = 10;
+  dart_gptr_t  gptr;
+  dart_gptr_t  gptr_notify;
+  int         *local_ptr;
+  int64_t     *local_notify;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_rounds * block_size + 1, DART_TYPE_INT, &gptr);
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, 2, DART_TYPE_LONGLONG, &gptr_notify);
+  gptr.unitid        = dash::myid();
+  gptr_notify.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  dart_gptr_getaddr(gptr_notify, (void**)&local_notify);
+  local_notify[0] = 0;
+  local_notify[1] = 0;
+
+  dash::barrier();
+
+  // each unit streams blocks to its right neighbor
+  dart_unit_t right = (dash::myid() + 1) % dash::size();
+  dart_unit_t left  = (dash::myid() + dash::size() - 1) % dash::size();
+  std::vector<int> buf(block_size);
+  for (size_t round = 0; round < num_rounds; ++round) {
+    for (size_t i = 0; i < block_size; ++i) {
+      buf[i] = dash::myid() * 1000 + round * 100 + i;
+    }
+    dart_gptr_t dst = gptr;
+    dst.unitid = right;
+    dst.addr_or_offs.offset += round * block_size * sizeof(int);
+    dart_gptr_t notify = gptr_notify;
+    notify.unitid = right;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_put_notify(dst, buf.data(), block_size, DART_TYPE_INT,
+                      DART_TYPE_INT, notify, 1, DART_OP_SUM));
+  }
+
+  // the counter of the left neighbor's blocks arrives in order
+  for (size_t round = 0; round < num_rounds; ++round) {
+    ASSERT_EQ_U(DART_OK, dart_notify_wait(gptr_notify, round + 1));
+    for (size_t i = 0; i < block_size; ++i) {
+      ASSERT_EQ_U(static_cast<int>(left * 1000 + round * 100 + i),
+                  local_ptr[round * block_size + i]);
+    }
+  }
+  int32_t flag;
+  ASSERT_EQ_U(DART_OK, dart_notify_test(gptr_notify, num_rounds, &flag));
+  ASSERT_EQ_U(1, flag);
+  ASSERT_EQ_U(DART_OK, dart_notify_test(gptr_notify, num_rounds + 1, &flag));
+  ASSERT_EQ_U(0, flag);
+
+  // replace the second counter with an epoch number
+  dart_gptr_t dst = gptr;
+  dst.unitid = right;
+  dst.addr_or_offs.offset += num_rounds * block_size * sizeof(int);
+  dart_gptr_t notify = gptr_notify;
+  notify.unitid = right;
+  notify.addr_or_offs.offset += sizeof(int64_t);
+  buf[0] = -1;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_put_notify(dst, buf.data(), 1, DART_TYPE_INT, DART_TYPE_INT,
+                    notify, 42, DART_OP_REPLACE));
+  dart_gptr_t local_epoch = gptr_notify;
+  local_epoch.addr_or_offs.offset += sizeof(int64_t);
+  ASSERT_EQ_U(DART_OK, dart_notify_wait(local_epoch, 42));
+  ASSERT_EQ_U(-1, local_ptr[num_rounds * block_size]);
+
+  // notifications only increment or replace the counter
+  ASSERT_EQ_U(
+    DART_ERR_INVAL,
+    dart_put_notify(dst, buf.data(), 1, DART_TYPE_INT, DART_TYPE_INT,
+                    gptr_notify, 1, DART_OP_PROD));
+
+  dash::barrier();
+
+  gptr.unitid        = 0;
+  gptr_notify.unitid = 0;
+  dart_team_memfree(gptr);
+  dart_team_memfree(gptr_notify);
+}
@@ -0,0 +1,82 @@
+#ifdef DASH_MPI_IMPL_ID
+
+#include "DARTProgressTest.h"
+
+#include <dash/dart/mpi/dart_progress_priv.h>
+
+#include <mpi.h>
+
+#include <cstdlib>
+
+
+TEST_F(DARTProgressTest, Requested)
+{
+  unsetenv(DART_PROGRESS_THREAD_ENVSTR);
+  EXPECT_FALSE_U(dart__mpi__progress_requested());
+
+  for (const char * value : { "1", "on", "ON", "yes", "Yes", "true" }) {
+    setenv(DART_PROGRESS_THREAD_ENVSTR, value, 1);
+    EXPECT_TRUE_U(dart__mpi__progress_requested());
+  }
+  for (const char * value : { "0", "off", "no", "false", "", "2" }) {
+    setenv(DART_PROGRESS_THREAD_ENVSTR, value, 1);
+    EXPECT_FALSE_U(dart__mpi__progress_requested());
+  }
+}
+
+TEST_F(DARTProgressTest, Interval)
+{
+  unsetenv(DART_PROGRESS_INTERVAL_ENVSTR);
+  EXPECT_EQ_U(DART_PROGRESS_INTERVAL_DEFAULT, dart__mpi__progress_interval());
+
+  setenv(DART_PROGRESS_INTERVAL_ENVSTR, "0", 1);
+  EXPECT_EQ_U(0, dart__mpi__progress_interval());
+  setenv(DART_PROGRESS_INTERVAL_ENVSTR, "1000", 1);
+  EXPECT_EQ_U(1000, dart__mpi__progress_interval());
+
+  // invalid values fall back to the default:
+  for (const char * value : { "-1", "10us", "abc" }) {
+    setenv(DART_PROGRESS_INTERVAL_ENVSTR, value, 1);
+    EXPECT_EQ_U(DART_PROGRESS_INTERVAL_DEFAULT,
+                dart__mpi__progress_interval());
+  }
+}
+
+TEST_F(DARTProgressTest, StartStop)
+{
+  if (dart__mpi__progress_running()) {
+    SKIP_TEST_MSG("progress thread has been started in dart_init");
+  }
+  int provided;
+  MPI_Query_thread(&provided);
+
+  unsetenv(DART_PROGRESS_THREAD_ENVSTR);
+  ASSERT_EQ_U(DART_OK, dart__mpi__progress_init(provided));
+  EXPECT_FALSE_U(dart__mpi__progress_running());
+
+  setenv(DART_PROGRESS_THREAD_ENVSTR, "1", 1);
+  setenv(DART_PROGRESS_INTERVAL_ENVSTR, "10", 1);
+  ASSERT_EQ_U(DART_OK, dart__mpi__progress_init(provided));
+#if defined(DASH_ENABLE_THREADSUPPORT)
+  EXPECT_EQ_U(provided == MPI_THREAD_MULTIPLE,
+              dart__mpi__progress_running());
+#else
+  EXPECT_FALSE_U(dart__mpi__progress_running());
+#endif
+
+  // communication is not affected by the progress thread:
+  int value = dash::myid().id;
+  int sum   = 0;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_allreduce(&value, &sum, 1, DART_TYPE_INT, DART_OP_SUM,
+                   DART_TEAM_ALL));
+  EXPECT_EQ_U(dash::size() * (dash::size() - 1) / 2, sum);
+
+  ASSERT_EQ_U(DART_OK, dart__mpi__progress_fini());
+  EXPECT_FALSE_U(dart__mpi__progress_running());
+  // stopping a stopped thread is a no-op:
+  ASSERT_EQ_U(DART_OK, dart__mpi__progress_fini());
+}
+
+#endif // DASH_MPI_IMPL_ID
@@ -0,0 +1,63 @@
+#ifndef DASH_DASH_TEST_DARTPROGRESSTEST_H_
+#define DASH_DASH_TEST_DARTPROGRESSTEST_H_
+
+#include "../TestBase.h"
+
+#include <cstdlib>
+#include <string>
+
+
+/**
+ * Test fixture for the progress thread of the DART-MPI backend.
+ * Restores the environment variables controlling the progress thread
+ * after every test.
+ */
+class DARTProgressTest : public dash::test::TestBase {
+protected:
+
+  DARTProgressTest() {}
+
+  virtual ~DARTProgressTest() {}
+
+  void SetUp() override
+  {
+    dash::test::TestBase::SetUp();
+    save_env("DART_PROGRESS_THREAD",   _thread_env,   _thread_set);
+    save_env("DART_PROGRESS_INTERVAL", _interval_env, _interval_set);
+  }
+
+  void TearDown() override
+  {
+    restore_env("DART_PROGRESS_THREAD",   _thread_env,   _thread_set);
+    restore_env("DART_PROGRESS_INTERVAL", _interval_env, _interval_set);
+    dash::test::TestBase::TearDown();
+  }
+
+private:
+
+  static void save_env(const char * name, std::string & value, bool & set)
+  {
+    const char * envstr = getenv(name);
+    set = (envstr != nullptr);
+    if (set) {
+      value = envstr;
+    }
+  }
+
+  static void restore_env(
+    const char * name, const std::string & value, bool set)
+  {
+    if (set) {
+      setenv(name, value.c_str(), 1);
+    } else {
+      unsetenv(name);
+    }
+  }
+
+  std::string _thread_env;
+  std::string _interval_env;
+  bool        _thread_set   = false;
+  bool        _interval_set = false;
+};
+
+#endif /* DASH_DASH_TEST_DARTPROGRESSTEST_H_ */
@@ -1,6 +1,7 @@
 
 #include "HaloTest.h"
 
+#include <dash/Array.h>
 #include <dash/Matrix.h>
 #include <dash/Algorithm.h>
 #include <dash/halo/HaloMatrixWrapper.h>
@@ -1286,3 +1287,398 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMultiStencil)
 
   dash::Team::All().barrier();
 }
+
+TEST_F(HaloTest, StencilOperatorApply3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 26>;
+
+  auto myid(dash::myid());
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_halo(pattern);
+
+  auto local_size = matrix_halo.local.size();
+  for(auto i = 0; i < local_size; ++i)
+    matrix_halo.lbegin()[i] = myid * 1000 + i % 13;
+
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1,-1,-1), StencilP_t(-1,-1, 0), StencilP_t(-1,-1, 1),
+      StencilP_t(-1, 0,-1), StencilP_t(-1, 0, 0), StencilP_t(-1, 0, 1),
+      StencilP_t(-1, 1,-1), StencilP_t(-1, 1, 0), StencilP_t(-1, 1, 1),
+      StencilP_t( 0,-1,-1), StencilP_t( 0,-1, 0), StencilP_t( 0,-1, 1),
+      StencilP_t( 0, 0,-1),                     StencilP_t( 0, 0, 1),
+      StencilP_t( 0, 1,-1), StencilP_t( 0, 1, 0), StencilP_t( 0, 1, 1),
+      StencilP_t( 1,-1,-1), StencilP_t( 1,-1, 0), StencilP_t( 1,-1, 1),
+      StencilP_t( 1, 0,-1), StencilP_t( 1, 0, 0), StencilP_t( 1, 0, 1),
+      StencilP_t( 1, 1,-1), StencilP_t( 1, 1, 0), StencilP_t( 1, 1, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC, BoundaryProp::CUSTOM);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix_halo, bound_spec, stencil_spec);
+
+  halo_wrapper.set_custom_halos([](const std::array<dash::default_index_t,3>& coords) {
+      return 20;
+  });
+
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  auto kernel = [&stencil_spec](const auto& it) {
+    long value = *it;
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i)
+      value += (i + 1) * it.value_at(i);
+
+    return value;
+  };
+
+  std::vector<long> out_check(local_size, -1);
+  halo_wrapper.update();
+  auto it_end = stencil_op.end();
+  for(auto it = stencil_op.begin(); it != it_end; ++it)
+    out_check[it.lpos()] = kernel(it);
+
+  std::vector<long> out(local_size, -1);
+  stencil_op.apply(kernel, out.data());
+
+  for(auto i = 0; i < local_size; ++i)
+    EXPECT_EQ_U(out_check[i], out[i]);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, StencilOperatorApplyLines3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 26>;
+
+  auto myid(dash::myid());
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_halo(pattern);
+
+  auto local_size = matrix_halo.local.size();
+  for(auto i = 0; i < local_size; ++i)
+    matrix_halo.lbegin()[i] = myid * 1000 + i % 7;
+
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1,-1,-1), StencilP_t(-1,-1, 0), StencilP_t(-1,-1, 1),
+      StencilP_t(-1, 0,-1), StencilP_t(-1, 0, 0), StencilP_t(-1, 0, 1),
+      StencilP_t(-1, 1,-1), StencilP_t(-1, 1, 0), StencilP_t(-1, 1, 1),
+      StencilP_t( 0,-1,-1), StencilP_t( 0,-1, 0), StencilP_t( 0,-1, 1),
+      StencilP_t( 0, 0,-1),                     StencilP_t( 0, 0, 1),
+      StencilP_t( 0, 1,-1), StencilP_t( 0, 1, 0), StencilP_t( 0, 1, 1),
+      StencilP_t( 1,-1,-1), StencilP_t( 1,-1, 0), StencilP_t( 1,-1, 1),
+      StencilP_t( 1, 0,-1), StencilP_t( 1, 0, 0), StencilP_t( 1, 0, 1),
+      StencilP_t( 1, 1,-1), StencilP_t( 1, 1, 0), StencilP_t( 1, 1, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::CUSTOM, BoundaryProp::NONE, BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix_halo, bound_spec, stencil_spec);
+
+  halo_wrapper.set_custom_halos([](const std::array<dash::default_index_t,3>& coords) {
+      return 20;
+  });
+
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  auto kernel = [&stencil_spec](const auto& it) {
+    long value = *it;
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i)
+      value += (i + 1) * it.value_at(i);
+
+    return value;
+  };
+  auto line_kernel = [&stencil_spec](const auto& line, long* out) {
+    const auto* center = line.data();
+    for(auto j = 0; j < line.size(); ++j)
+      out[j] = center[j];
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+      const auto* points = line.data(i);
+      for(auto j = 0; j < line.size(); ++j)
+        out[j] += (i + 1) * points[j];
+    }
+  };
+
+  std::vector<long> out_check(local_size, -1);
+  stencil_op.apply(kernel, out_check.data());
+
+  dash::Team::All().barrier();
+
+  std::vector<long> out(local_size, -1);
+  stencil_op.apply_lines(line_kernel, out.data());
+
+  for(auto i = 0; i < local_size; ++i)
+    EXPECT_EQ_U(out_check[i], out[i]);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, StencilOperatorApplySteps3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 6>;
+
+  constexpr long num_steps = 3;
+
+  auto myid(dash::myid());
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_1(pattern);
+  Matrix_t matrix_2(pattern);
+  Matrix_t matrix_deep(pattern);
+  Matrix_t matrix_deep_out(pattern);
+
+  auto local_size = matrix_1.local.size();
+  for(auto i = 0; i < local_size; ++i) {
+    long value = myid * 1000 + i % 17;
+    matrix_1.lbegin()[i]        = value;
+    matrix_2.lbegin()[i]        = value;
+    matrix_deep.lbegin()[i]     = value;
+    matrix_deep_out.lbegin()[i] = value;
+  }
+
+  dash::Team::All().barrier();
+
+  // star shaped stencil with different extents per dimension, reaches the
+  // corner regions after the first step
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1, 0, 0), StencilP_t( 1, 0, 0),
+      StencilP_t( 0,-1, 0), StencilP_t( 0, 1, 0),
+      StencilP_t( 0, 0,-2), StencilP_t( 0, 0, 2)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC, BoundaryProp::CUSTOM);
+  auto custom_halos = [](const std::array<dash::default_index_t,3>& coords) {
+      return 20;
+  };
+  auto kernel = [&stencil_spec](const auto& it) {
+    long value = 2 * *it;
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i)
+      value += (i % 3) * it.value_at(i);
+
+    return value % 1000;
+  };
+
+  // reference: one halo update per step
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_1(matrix_1, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_2(matrix_2, bound_spec, stencil_spec);
+  halo_wrapper_1.set_custom_halos(custom_halos);
+  halo_wrapper_2.set_custom_halos(custom_halos);
+  auto stencil_op_1 = halo_wrapper_1.stencil_operator(stencil_spec);
+  auto stencil_op_2 = halo_wrapper_2.stencil_operator(stencil_spec);
+  for(auto step = 0; step < num_steps; ++step) {
+    if(step % 2 == 0)
+      stencil_op_1.apply(kernel, matrix_2.lbegin());
+    else
+      stencil_op_2.apply(kernel, matrix_1.lbegin());
+    dash::Team::All().barrier();
+  }
+  auto* result_check = (num_steps % 2 == 0) ? matrix_1.lbegin()
+                                            : matrix_2.lbegin();
+
+  auto halo_spec_deep = halo_wrapper_1.halo_spec().multi_step(num_steps);
+  // corner regions are needed for multiple steps only
+  EXPECT_EQ_U(0, halo_wrapper_1.halo_spec().extent(0));
+  EXPECT_EQ_U(2 * num_steps, halo_spec_deep.extent(0));
+  EXPECT_EQ_U(num_steps, halo_spec_deep.extent(4));
+  EXPECT_EQ_U(2 * num_steps, halo_spec_deep.extent(12));
+  EXPECT_EQ_U(2 * num_steps, halo_spec_deep.extent(14));
+
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_deep(matrix_deep, bound_spec, halo_spec_deep);
+  halo_wrapper_deep.set_custom_halos(custom_halos);
+  auto stencil_op_deep = halo_wrapper_deep.stencil_operator(stencil_spec);
+  stencil_op_deep.apply_steps(kernel, num_steps, matrix_deep_out.lbegin());
+
+  for(auto i = 0; i < local_size; ++i)
+    EXPECT_EQ_U(result_check[i], matrix_deep_out.lbegin()[i]);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperPush3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 26>;
+
+  constexpr long num_steps = 4;
+
+  auto myid(dash::myid());
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_1(pattern);
+  Matrix_t matrix_2(pattern);
+  Matrix_t matrix_push_1(pattern);
+  Matrix_t matrix_push_2(pattern);
+
+  auto local_size = matrix_1.local.size();
+  for(auto i = 0; i < local_size; ++i) {
+    long value = myid * 1000 + i % 11;
+    matrix_1.lbegin()[i]      = value;
+    matrix_push_1.lbegin()[i] = value;
+  }
+
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1,-1,-1), StencilP_t(-1,-1, 0), StencilP_t(-1,-1, 1),
+      StencilP_t(-1, 0,-1), StencilP_t(-1, 0, 0), StencilP_t(-1, 0, 1),
+      StencilP_t(-1, 1,-1), StencilP_t(-1, 1, 0), StencilP_t(-1, 1, 1),
+      StencilP_t( 0,-1,-1), StencilP_t( 0,-1, 0), StencilP_t( 0,-1, 1),
+      StencilP_t( 0, 0,-1),                     StencilP_t( 0, 0, 1),
+      StencilP_t( 0, 1,-1), StencilP_t( 0, 1, 0), StencilP_t( 0, 1, 1),
+      StencilP_t( 1,-1,-1), StencilP_t( 1,-1, 0), StencilP_t( 1,-1, 1),
+      StencilP_t( 1, 0,-1), StencilP_t( 1, 0, 0), StencilP_t( 1, 0, 1),
+      StencilP_t( 1, 1,-1), StencilP_t( 1, 1, 0), StencilP_t( 1, 1, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::NONE, BoundaryProp::CYCLIC, BoundaryProp::CUSTOM);
+  auto custom_halos = [](const std::array<dash::default_index_t,3>& coords) {
+      return 20;
+  };
+  auto kernel = [&stencil_spec](const auto& it) {
+    long value = *it;
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i)
+      value += (i % 5) * it.value_at(i);
+
+    return value % 1000;
+  };
+
+  // no barrier between the steps, the units are synchronized by the halo
+  // updates only
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_push_1(
+    matrix_push_1, HaloUpdateMode::PUSH, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_push_2(
+    matrix_push_2, HaloUpdateMode::PUSH, bound_spec, stencil_spec);
+  EXPECT_EQ_U(HaloUpdateMode::PUSH, halo_wrapper_push_1.update_env().mode());
+  halo_wrapper_push_1.set_custom_halos(custom_halos);
+  halo_wrapper_push_2.set_custom_halos(custom_halos);
+  auto stencil_op_push_1 = halo_wrapper_push_1.stencil_operator(stencil_spec);
+  auto stencil_op_push_2 = halo_wrapper_push_2.stencil_operator(stencil_spec);
+  for(auto step = 0; step < num_steps; ++step) {
+    if(step % 2 == 0)
+      stencil_op_push_1.apply(kernel, matrix_push_2.lbegin());
+    else
+      stencil_op_push_2.apply(kernel, matrix_push_1.lbegin());
+  }
+
+  dash::Team::All().barrier();
+
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_1(matrix_1, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_2(matrix_2, bound_spec, stencil_spec);
+  halo_wrapper_1.set_custom_halos(custom_halos);
+  halo_wrapper_2.set_custom_halos(custom_halos);
+  auto stencil_op_1 = halo_wrapper_1.stencil_operator(stencil_spec);
+  auto stencil_op_2 = halo_wrapper_2.stencil_operator(stencil_spec);
+  for(auto step = 0; step < num_steps; ++step) {
+    if(step % 2 == 0)
+      stencil_op_1.apply(kernel, matrix_2.lbegin());
+    else
+      stencil_op_2.apply(kernel, matrix_1.lbegin());
+    dash::Team::All().barrier();
+  }
+
+  for(auto i = 0; i < local_size; ++i)
+    EXPECT_EQ_U(matrix_1.lbegin()[i], matrix_push_1.lbegin()[i]);
+
+  EXPECT_THROW(halo_wrapper_push_1.update_at(0),
+               dash::exception::InvalidArgument);
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloWrapperArray1D)
+{
+  using Array_t = dash::Array<long>;
+  using Pattern_t = typename Array_t::pattern_type;
+  using index_type = typename Pattern_t::index_type;
+  using GlobBoundSpec_t = GlobalBoundarySpec<1>;
+  using StencilP_t = StencilPoint<1>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 4>;
+
+  const long size = ext_per_dim * dash::size();
+
+  Array_t array(size, dash::BLOCKED);
+  Array_t array_out(size, dash::BLOCKED);
+
+  const auto& pattern = array.pattern();
+  auto local_size = array.lsize();
+  for(auto i = 0; i < local_size; ++i)
+    array.local[i] = pattern.global(i);
+
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2), StencilP_t(-1), StencilP_t(1), StencilP_t(2));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC);
+  HaloWrapper<Array_t> halo_wrapper(array, bound_spec, stencil_spec);
+
+  halo_wrapper.update();
+
+  index_type first = pattern.global(0);
+  index_type last  = first + local_size - 1;
+  for(index_type i = 1; i <= 2; ++i) {
+    auto* halo_pre  = halo_wrapper.halo_element_at_global({ first - i });
+    auto* halo_post = halo_wrapper.halo_element_at_global({ last + i });
+    ASSERT_NE(nullptr, halo_pre);
+    ASSERT_NE(nullptr, halo_post);
+    EXPECT_EQ_U((first - i + size) % size, *halo_pre);
+    EXPECT_EQ_U((last + i) % size, *halo_post);
+  }
+
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  stencil_op.apply([](const auto& it) {
+      return it.value_at(0) + 2 * it.value_at(1) + 3 * it.value_at(2)
+             + 4 * it.value_at(3);
+    }, array_out.lbegin());
+
+  for(auto i = 0; i < local_size; ++i) {
+    long g = pattern.global(i);
+    long check = (g - 2 + size) % size + 2 * ((g - 1 + size) % size)
+                 + 3 * ((g + 1) % size) + 4 * ((g + 2) % size);
+    EXPECT_EQ_U(check, array_out.local[i]);
+  }
+
+  dash::Team::All().barrier();
+}
@@ -3,7 +3,10 @@
 
 #include <dash/GlobAsyncRef.h>
 #include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/algorithm/Fill.h>
 #include <type_traits>
+#include <vector>
 
 
 TEST_F(GlobAsyncRefTest, IsLocal) {
@@ -198,3 +201,139 @@ TEST_F(GlobAsyncRefTest, ConstTest)
   ASSERT_EQ_U(0, agref1.get());
 
 }
+
+TEST_F(GlobAsyncRefTest, Aggregation)
+{
+  const int num_elem_per_unit = 64;
+
+  dash::Array<int> array(dash::size() * num_elem_per_unit);
+  std::fill(array.lbegin(), array.lend(), -1);
+  array.barrier();
+
+  auto rneighbor = (dash::myid() + 1) % dash::size();
+  auto lneighbor = (dash::myid() + dash::size() - 1) % dash::size();
+  auto r_offset  = rneighbor * num_elem_per_unit;
+
+  {
+    dash::AsyncAggregation aggregate;
+    // overwritten below, later writes have to win
+    array.async[r_offset] = 1000;
+    // odd elements first, then even elements to be coalesced, every
+    // fourth element is skipped
+    for (int i = 1; i < num_elem_per_unit; i += 2) {
+      if (i % 4 != 3) {
+        array.async[r_offset + i] = dash::myid().id * 100 + i;
+      }
+    }
+    for (int i = 0; i < num_elem_per_unit; i += 2) {
+      array.async[r_offset + i] = dash::myid().id * 100 + i;
+    }
+    array.async.flush();
+  }
+  array.barrier();
+
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    int expected = (i % 4 != 3) ? static_cast<int>(lneighbor * 100 + i) : -1;
+    ASSERT_EQ_U(expected, array.local[i]);
+  }
+  array.barrier();
+
+  std::vector<int> values(num_elem_per_unit, -1);
+  {
+    // small buffer to also flush before the end of the scope
+    dash::AsyncAggregation aggregate(4 * sizeof(int));
+    for (int i = num_elem_per_unit - 1; i >= 0; i -= 3) {
+      array.async[r_offset + i].get(&values[i]);
+    }
+  }
+  for (int i = 0; i < num_elem_per_unit; ++i) {
+    int expected = ((num_elem_per_unit - 1 - i) % 3 == 0 && i % 4 != 3)
+                   ? static_cast<int>(dash::myid().id * 100 + i)
+                   : -1;
+    ASSERT_EQ_U(expected, values[i]);
+  }
+  array.barrier();
+}
+
+TEST_F(GlobAsyncRefTest, AggregationAtomic)
+{
+  const int num_bins = 8;
+  const int num_reps = 4;
+
+  dash::Array<dash::Atomic<int>> hist(dash::size() * num_bins);
+  dash::fill(hist.begin(), hist.end(), 0);
+  hist.barrier();
+
+  {
+    dash::AsyncAggregation aggregate;
+    for (int rep = 0; rep < num_reps; ++rep) {
+      for (size_t i = 0; i < hist.size(); ++i) {
+        hist.async[i].add(1);
+      }
+    }
+    hist.async.flush();
+  }
+  hist.barrier();
+
+  for (int li = 0; li < num_bins; ++li) {
+    auto gi = hist.pattern().global(li);
+    ASSERT_EQ_U(num_reps * dash::size(), hist[gi].get());
+  }
+}
+
+TEST_F(GlobAsyncRefTest, AggregationOrder)
+{
+  dash::Array<int> array(dash::size());
+  array.local[0] = dash::myid().id;
+  array.barrier();
+
+  auto rneighbor = (dash::myid() + 1) % dash::size();
+
+  int value = -1;
+  {
+    dash::AsyncAggregation aggregate;
+    // the get precedes the put in program order and reads the old value
+    array.async[rneighbor].get(&value);
+    array.async[rneighbor] = -2;
+    array.async.flush();
+  }
+  ASSERT_EQ_U(static_cast<int>(rneighbor), value);
+  array.barrier();
+  ASSERT_EQ_U(-2, array.local[0]);
+  array.barrier();
+
+  {
+    dash::AsyncAggregation aggregate;
+    array.async[rneighbor] = dash::myid().id;
+    // blocking get observes the buffered put
+    ASSERT_EQ_U(dash::myid().id, array.async[rneighbor].get());
+  }
+  array.barrier();
+}
+
+TEST_F(GlobAsyncRefTest, AggregationAtomicGet)
+{
+  dash::Array<dash::Atomic<int>> array(dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  auto rneighbor = (dash::myid() + 1) % dash::size();
+
+  {
+    dash::AsyncAggregation aggregate;
+    array.async[rneighbor].add(5);
+    int value = -1;
+    array.async[rneighbor].get(&value);
+    array.async.flush();
+    ASSERT_EQ_U(5, value);
+    ASSERT_EQ_U(5, array.async[rneighbor].get());
+    // fetch_op observes a buffered update
+    array.async[rneighbor].add(1);
+    int prev = -1;
+    array.async[rneighbor].fetch_add(1, &prev);
+    array.async.flush();
+    ASSERT_EQ_U(6, prev);
+  }
+  array.barrier();
+  ASSERT_EQ_U(7, array[dash::myid().id].get());
+}